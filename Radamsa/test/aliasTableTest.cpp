@@ -0,0 +1,59 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "aliasTableTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST(AliasTableTest, TestSample)
+{
+    // The sampled frequencies follow the weights, including a zero weight that is never sampled.
+
+    const std::vector<double> weights{3.0, 0.0, 1.0, 4.0, 0.5};
+    const ::vmf::radamsa::mutations::AliasTable aliasTable{weights};
+
+    ASSERT_EQ(aliasTable.GetSize(), weights.size());
+
+    constexpr size_t numberOfSamples{170000u};
+
+    std::default_random_engine randomNumberGenerator;
+    std::vector<size_t> counts(weights.size(), 0u);
+
+    for (size_t it{0u}; it < numberOfSamples; ++it)
+        ++counts[aliasTable.Sample(randomNumberGenerator)];
+
+    ASSERT_EQ(counts[1], 0u);
+
+    for (size_t it{0u}; it < weights.size(); ++it)
+        ASSERT_NEAR(static_cast<double>(counts[it]) / numberOfSamples, weights[it] / 8.5, 0.01);
+
+    // A single weight is always sampled.
+
+    const ::vmf::radamsa::mutations::AliasTable singleTable{std::vector<double>{2.0}};
+
+    ASSERT_EQ(singleTable.Sample(randomNumberGenerator), 0u);
+
+    ASSERT_THROW(::vmf::radamsa::mutations::AliasTable{std::vector<double>{}}, RuntimeException);
+    ASSERT_THROW(::vmf::radamsa::mutations::AliasTable{std::vector<double>({0.0, 0.0})}, RuntimeException);
+    ASSERT_THROW(::vmf::radamsa::mutations::AliasTable{std::vector<double>({1.0, -1.0})}, RuntimeException);
+    ASSERT_THROW(::vmf::radamsa::mutations::AliasTable{}.Sample(randomNumberGenerator), RuntimeException);
+}
+}
@@ -0,0 +1,120 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "asciiBadMutationTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(AsciiBadMutationTest, TestBuildPrintableRunIndex)
+{
+    // Compare the block classifier against a byte-by-byte scan over buffers that span several blocks.
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+    std::uniform_int_distribution<int> textDistribution(0x20, 0x7e);
+
+    for (size_t size : {1u, 63u, 64u, 65u, 200u, 1000u})
+    {
+        std::string input(size, '\0');
+
+        for (size_t it{0u}; it < size; ++it)
+            input[it] = static_cast<char>(((it / 13u) % 2u == 0u) ? textDistribution(generator) : byteDistribution(generator));
+
+        std::vector<PrintableRun> expectedRuns;
+
+        for (size_t it{0u}; it < size;)
+        {
+            auto isPrintable{[&](const size_t index) { return (input[index] >= 0x20 && input[index] <= 0x7e) || input[index] == '\t'; }};
+
+            if (!isPrintable(it))
+            {
+                ++it;
+                continue;
+            }
+
+            const size_t startIndex{it};
+
+            while (it < size && isPrintable(it))
+                ++it;
+
+            if (it - startIndex >= PrintableRunIndex::MINIMUM_RUN_SIZE)
+                expectedRuns.push_back(PrintableRun{startIndex, it - startIndex});
+        }
+
+        const PrintableRunIndex runIndex{BuildPrintableRunIndex(input.data(), input.size())};
+
+        ASSERT_EQ(runIndex.Runs.size(), expectedRuns.size());
+        ASSERT_EQ(runIndex.CumulativeSizes.size(), expectedRuns.size() + 1u);
+
+        for (size_t it{0u}; it < expectedRuns.size(); ++it)
+        {
+            ASSERT_EQ(runIndex.Runs[it].StartIndex, expectedRuns[it].StartIndex);
+            ASSERT_EQ(runIndex.Runs[it].Size, expectedRuns[it].Size);
+        }
+    }
+}
+
+TEST_F(AsciiBadMutationTest, TestInjectBadString)
+{
+    // The output must be the original buffer with a single string inserted inside a printable run.
+
+    const std::string input{textInput_, sizeof(textInput_) - 1u};
+    const PrintableRunIndex runIndex{BuildPrintableRunIndex(input.data(), input.size())};
+
+    for (size_t it{0u}; it < 100u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        constexpr size_t minimumSeedIndex{4u};
+
+        InjectBadString(newEntry, input.size(), input.data(), 1u, minimumSeedIndex, testCaseKey_);
+
+        const std::string output{GetOutput(newEntry)};
+
+        ASSERT_GT(output.size(), input.size());
+
+        size_t prefixSize{0u};
+
+        while (prefixSize < input.size() && input[prefixSize] == output[prefixSize])
+            ++prefixSize;
+
+        const size_t suffixSize{input.size() - prefixSize};
+
+        ASSERT_EQ(output.compare(output.size() - suffixSize, suffixSize, input, prefixSize, suffixSize), 0);
+
+        // The bad string may begin with the same bytes as the original text, so the injection point is somewhere
+        // at or before the first mismatch; at least one candidate position must lie inside a printable run.
+
+        bool isInsideRun{false};
+
+        for (const PrintableRun& run : runIndex.Runs)
+            isInsideRun |= (run.StartIndex <= prefixSize && prefixSize <= run.StartIndex + run.Size);
+
+        ASSERT_TRUE(isInsideRun) << prefixSize;
+    }
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    EXPECT_THROW(InjectBadString(newEntry, 0u, input.data(), 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(InjectBadString(newEntry, input.size(), nullptr, 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(InjectBadString(newEntry, input.size(), input.data(), 1u, input.size(), testCaseKey_), RuntimeException);
+}
+}
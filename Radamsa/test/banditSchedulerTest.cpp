@@ -0,0 +1,97 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "banditSchedulerTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST(BanditSchedulerTest, TestSelectArm)
+{
+    // With no feedback every arm is equally likely.
+
+    constexpr size_t numberOfArms{4u};
+    constexpr size_t numberOfSelections{40000u};
+
+    ::vmf::radamsa::mutations::BanditScheduler scheduler{numberOfArms};
+
+    ASSERT_EQ(scheduler.GetNumberOfArms(), numberOfArms);
+
+    std::default_random_engine randomNumberGenerator;
+    std::vector<size_t> counts(numberOfArms, 0u);
+
+    for (size_t it{0u}; it < numberOfSelections; ++it)
+        ++counts[scheduler.SelectArm(randomNumberGenerator)];
+
+    for (size_t it{0u}; it < numberOfArms; ++it)
+        ASSERT_NEAR(static_cast<double>(counts[it]) / numberOfSelections, 1.0 / numberOfArms, 0.02);
+
+    // Only the outputs of arm 2 are rewarded, so arm 2 ends up selected almost every time.
+
+    unsigned long outputId{1u};
+
+    for (size_t it{0u}; it < 2000u; ++it, ++outputId)
+    {
+        const size_t arm{scheduler.SelectArm(randomNumberGenerator)};
+
+        scheduler.RecordOutput(outputId, arm);
+
+        if (arm == 2u && it % 2u == 0u)
+        {
+            ASSERT_TRUE(scheduler.RecordReward(outputId));
+        }
+    }
+
+    std::fill(counts.begin(), counts.end(), 0u);
+
+    for (size_t it{0u}; it < 1000u; ++it)
+        ++counts[scheduler.SelectArm(randomNumberGenerator)];
+
+    ASSERT_GT(counts[2], 950u);
+
+    // An output is rewarded once, and only while it is still in the history.
+
+    scheduler.RecordOutput(outputId, 0u);
+
+    const double rewards{scheduler.GetRewards(0u)};
+
+    ASSERT_TRUE(scheduler.RecordReward(outputId));
+    ASSERT_FALSE(scheduler.RecordReward(outputId));
+    ASSERT_FALSE(scheduler.RecordReward(outputId + 1u));
+
+    scheduler.RecordOutput(outputId + ::vmf::radamsa::mutations::BanditScheduler::OUTPUT_HISTORY_SIZE, 1u);
+    scheduler.RecordOutput(outputId + 1u, 1u);
+
+    ASSERT_FALSE(scheduler.RecordReward(outputId));
+    ASSERT_EQ(scheduler.GetRewards(0u), rewards + 1.0);
+
+    // The counts of an arm are halved once its trials reach the maximum, so that old feedback fades.
+
+    ::vmf::radamsa::mutations::BanditScheduler decayingScheduler{1u};
+
+    for (size_t it{0u}; it <= static_cast<size_t>(::vmf::radamsa::mutations::BanditScheduler::MAXIMUM_NUMBER_OF_TRIALS); ++it)
+        decayingScheduler.RecordOutput(it, 0u);
+
+    ASSERT_EQ(decayingScheduler.GetTrials(0u), ::vmf::radamsa::mutations::BanditScheduler::MAXIMUM_NUMBER_OF_TRIALS * 0.5 + 1.0);
+
+    ASSERT_THROW(::vmf::radamsa::mutations::BanditScheduler{0u}, RuntimeException);
+    ASSERT_THROW(::vmf::radamsa::mutations::BanditScheduler{}.SelectArm(randomNumberGenerator), RuntimeException);
+}
+}
@@ -0,0 +1,37 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+#pragma once
+
+#ifndef GTEST_DECORATOR
+#define GTEST_DECORATOR std::cout << "\033[32m[          ] \033[37m[ INFO ] "
+#endif
+
+// C/C++ Includes
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Google Test Includes
+#include "gtest/gtest.h"
+
+// VMF Includes
+#include "banditScheduler.hpp"
+#include "RuntimeException.hpp"
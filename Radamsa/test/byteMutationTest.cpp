@@ -116,58 +116,58 @@ TEST_F(ByteMutationTest, TestFlipByte)
 
     const std::map<std::pair<size_t, size_t>, const std::array<char, expectedSize_>> expectedOutput{
                                                                                             {{0u, 0u}, {0x03, 0x02, 0x03, 0x04, 0x05, 0x00}},
-                                                                                            {{0u, 1u}, {0x01, 0x02, 0x03, 0x04, 0x15, 0x00}},
+                                                                                            {{0u, 1u}, {0x01, 0x02, 0x03, 0x04, 0x0d, 0x00}},
                                                                                             {{0u, 2u}, {0x01, 0x02, 0x03, 0x06, 0x05, 0x00}},
-                                                                                            {{0u, 3u}, {0x41, 0x02, 0x03, 0x04, 0x05, 0x00}},
-                                                                                            {{0u, 4u}, {0x01, 0x02, 0x03, 0x04, 0x05, 0x00}},
+                                                                                            {{0u, 3u}, {0x21, 0x02, 0x03, 0x04, 0x05, 0x00}},
+                                                                                            {{0u, 4u}, {0x01, 0x02, 0x03, 0x04, -0x7b, 0x00}},
                                                                                             {{0u, 5u}, {0x01, 0x02, 0x13, 0x04, 0x05, 0x00}},
                                                                                             {{0u, 6u}, {0x01, 0x02, 0x03, 0x04, 0x04, 0x00}},
                                                                                             {{0u, 7u}, {0x11, 0x02, 0x03, 0x04, 0x05, 0x00}},
                                                                                             {{0u, 8u}, {0x01, 0x02, 0x03, 0x04, 0x04, 0x00}},
                                                                                             {{0u, 9u}, {0x01, 0x02, 0x02, 0x04, 0x05, 0x00}},
 
-                                                                                            {{1u, 0u}, {0x01, 0x02, 0x03, 0x44, 0x05, 0x00}},
-                                                                                            {{1u, 1u}, {0x01, 0x02, 0x03, 0x04, 0x05, 0x00}},
+                                                                                            {{1u, 0u}, {0x01, 0x02, 0x03, 0x24, 0x05, 0x00}},
+                                                                                            {{1u, 1u}, {0x01, 0x02, 0x03, -0x7c, 0x05, 0x00}},
                                                                                             {{1u, 2u}, {0x01, 0x02, 0x03, 0x04, 0x15, 0x00}},
                                                                                             {{1u, 3u}, {0x01, 0x22, 0x03, 0x04, 0x05, 0x00}},
-                                                                                            {{1u, 4u}, {0x01, 0x02, 0x03, 0x44, 0x05, 0x00}},
+                                                                                            {{1u, 4u}, {0x01, 0x02, 0x03, 0x24, 0x05, 0x00}},
                                                                                             {{1u, 5u}, {0x01, 0x02, 0x03, 0x04, 0x45, 0x00}},
                                                                                             {{1u, 6u}, {0x01, 0x02, 0x02, 0x04, 0x05, 0x00}},
                                                                                             {{1u, 7u}, {0x01, 0x02, 0x03, 0x04, 0x01, 0x00}},
                                                                                             {{1u, 8u}, {0x01, 0x02, 0x03, 0x04, 0x45, 0x00}},
-                                                                                            {{1u, 9u}, {0x01, 0x02, 0x03, 0x04, 0x0d, 0x00}},
+                                                                                            {{1u, 9u}, {0x01, 0x02, 0x03, 0x04, 0x01, 0x00}},
 
-                                                                                            {{2u, 0u}, {0x01, 0x02, 0x03, 0x04, 0x05, 0x00}},
+                                                                                            {{2u, 0u}, {0x01, 0x02, -0x7d, 0x04, 0x05, 0x00}},
                                                                                             {{2u, 1u}, {0x01, 0x02, 0x03, 0x04, 0x45, 0x00}},
                                                                                             {{2u, 2u}, {0x01, 0x02, 0x03, 0x04, 0x04, 0x00}},
                                                                                             {{2u, 3u}, {0x01, 0x02, 0x03, 0x04, -0x7b, 0x00}},
                                                                                             {{2u, 4u}, {0x01, 0x02, 0x03, 0x0c, 0x05, 0x00}},
-                                                                                            {{2u, 5u}, {0x01, 0x02, 0x03, 0x04, 0x15, 0x00}},
+                                                                                            {{2u, 5u}, {0x01, 0x02, 0x03, 0x04, 0x0d, 0x00}},
                                                                                             {{2u, 6u}, {0x01, 0x02, 0x07, 0x04, 0x05, 0x00}},
                                                                                             {{2u, 7u}, {0x01, 0x02, 0x03, 0x06, 0x05, 0x00}},
-                                                                                            {{2u, 8u}, {0x01, 0x02, 0x03, 0x04, 0x05, 0x00}},
+                                                                                            {{2u, 8u}, {0x01, 0x02, 0x03, -0x7c, 0x05, 0x00}},
                                                                                             {{2u, 9u}, {0x01, 0x02, 0x03, 0x04, 0x04, 0x00}},
 
                                                                                             {{3u, 0u}, {0x01, 0x02, 0x03, 0x04, 0x15, 0x00}},
                                                                                             {{3u, 1u}, {0x01, 0x02, 0x03, 0x04, 0x01, 0x00}},
-                                                                                            {{3u, 2u}, {0x01, 0x02, 0x03, 0x04, 0x15, 0x00}},
+                                                                                            {{3u, 2u}, {0x01, 0x02, 0x03, 0x04, 0x0d, 0x00}},
                                                                                             {{3u, 3u}, {0x01, 0x02, 0x03, 0x05, 0x05, 0x00}},
                                                                                             {{3u, 4u}, {0x01, 0x02, 0x03, 0x04, 0x04, 0x00}},
                                                                                             {{3u, 5u}, {0x01, 0x02, 0x03, 0x04, 0x0d, 0x00}},
-                                                                                            {{3u, 6u}, {0x01, 0x02, 0x03, 0x04, 0x05, 0x00}},
-                                                                                            {{3u, 7u}, {0x01, 0x02, 0x03, 0x04, 0x15, 0x00}},
+                                                                                            {{3u, 6u}, {0x01, 0x02, 0x03, -0x7c, 0x05, 0x00}},
+                                                                                            {{3u, 7u}, {0x01, 0x02, 0x03, 0x04, 0x0d, 0x00}},
                                                                                             {{3u, 8u}, {0x01, 0x02, 0x03, 0x04, 0x04, 0x00}},
                                                                                             {{3u, 9u}, {0x01, 0x02, 0x03, 0x04, 0x45, 0x00}},
 
                                                                                             {{4u, 0u}, {0x01, 0x02, 0x03, 0x04, 0x07, 0x00}},
-                                                                                            {{4u, 1u}, {0x01, 0x02, 0x03, 0x04, 0x45, 0x00}},
+                                                                                            {{4u, 1u}, {0x01, 0x02, 0x03, 0x04, 0x25, 0x00}},
                                                                                             {{4u, 2u}, {0x01, 0x02, 0x03, 0x04, 0x25, 0x00}},
-                                                                                            {{4u, 3u}, {0x01, 0x02, 0x03, 0x04, 0x45, 0x00}},
+                                                                                            {{4u, 3u}, {0x01, 0x02, 0x03, 0x04, 0x25, 0x00}},
                                                                                             {{4u, 4u}, {0x01, 0x02, 0x03, 0x04, -0x7b, 0x00}},
                                                                                             {{4u, 5u}, {0x01, 0x02, 0x03, 0x04, 0x01, 0x00}},
                                                                                             {{4u, 6u}, {0x01, 0x02, 0x03, 0x04, 0x15, 0x00}},
-                                                                                            {{4u, 7u}, {0x01, 0x02, 0x03, 0x04, -0x7b, 0x00}},
-                                                                                            {{4u, 8u}, {0x01, 0x02, 0x03, 0x04, -0x7b, 0x00}},
+                                                                                            {{4u, 7u}, {0x01, 0x02, 0x03, 0x04, 0x45, 0x00}},
+                                                                                            {{4u, 8u}, {0x01, 0x02, 0x03, 0x04, 0x45, 0x00}},
                                                                                             {{4u, 9u}, {0x01, 0x02, 0x03, 0x04, 0x0d, 0x00}}};
 
     using namespace std::placeholders;
@@ -702,4 +702,64 @@ TEST_F(ByteMutationTest, TestPermuteByte)
 
     RunSubtest(expectedOutput, std::bind(&ByteMutations::PermuteByte, this, _1, _2, _3, _4, _5));
 }
+
+TEST_F(ByteMutationTest, TestPermuteAllowedBytes)
+{
+    // A header, a body and a trailing checksum; only the body may be rearranged.
+
+    const std::string input{"HDR:abcdefghCRC!"};
+    const ::vmf::radamsa::mutations::OffsetSampler allowedOffsets{input.size(), {{0u, 4u}, {12u, 16u}}};
+
+    const std::string sortedBody{"abcdefgh"};
+
+    bool isAnyBodyRearranged{false};
+
+    for (size_t it{0u}; it < 200u; ++it)
+    {
+        std::tuple<int, std::unique_ptr<SimpleStorage>, unsigned long> testCaseStorageTuple{
+                                                                                        RunByteMutationCallback(
+                                                                                                        input.data(),
+                                                                                                        input.size(),
+                                                                                                        0,
+                                                                                                        [&](StorageEntry* newEntry, const size_t size, const char* buffer, const size_t, const int testCaseKey)
+                                                                                                        {
+                                                                                                            PermuteAllowedBytes(newEntry, size, buffer, allowedOffsets, testCaseKey);
+                                                                                                        })};
+
+        const int testCaseKey{std::get<0u>(testCaseStorageTuple)};
+        const unsigned long entryId{std::get<2u>(testCaseStorageTuple)};
+        StorageEntry* storageEntryPtr{std::get<1u>(testCaseStorageTuple)->getEntryByID(entryId)};
+
+        ASSERT_EQ(storageEntryPtr->getBufferSize(testCaseKey), static_cast<int>(input.size() + 1u));
+        ASSERT_EQ(storageEntryPtr->getBufferPointer(testCaseKey)[input.size()], '\0');
+
+        const std::string output{storageEntryPtr->getBufferPointer(testCaseKey), input.size()};
+
+        ASSERT_EQ(output.substr(0u, 4u), input.substr(0u, 4u));
+        ASSERT_EQ(output.substr(12u), input.substr(12u));
+
+        std::string body{output.substr(4u, 8u)};
+
+        isAnyBodyRearranged = isAnyBodyRearranged || body != sortedBody;
+
+        std::sort(body.begin(), body.end());
+
+        ASSERT_EQ(body, sortedBody);
+    }
+
+    EXPECT_TRUE(isAnyBodyRearranged);
+
+    // Execute callback with every byte protected.
+
+    EXPECT_THROW(
+            RunByteMutationCallback(
+                            input.data(),
+                            input.size(),
+                            0,
+                            [&](StorageEntry* newEntry, const size_t size, const char* buffer, const size_t, const int testCaseKey)
+                            {
+                                PermuteAllowedBytes(newEntry, size, buffer, ::vmf::radamsa::mutations::OffsetSampler{input.size(), {{0u, input.size()}}}, testCaseKey);
+                            }),
+            RuntimeException);
+}
 }
@@ -35,6 +35,8 @@
 #endif
 
 // C/C++ Includes
+#include <algorithm>
+#include <string>
 #include <tuple>
 #include <map>
 #include <functional>
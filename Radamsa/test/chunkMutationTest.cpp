@@ -0,0 +1,253 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+
+// VMF Includes
+#include "chunkMutationTest.h"
+
+namespace
+{
+std::string EncodeLength(const uint32_t length, const bool isBigEndian)
+{
+    std::string encodedLength(4u, '\0');
+
+    for (size_t it{0u}; it < 4u; ++it)
+        encodedLength[isBigEndian ? 3u - it : it] = static_cast<char>((length >> (8u * it)) & 0xffu);
+
+    return encodedLength;
+}
+
+std::string MakePngChunk(const std::string& type, const std::string& data)
+{
+    return EncodeLength(static_cast<uint32_t>(data.size()), true) + type + data + "CRC!";
+}
+
+std::string MakeRiffChunk(const std::string& id, const std::string& data, const bool isPadded)
+{
+    return id + EncodeLength(static_cast<uint32_t>(data.size()), false) + data + ((isPadded && data.size() % 2u == 1u) ? std::string(1u, '\0') : "");
+}
+
+// A RIFF file whose header length covers the rest of the file, ending with an unpadded odd sized chunk.
+
+std::string MakeRiffInput()
+{
+    const std::string chunks{
+                        MakeRiffChunk("fmt ", std::string(16u, 'f'), true) +
+                        MakeRiffChunk("data", "ddddd", true) +
+                        MakeRiffChunk("junk", "jjjjjj", true) +
+                        MakeRiffChunk("LIST", "abc", false)};
+
+    return "RIFF" + EncodeLength(static_cast<uint32_t>(chunks.size() + 4u), false) + "WAVE" + chunks;
+}
+}
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(ChunkMutationTest, TestBuildChunkIndex)
+{
+    const std::string png{
+                    std::string{"\x89PNG\r\n\x1a\n"} +
+                    MakePngChunk("IHDR", std::string(13u, '\x01')) +
+                    MakePngChunk("tEXt", "a=b") +
+                    MakePngChunk("IDAT", std::string(10u, '\xff')) +
+                    MakePngChunk("IEND", "")};
+
+    const ChunkIndex pngIndex{BuildChunkIndex(png.data(), png.size())};
+
+    ASSERT_EQ(pngIndex.Chunks.size(), 4u);
+    EXPECT_EQ(pngIndex.Layout.LengthSize, 4u);
+    EXPECT_TRUE(pngIndex.Layout.IsBigEndian);
+    EXPECT_EQ(pngIndex.Layout.ExtraSize, 8u);
+    EXPECT_EQ(pngIndex.Chunks[0].StartIndex, 8u);
+    EXPECT_EQ(pngIndex.Chunks[3].Size, 12u);
+    EXPECT_FALSE(pngIndex.HasContainer);
+
+    const std::string riff{MakeRiffInput()};
+    const ChunkIndex riffIndex{BuildChunkIndex(riff.data(), riff.size())};
+
+    ASSERT_EQ(riffIndex.Chunks.size(), 4u);
+    EXPECT_EQ(riffIndex.Layout.LengthOffset, 4u);
+    EXPECT_FALSE(riffIndex.Layout.IsBigEndian);
+    EXPECT_EQ(riffIndex.Layout.Alignment, 2u);
+    EXPECT_EQ(riffIndex.Chunks[0].StartIndex, 12u);
+    EXPECT_EQ(riffIndex.Chunks[1].Size, 14u);
+    EXPECT_EQ(riffIndex.Chunks[3].Size, 11u);
+    EXPECT_TRUE(riffIndex.HasContainer);
+    EXPECT_EQ(riffIndex.ContainerLengthIndex, 4u);
+
+    const std::string tlv{"\x01\x03" "abc" "\x02\x00" "\x03\x01" "z", 10u};
+    const ChunkIndex tlvIndex{BuildChunkIndex(tlv.data(), tlv.size())};
+
+    ASSERT_EQ(tlvIndex.Chunks.size(), 3u);
+    EXPECT_EQ(tlvIndex.Layout.LengthSize, 1u);
+    EXPECT_EQ(tlvIndex.Layout.LengthOffset, 1u);
+
+    // Text does not chain, and chains that start past the header size are ignored.
+
+    const std::string text{"plain text without any records in it"};
+
+    EXPECT_TRUE(BuildChunkIndex(text.data(), text.size()).Chunks.empty());
+    EXPECT_TRUE(BuildChunkIndex((text + text + png).data(), text.size() * 2u + png.size()).Chunks.empty());
+    EXPECT_TRUE(BuildChunkIndex(nullptr, 10u).Chunks.empty());
+}
+
+TEST_F(ChunkMutationTest, TestChunkMutations)
+{
+    const std::string input{MakeRiffInput()};
+    const ChunkIndex index{BuildChunkIndex(input.data(), input.size())};
+
+    auto getChunks{
+            [](const std::string& text)
+            {
+                const ChunkIndex textIndex{BuildChunkIndex(text.data(), text.size())};
+
+                std::vector<std::string> chunks;
+
+                for (const Chunk& chunk : textIndex.Chunks)
+                    chunks.push_back(text.substr(chunk.StartIndex, chunk.Size));
+
+                return chunks;
+            }};
+
+    // The RIFF header length always covers the rest of the file, and the output still parses into chunks.
+
+    auto expectValidRiff{
+                    [&](const std::string& output)
+                    {
+                        EXPECT_EQ(ReadLength(output.data(), index.Layout, 4u), output.size() - 8u);
+                        EXPECT_EQ(output.compare(0u, 12u, input, 0u, 12u) == 0 || output.compare(8u, 4u, "WAVE") == 0, true);
+                    }};
+
+    std::vector<std::string> sortedChunks{getChunks(input)};
+
+    std::sort(sortedChunks.begin(), sortedChunks.end());
+
+    for (size_t it{0u}; it < 100u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        DeleteChunk(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string deleted{GetOutput(newEntry)};
+
+        expectValidRiff(deleted);
+        ASSERT_EQ(getChunks(deleted).size() + 1u, index.Chunks.size()) << deleted;
+
+        newEntry = storage_->createNewEntry();
+
+        DuplicateChunk(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string duplicated{GetOutput(newEntry)};
+
+        expectValidRiff(duplicated);
+        ASSERT_EQ(getChunks(duplicated).size(), index.Chunks.size() + 1u) << duplicated;
+
+        newEntry = storage_->createNewEntry();
+
+        SwapChunks(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string swapped{GetOutput(newEntry)};
+
+        // Only the padded chunks can be swapped; the unpadded final chunk stays last.
+
+        std::vector<std::string> swappedChunks{getChunks(swapped)};
+
+        ASSERT_EQ(swapped.size(), input.size());
+        ASSERT_EQ(swappedChunks.size(), index.Chunks.size());
+        ASSERT_EQ(swappedChunks.back(), "LIST" + EncodeLength(3u, false) + "abc");
+        ASSERT_NE(swapped, input);
+
+        std::sort(swappedChunks.begin(), swappedChunks.end());
+
+        ASSERT_EQ(swappedChunks, sortedChunks);
+    }
+
+    // A container length that no longer fits its field is saturated.
+
+    const std::string tlv{
+                    "\x01\xfd" "\x01\x50" + std::string(80u, 'a') +
+                    "\x01\x50" + std::string(80u, 'b') +
+                    "\x01\x57" + std::string(87u, 'c')};
+    const ChunkIndex tlvIndex{BuildChunkIndex(tlv.data(), tlv.size())};
+
+    ASSERT_EQ(tlvIndex.Chunks.size(), 3u);
+    ASSERT_TRUE(tlvIndex.HasContainer);
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    DuplicateChunk(newEntry, tlv.size(), tlv.data(), 2u, 0u, testCaseKey_);
+
+    EXPECT_EQ(static_cast<uint8_t>(GetOutput(newEntry)[1]), 0xffu);
+
+    // Chunks starting before the minimum seed index are never selected; when none is left the buffer is unchanged.
+
+    newEntry = storage_->createNewEntry();
+
+    SwapChunks(newEntry, input.size(), input.data(), 1u, index.Chunks[2].StartIndex, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), input);
+
+    newEntry = storage_->createNewEntry();
+
+    DeleteChunk(newEntry, input.size(), input.data(), 1u, input.size() - 1u, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), input);
+
+    newEntry = storage_->createNewEntry();
+
+    EXPECT_THROW(DeleteChunk(newEntry, 0u, input.data(), 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(DuplicateChunk(newEntry, input.size(), nullptr, 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(SwapChunks(newEntry, input.size(), input.data(), 1u, input.size(), testCaseKey_), RuntimeException);
+}
+
+TEST_F(ChunkMutationTest, TestChunkMutationsKeepProtectedContainerLength)
+{
+    const std::string input{MakeRiffInput()};
+    const ChunkIndex index{BuildChunkIndex(input.data(), input.size())};
+    const size_t minimumSeedIndex{index.Chunks[0].StartIndex};
+
+    ASSERT_GT(minimumSeedIndex, index.ContainerLengthIndex);
+
+    // The container header lies before the minimum seed index, so its length field is never rewritten.
+
+    for (size_t it{0u}; it < 20u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        DeleteChunk(newEntry, input.size(), input.data(), 1u, minimumSeedIndex, testCaseKey_);
+
+        const std::string deleted{GetOutput(newEntry)};
+
+        ASSERT_LT(deleted.size(), input.size());
+        ASSERT_EQ(deleted.compare(0u, minimumSeedIndex, input, 0u, minimumSeedIndex), 0);
+
+        newEntry = storage_->createNewEntry();
+
+        DuplicateChunk(newEntry, input.size(), input.data(), 1u, minimumSeedIndex, testCaseKey_);
+
+        const std::string duplicated{GetOutput(newEntry)};
+
+        ASSERT_GT(duplicated.size(), input.size());
+        ASSERT_EQ(duplicated.compare(0u, minimumSeedIndex, input, 0u, minimumSeedIndex), 0);
+    }
+}
+}
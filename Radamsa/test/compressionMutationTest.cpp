@@ -0,0 +1,135 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "compressionMutationTest.h"
+
+namespace
+{
+const std::string PAYLOAD{"The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog."};
+const std::string PREFIX{"HEADER\x01\x02"};
+const std::string SUFFIX{"\x03\x04TRAILER"};
+}
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(CompressionMutationTest, TestBuildCompressedRegionIndex)
+{
+    const std::string zlibStream{Deflate(PAYLOAD, CompressionFormat::Zlib)};
+    const std::string gzipStream{Deflate(PAYLOAD + "!", CompressionFormat::Gzip)};
+    const std::string input{PREFIX + zlibStream + SUFFIX + gzipStream};
+
+    const CompressedRegionIndex index{BuildCompressedRegionIndex(input.data(), input.size())};
+
+    ASSERT_EQ(index.Regions.size(), 2u);
+    EXPECT_EQ(index.Regions[0].StartIndex, PREFIX.size());
+    EXPECT_EQ(index.Regions[0].Size, zlibStream.size());
+    EXPECT_EQ(index.Regions[0].Format, CompressionFormat::Zlib);
+    EXPECT_EQ(index.Regions[0].Payload, PAYLOAD);
+    EXPECT_EQ(index.Regions[1].StartIndex, PREFIX.size() + zlibStream.size() + SUFFIX.size());
+    EXPECT_EQ(index.Regions[1].Size, gzipStream.size());
+    EXPECT_EQ(index.Regions[1].Format, CompressionFormat::Gzip);
+    EXPECT_EQ(index.Regions[1].Payload, PAYLOAD + "!");
+
+    // A seed that is a raw deflate stream as a whole is recognized; a truncated stream is not.
+
+    const std::string rawStream{Deflate(PAYLOAD, CompressionFormat::RawDeflate)};
+    const CompressedRegionIndex rawIndex{BuildCompressedRegionIndex(rawStream.data(), rawStream.size())};
+
+    ASSERT_EQ(rawIndex.Regions.size(), 1u);
+    EXPECT_EQ(rawIndex.Regions[0].Format, CompressionFormat::RawDeflate);
+    EXPECT_EQ(rawIndex.Regions[0].Payload, PAYLOAD);
+
+    const std::string truncated{PREFIX + zlibStream.substr(0u, zlibStream.size() / 2u)};
+
+    EXPECT_TRUE(BuildCompressedRegionIndex(truncated.data(), truncated.size()).Regions.empty());
+    EXPECT_TRUE(BuildCompressedRegionIndex(PAYLOAD.data(), PAYLOAD.size()).Regions.empty());
+    EXPECT_TRUE(BuildCompressedRegionIndex(nullptr, 10u).Regions.empty());
+}
+
+TEST_F(CompressionMutationTest, TestMutateCompressedRegion)
+{
+    const std::string zlibStream{Deflate(PAYLOAD, CompressionFormat::Zlib)};
+    const std::string input{PREFIX + zlibStream + SUFFIX};
+
+    auto editPayload{
+                [](vmf::radamsa::mutations::PieceTable& payload)
+                {
+                    payload.ReplaceByte(0u, 'X');
+                    payload.InsertBytes(payload.GetSize(), "!", 1u);
+                }};
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    MutateCompressedRegion(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_, editPayload);
+
+    // The bytes around the stream are kept, and the recompressed stream inflates to the edited payload.
+
+    const std::string output{GetOutput(newEntry)};
+
+    ASSERT_EQ(output.compare(0u, PREFIX.size(), PREFIX), 0);
+    ASSERT_EQ(output.compare(output.size() - SUFFIX.size(), SUFFIX.size(), SUFFIX), 0);
+
+    const CompressedRegionIndex outputIndex{BuildCompressedRegionIndex(output.data(), output.size())};
+
+    ASSERT_EQ(outputIndex.Regions.size(), 1u);
+    EXPECT_EQ(outputIndex.Regions[0].StartIndex, PREFIX.size());
+    EXPECT_EQ(outputIndex.Regions[0].Size, output.size() - PREFIX.size() - SUFFIX.size());
+    EXPECT_EQ(outputIndex.Regions[0].Payload, "X" + PAYLOAD.substr(1u) + "!");
+
+    // Gzip and raw deflate streams keep their wrapper.
+
+    for (const CompressionFormat format : {CompressionFormat::Gzip, CompressionFormat::RawDeflate})
+    {
+        const std::string stream{Deflate(PAYLOAD, format)};
+
+        newEntry = storage_->createNewEntry();
+
+        MutateCompressedRegion(newEntry, stream.size(), stream.data(), 2u + static_cast<unsigned long>(format), 0u, testCaseKey_, editPayload);
+
+        const std::string mutatedStream{GetOutput(newEntry)};
+        const CompressedRegionIndex streamIndex{BuildCompressedRegionIndex(mutatedStream.data(), mutatedStream.size())};
+
+        ASSERT_EQ(streamIndex.Regions.size(), 1u);
+        EXPECT_EQ(streamIndex.Regions[0].Format, format);
+        EXPECT_EQ(streamIndex.Regions[0].Payload, "X" + PAYLOAD.substr(1u) + "!");
+    }
+
+    // Regions starting before the minimum seed index are never selected; without a region the buffer is unchanged.
+
+    newEntry = storage_->createNewEntry();
+
+    MutateCompressedRegion(newEntry, input.size(), input.data(), 1u, PREFIX.size() + 1u, testCaseKey_, editPayload);
+
+    EXPECT_EQ(GetOutput(newEntry), input);
+
+    newEntry = storage_->createNewEntry();
+
+    MutateCompressedRegion(newEntry, PAYLOAD.size(), PAYLOAD.data(), 10u, 0u, testCaseKey_, editPayload);
+
+    EXPECT_EQ(GetOutput(newEntry), PAYLOAD);
+
+    newEntry = storage_->createNewEntry();
+
+    EXPECT_THROW(MutateCompressedRegion(newEntry, 0u, input.data(), 1u, 0u, testCaseKey_, editPayload), RuntimeException);
+    EXPECT_THROW(MutateCompressedRegion(newEntry, input.size(), nullptr, 1u, 0u, testCaseKey_, editPayload), RuntimeException);
+    EXPECT_THROW(MutateCompressedRegion(newEntry, input.size(), input.data(), 1u, input.size(), testCaseKey_, editPayload), RuntimeException);
+}
+}
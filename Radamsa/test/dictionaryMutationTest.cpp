@@ -0,0 +1,268 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <set>
+
+// VMF Includes
+#include "dictionaryMutationTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(DictionaryMutationTest, TestAhoCorasick)
+{
+    // Compare every reported occurrence against a naive search, including overlapping tokens and tokens that are suffixes of others.
+
+    const std::vector<std::string> tokens{"he", "she", "his", "hers", "e", std::string{"\x00\xff", 2u}, "aaa"};
+    const ::vmf::radamsa::mutations::AhoCorasick matcher{tokens};
+
+    const std::string input{std::string{"ushers aaaa his \x00\xff she"} + std::string(1u, '\0') + "\xff"};
+
+    std::set<std::pair<size_t, size_t>> expected;
+
+    for (size_t tokenIndex{0u}; tokenIndex < tokens.size(); ++tokenIndex)
+        for (size_t index{input.find(tokens[tokenIndex])}; index != std::string::npos; index = input.find(tokens[tokenIndex], index + 1u))
+            expected.insert({index, tokenIndex});
+
+    std::set<std::pair<size_t, size_t>> actual;
+    size_t previousEndIndex{0u};
+
+    matcher.ForEachMatch(
+                input.data(),
+                input.size(),
+                [&](const size_t startIndex, const size_t tokenIndex)
+                {
+                    const size_t endIndex{startIndex + tokens[tokenIndex].size()};
+
+                    EXPECT_GE(endIndex, previousEndIndex);
+
+                    previousEndIndex = endIndex;
+
+                    actual.insert({startIndex, tokenIndex});
+                });
+
+    EXPECT_EQ(actual, expected);
+
+    // An empty automaton matches nothing.
+
+    const ::vmf::radamsa::mutations::AhoCorasick emptyMatcher{std::vector<std::string>{}};
+
+    emptyMatcher.ForEachMatch(input.data(), input.size(), [](const size_t, const size_t) { FAIL(); });
+}
+
+TEST_F(DictionaryMutationTest, TestLoadDictionaryFile)
+{
+    const std::string path{::testing::TempDir() + "radamsa_dictionary_test.dict"};
+
+    {
+        std::ofstream file{path, std::ios::binary};
+
+        file << "# comment\n"
+             << "\n"
+             << "keyword_get=\"GET\"\n"
+             << "\"\\x00\\xffA\\\"\\\\\"\n"
+             << "  raw token\r\n";
+    }
+
+    const std::vector<std::string> tokens{LoadDictionaryFile(path)};
+
+    std::remove(path.c_str());
+
+    ASSERT_EQ(tokens.size(), 3u);
+    EXPECT_EQ(tokens[0], "GET");
+    EXPECT_EQ(tokens[1], std::string("\x00\xff" "A\"\\", 5u));
+    EXPECT_EQ(tokens[2], "raw token");
+
+    EXPECT_THROW(LoadDictionaryFile(path), RuntimeException);
+}
+
+TEST_F(DictionaryMutationTest, TestDictionaryMutations)
+{
+    const std::string input{"GET /index.html HTTP/1.1"};
+    const std::vector<std::string> tokens{"GET", "POST", "HTTP", "index"};
+
+    // Without a dictionary, the input is passed through unchanged.
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    InsertToken(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), input);
+
+    SetDictionary(tokens);
+
+    ASSERT_EQ(GetDictionary()->Tokens.size(), tokens.size());
+
+    auto removeOneToken{
+                    [&](const std::string& output, std::string& remainder)
+                    {
+                        // Find a token whose removal at some position leaves the given remainder.
+
+                        for (const std::string& token : tokens)
+                            for (size_t index{output.find(token)}; index != std::string::npos; index = output.find(token, index + 1u))
+                                if (output.substr(0u, index) + output.substr(index + token.size()) == remainder)
+                                    return true;
+
+                        return false;
+                    }};
+
+    for (size_t it{0u}; it < 100u; ++it)
+    {
+        std::string original{input};
+
+        newEntry = storage_->createNewEntry();
+
+        InsertToken(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+        ASSERT_TRUE(removeOneToken(GetOutput(newEntry), original));
+
+        newEntry = storage_->createNewEntry();
+
+        DuplicateToken(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+        ASSERT_TRUE(removeOneToken(GetOutput(newEntry), original));
+
+        newEntry = storage_->createNewEntry();
+
+        ExtendToken(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+        ASSERT_TRUE(removeOneToken(GetOutput(newEntry), original));
+
+        // Replacing leaves the input with one of its tokens swapped for another one.
+
+        newEntry = storage_->createNewEntry();
+
+        ReplaceToken(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string replaced{GetOutput(newEntry)};
+
+        bool isExpected{false};
+
+        for (const std::string oldToken : {"GET", "HTTP", "index"})
+            for (const std::string& newToken : tokens)
+            {
+                const size_t index{input.find(oldToken)};
+
+                isExpected |= (replaced == input.substr(0u, index) + newToken + input.substr(index + oldToken.size()));
+            }
+
+        ASSERT_TRUE(isExpected) << replaced;
+    }
+
+    // Occurrences before the minimum seed index are left alone.
+
+    for (size_t it{0u}; it < 100u; ++it)
+    {
+        newEntry = storage_->createNewEntry();
+
+        DuplicateToken(newEntry, input.size(), input.data(), 1u, 5u, testCaseKey_);
+
+        ASSERT_EQ(GetOutput(newEntry).compare(0u, 5u, input, 0u, 5u), 0);
+    }
+
+    // Replacing the dictionary drops the cached occurrences of the previous one.
+
+    SetDictionary({"html"});
+
+    newEntry = storage_->createNewEntry();
+
+    DuplicateToken(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), "GET /index.htmlhtml HTTP/1.1");
+
+    newEntry = storage_->createNewEntry();
+
+    EXPECT_THROW(InsertToken(newEntry, 0u, input.data(), 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(InsertToken(newEntry, input.size(), nullptr, 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(InsertToken(newEntry, input.size(), input.data(), 1u, input.size(), testCaseKey_), RuntimeException);
+}
+
+TEST_F(DictionaryMutationTest, TestTokenExtractor)
+{
+    constexpr size_t maximumNumberOfTokens{64u};
+
+    ::vmf::radamsa::mutations::TokenExtractor extractor{maximumNumberOfTokens};
+
+    EXPECT_TRUE(extractor.GetTokens().empty());
+
+    // Every entry holds a delimited token and a binary magic value surrounded by random bytes.
+
+    const std::string magic{"\x89PNG\r\n\x1a\n"};
+    std::default_random_engine randomNumberGenerator;
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    auto randomBytes{
+                [&](const size_t size)
+                {
+                    std::string bytes(size, '\0');
+
+                    for (char& byte : bytes)
+                        byte = static_cast<char>(distribution(randomNumberGenerator));
+
+                    return bytes;
+                }};
+
+    for (size_t it{0u}; it < 20u; ++it)
+    {
+        const std::string entry{randomBytes(100u) + " frobnicate_widget " + randomBytes(50u) + magic + randomBytes(100u)};
+
+        extractor.AddEntry(entry.data(), entry.size());
+    }
+
+    std::vector<std::string> tokens{extractor.GetTokens()};
+
+    EXPECT_LE(tokens.size(), maximumNumberOfTokens);
+    EXPECT_NE(std::find(tokens.begin(), tokens.end(), "frobnicate_widget"), tokens.end());
+    EXPECT_NE(std::find(tokens.begin(), tokens.end(), magic), tokens.end());
+
+    // Tokens seen only once are never published, and padding made of a single repeated byte is skipped.
+
+    const std::string unique{"unique_word " + std::string(64u, '\0')};
+    const uint64_t version{extractor.GetVersion()};
+
+    extractor.AddEntry(unique.data(), unique.size());
+
+    tokens = extractor.GetTokens();
+
+    EXPECT_EQ(extractor.GetVersion(), version);
+    EXPECT_EQ(std::find(tokens.begin(), tokens.end(), "unique_word"), tokens.end());
+
+    // Many moderately frequent tokens fill the heap without growing it, and do not evict the frequent ones.
+
+    for (size_t it{0u}; it < 1000u; ++it)
+    {
+        const std::string entry{"word" + std::to_string(it)};
+
+        extractor.AddEntry(entry.data(), entry.size());
+        extractor.AddEntry(entry.data(), entry.size());
+    }
+
+    tokens = extractor.GetTokens();
+
+    EXPECT_GT(extractor.GetVersion(), version);
+    EXPECT_EQ(tokens.size(), maximumNumberOfTokens);
+    EXPECT_NE(std::find(tokens.begin(), tokens.end(), "frobnicate_widget"), tokens.end());
+    EXPECT_NE(std::find(tokens.begin(), tokens.end(), magic), tokens.end());
+
+    // A null buffer is ignored.
+
+    extractor.AddEntry(nullptr, 10u);
+}
+}
@@ -0,0 +1,125 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "duplicateFilterTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST(DuplicateFilterTest, TestContains)
+{
+    using ::vmf::radamsa::mutations::DuplicateFilter;
+
+    // Buffers that differ in a single bit, or only in trailing zero bytes, hash differently.
+
+    const std::string buffer(100u, 'a');
+
+    std::string flippedBuffer{buffer};
+    flippedBuffer[57] ^= 0x04;
+
+    const uint64_t hash{DuplicateFilter::HashBytes(buffer.data(), buffer.size())};
+
+    ASSERT_EQ(hash, DuplicateFilter::HashBytes(buffer.data(), buffer.size()));
+    ASSERT_NE(hash, DuplicateFilter::HashBytes(flippedBuffer.data(), flippedBuffer.size()));
+    ASSERT_NE(DuplicateFilter::HashBytes("ab\0", 3u), DuplicateFilter::HashBytes("ab", 2u));
+    ASSERT_NE(DuplicateFilter::HashBytes("", 0u), DuplicateFilter::HashBytes("\0", 1u));
+
+    // Every inserted hash is found, and few of the others are.
+
+    constexpr size_t capacity{10000u};
+
+    DuplicateFilter duplicateFilter{capacity};
+
+    ASSERT_EQ(duplicateFilter.GetCapacity(), capacity);
+
+    for (uint64_t it{0u}; it < capacity; ++it)
+        duplicateFilter.Insert(DuplicateFilter::HashBytes(reinterpret_cast<const char*>(&it), sizeof(it)));
+
+    size_t numberOfFalsePositives{0u};
+
+    for (uint64_t it{0u}; it < 2u * capacity; ++it)
+    {
+        const bool isContained{duplicateFilter.Contains(DuplicateFilter::HashBytes(reinterpret_cast<const char*>(&it), sizeof(it)))};
+
+        if (it < capacity)
+            ASSERT_TRUE(isContained);
+        else if (isContained)
+            ++numberOfFalsePositives;
+    }
+
+    ASSERT_LT(numberOfFalsePositives, capacity / 50u);
+
+    // Hashes are remembered for one more generation, then forgotten.
+
+    for (uint64_t it{capacity}; it < 2u * capacity; ++it)
+        duplicateFilter.Insert(DuplicateFilter::HashBytes(reinterpret_cast<const char*>(&it), sizeof(it)));
+
+    for (uint64_t it{0u}; it < capacity; ++it)
+        ASSERT_TRUE(duplicateFilter.Contains(DuplicateFilter::HashBytes(reinterpret_cast<const char*>(&it), sizeof(it))));
+
+    for (uint64_t it{2u * capacity}; it < 3u * capacity; ++it)
+        duplicateFilter.Insert(DuplicateFilter::HashBytes(reinterpret_cast<const char*>(&it), sizeof(it)));
+
+    size_t numberOfRememberedHashes{0u};
+
+    for (uint64_t it{0u}; it < capacity; ++it)
+        if (duplicateFilter.Contains(DuplicateFilter::HashBytes(reinterpret_cast<const char*>(&it), sizeof(it))))
+            ++numberOfRememberedHashes;
+
+    ASSERT_LT(numberOfRememberedHashes, capacity / 50u);
+
+    ASSERT_THROW(DuplicateFilter{0u}, RuntimeException);
+}
+
+TEST(DuplicateFilterTest, TestHasher)
+{
+    using ::vmf::radamsa::mutations::DuplicateFilter;
+
+    // Splitting a buffer into any pieces gives the same hash as hashing it whole, including across stripe boundaries.
+
+    std::string buffer;
+
+    for (size_t it{0u}; it < 200u; ++it)
+        buffer.push_back(static_cast<char>(it * 37u));
+
+    for (const size_t size : {0u, 5u, 31u, 32u, 33u, 100u, 200u})
+    {
+        const uint64_t hash{DuplicateFilter::HashBytes(buffer.data(), size)};
+
+        for (const size_t pieceSize : {1u, 3u, 8u, 31u, 32u, 40u})
+        {
+            DuplicateFilter::Hasher hasher;
+
+            for (size_t it{0u}; it < size; it += pieceSize)
+                hasher.Update(buffer.data() + it, std::min(pieceSize, size - it));
+
+            ASSERT_EQ(hasher.Finish(), hash) << size << " " << pieceSize;
+        }
+    }
+
+    DuplicateFilter::Hasher hasher;
+
+    hasher.Update(buffer.data(), 10u);
+    hasher.Update(buffer.data(), 0u);
+    hasher.Update(buffer.data() + 10u, 90u);
+
+    ASSERT_EQ(hasher.Finish(), DuplicateFilter::HashBytes(buffer.data(), 100u));
+}
+}
@@ -0,0 +1,155 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "encodingMutationTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(EncodingMutationTest, TestCodecs)
+{
+    // Every tail length of a base64 group round trips, and the known vectors of RFC 4648 decode.
+
+    const std::string bytes{"\x00\xff\x10\x80" "foobar", 10u};
+
+    for (size_t size{0u}; size <= bytes.size(); ++size)
+    {
+        const std::string decoded{bytes.substr(0u, size)};
+        const std::string base64{EncodeBase64(decoded)};
+        const std::string hex{EncodeHex(decoded, size % 2u == 0u)};
+
+        std::string roundTrip;
+
+        EXPECT_EQ(base64.size() % 4u, 0u);
+        ASSERT_TRUE(size == 0u || DecodeBase64(base64.data(), base64.size(), roundTrip));
+        EXPECT_EQ(roundTrip, decoded);
+        ASSERT_TRUE(DecodeHex(hex.data(), hex.size(), roundTrip));
+        EXPECT_EQ(roundTrip, decoded);
+    }
+
+    EXPECT_EQ(EncodeBase64("f"), "Zg==");
+    EXPECT_EQ(EncodeBase64("fo"), "Zm8=");
+    EXPECT_EQ(EncodeBase64("foobar"), "Zm9vYmFy");
+    EXPECT_EQ(EncodeHex("\x0a\xbc", false), "0abc");
+    EXPECT_EQ(EncodeHex("\x0a\xbc", true), "0ABC");
+
+    std::string decoded;
+
+    EXPECT_FALSE(DecodeBase64("Zm9vY", 5u, decoded));
+    EXPECT_FALSE(DecodeBase64("Zm=v", 4u, decoded));
+    EXPECT_FALSE(DecodeHex("abc", 3u, decoded));
+    EXPECT_FALSE(DecodeHex("zz", 2u, decoded));
+}
+
+TEST_F(EncodingMutationTest, TestBuildEncodedRegionIndex)
+{
+    const std::string input{
+                    "{\"blob\": \"SGVsbG8sIFdvcmxkISBIZWxsbyE=\", "
+                    "\"hash\": \"0123456789abcdef0123456789abcdef\", "
+                    "\"HASH\": \"DEADBEEF00112233\", "
+                    "\"name\": \"someVeryLongIdentifierName\", "
+                    "\"number\": 12345678901234567890, "
+                    "\"short\": \"aGk=\"}"};
+
+    const EncodedRegionIndex index{BuildEncodedRegionIndex(input.data(), input.size())};
+
+    ASSERT_EQ(index.Regions.size(), 3u);
+
+    EXPECT_EQ(index.Regions[0].Encoding, EncodingType::Base64);
+    EXPECT_EQ(input.substr(index.Regions[0].StartIndex, index.Regions[0].Size), "SGVsbG8sIFdvcmxkISBIZWxsbyE=");
+    EXPECT_EQ(index.Regions[0].Decoded, "Hello, World! Hello!");
+
+    EXPECT_EQ(index.Regions[1].Encoding, EncodingType::Hex);
+    EXPECT_FALSE(index.Regions[1].IsUpperCase);
+    EXPECT_EQ(index.Regions[1].Decoded.size(), 16u);
+
+    EXPECT_EQ(index.Regions[2].Encoding, EncodingType::Hex);
+    EXPECT_TRUE(index.Regions[2].IsUpperCase);
+    EXPECT_EQ(index.Regions[2].Decoded, std::string("\xde\xad\xbe\xef\x00\x11\x22\x33", 8u));
+
+    EXPECT_TRUE(BuildEncodedRegionIndex(nullptr, 10u).Regions.empty());
+}
+
+TEST_F(EncodingMutationTest, TestMutateEncodedRegion)
+{
+    const std::string input{"<data encoding=\"base64\">SGVsbG8sIFdvcmxkISBIZWxsbyE=</data><id>DEADBEEF00112233</id>"};
+    const EncodedRegionIndex index{BuildEncodedRegionIndex(input.data(), input.size())};
+
+    ASSERT_EQ(index.Regions.size(), 2u);
+
+    auto appendByte{
+                [](vmf::radamsa::mutations::PieceTable& decoded)
+                {
+                    decoded.InsertBytes(decoded.GetSize(), "\x7f", 1u);
+                }};
+
+    // Each output re-encodes exactly one of the regions with one byte appended, and keeps the rest of the input.
+
+    bool isBase64Mutated{false};
+    bool isHexMutated{false};
+
+    for (size_t it{0u}; it < 50u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        MutateEncodedRegion(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_, appendByte);
+
+        const std::string output{GetOutput(newEntry)};
+
+        if (output.find("DEADBEEF00112233</id>") == std::string::npos)
+        {
+            ASSERT_EQ(output, input.substr(0u, index.Regions[1].StartIndex) + "DEADBEEF001122337F</id>");
+
+            isHexMutated = true;
+        }
+        else
+        {
+            ASSERT_EQ(output, input.substr(0u, index.Regions[0].StartIndex) + EncodeBase64("Hello, World! Hello!\x7f") + input.substr(index.Regions[0].StartIndex + index.Regions[0].Size));
+
+            isBase64Mutated = true;
+        }
+    }
+
+    EXPECT_TRUE(isBase64Mutated);
+    EXPECT_TRUE(isHexMutated);
+
+    // Regions starting before the minimum seed index are never selected; without a region the buffer is unchanged.
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    MutateEncodedRegion(newEntry, input.size(), input.data(), 1u, index.Regions[1].StartIndex + 1u, testCaseKey_, appendByte);
+
+    EXPECT_EQ(GetOutput(newEntry), input);
+
+    const std::string text{"plain text without any encoded data"};
+
+    newEntry = storage_->createNewEntry();
+
+    MutateEncodedRegion(newEntry, text.size(), text.data(), 2u, 0u, testCaseKey_, appendByte);
+
+    EXPECT_EQ(GetOutput(newEntry), text);
+
+    newEntry = storage_->createNewEntry();
+
+    EXPECT_THROW(MutateEncodedRegion(newEntry, 0u, input.data(), 1u, 0u, testCaseKey_, appendByte), RuntimeException);
+    EXPECT_THROW(MutateEncodedRegion(newEntry, input.size(), nullptr, 1u, 0u, testCaseKey_, appendByte), RuntimeException);
+    EXPECT_THROW(MutateEncodedRegion(newEntry, input.size(), input.data(), 1u, input.size(), testCaseKey_, appendByte), RuntimeException);
+}
+}
@@ -0,0 +1,68 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "entropyMapTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST(EntropyMapTest, TestGetEntropy)
+{
+    // A block of one repeated byte, a block of two alternating bytes, a block of every byte value, and a final block of
+    // four distinct bytes.
+
+    std::string buffer(256u, 'a');
+
+    for (size_t it{0u}; it < 256u; ++it)
+        buffer.push_back((it % 2u == 0u) ? 'a' : 'b');
+
+    for (size_t it{0u}; it < 256u; ++it)
+        buffer.push_back(static_cast<char>(it));
+
+    buffer += "wxyz";
+
+    const ::vmf::radamsa::mutations::EntropyMap entropyMap{buffer.data(), buffer.size(), 256u};
+
+    ASSERT_EQ(entropyMap.GetBlockSize(), 256u);
+    ASSERT_EQ(entropyMap.GetNumberOfBlocks(), 4u);
+
+    ASSERT_NEAR(entropyMap.GetEntropy(0u), 0.0f, 1e-6f);
+    ASSERT_NEAR(entropyMap.GetEntropy(1u), 1.0f, 1e-6f);
+    ASSERT_NEAR(entropyMap.GetEntropy(2u), 8.0f, 1e-6f);
+    ASSERT_NEAR(entropyMap.GetEntropy(3u), 2.0f, 1e-6f);
+
+    // Random bytes come close to eight bits per byte, well above text.
+
+    std::default_random_engine randomNumberGenerator;
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    std::string randomBuffer;
+
+    for (size_t it{0u}; it < 4096u; ++it)
+        randomBuffer.push_back(static_cast<char>(distribution(randomNumberGenerator)));
+
+    const ::vmf::radamsa::mutations::EntropyMap randomEntropyMap{randomBuffer.data(), randomBuffer.size(), 4096u};
+
+    ASSERT_GT(randomEntropyMap.GetEntropy(0u), 7.9f);
+
+    ASSERT_EQ((::vmf::radamsa::mutations::EntropyMap{buffer.data(), 0u, 256u}.GetNumberOfBlocks()), 0u);
+    ASSERT_THROW((::vmf::radamsa::mutations::EntropyMap{buffer.data(), buffer.size(), 0u}), RuntimeException);
+}
+}
@@ -0,0 +1,175 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "fuseMutationTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(FuseMutationTest, TestBuildKGramIndex)
+{
+    // Every k-gram start position must be stored exactly once, in the bucket of its own hash.
+
+    constexpr size_t inputSize{sizeof(firstInput_) - 1u};
+    constexpr size_t kGramLength{KGramIndex::KGRAM_LENGTH};
+
+    const KGramIndex index{BuildKGramIndex(firstInput_, inputSize)};
+
+    ASSERT_EQ(index.Positions.size(), inputSize - kGramLength + 1u);
+    ASSERT_EQ(index.BucketOffsets.back(), index.Positions.size());
+
+    std::vector<bool> isPositionSeen(index.Positions.size(), false);
+
+    for (size_t bucket{0u}; bucket + 1u < index.BucketOffsets.size(); ++bucket)
+    {
+        for (size_t it{index.BucketOffsets[bucket]}; it < index.BucketOffsets[bucket + 1u]; ++it)
+        {
+            const size_t position{index.Positions[it]};
+
+            ASSERT_EQ(index.GetBucket(GetKGramHash(&firstInput_[position])), bucket);
+            ASSERT_FALSE(isPositionSeen[position]);
+
+            isPositionSeen[position] = true;
+        }
+    }
+
+    // Buffers shorter than a k-gram produce an empty index.
+
+    ASSERT_TRUE(BuildKGramIndex(firstInput_, kGramLength - 1u).IsEmpty());
+}
+
+TEST_F(FuseMutationTest, TestKGramIndexIsCached)
+{
+    constexpr unsigned long seedId{7u};
+
+    const auto firstIndex{GetKGramIndex(firstInput_, sizeof(firstInput_) - 1u, seedId)};
+    const auto secondIndex{GetKGramIndex(firstInput_, sizeof(firstInput_) - 1u, seedId)};
+
+    ASSERT_EQ(firstIndex.get(), secondIndex.get());
+}
+
+TEST_F(FuseMutationTest, TestFuseThis)
+{
+    // The output must be a prefix of the input followed by a suffix of the input.
+
+    const std::string input{firstInput_};
+
+    for (size_t it{0u}; it < 50u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        FuseThis(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string output{GetOutput(newEntry)};
+
+        bool isSplice{false};
+
+        for (size_t prefixSize{0u}; prefixSize <= output.size() && !isSplice; ++prefixSize)
+        {
+            const std::string suffix{output.substr(prefixSize)};
+
+            isSplice = input.compare(0u, prefixSize, output, 0u, prefixSize) == 0 &&
+                       suffix.size() <= input.size() &&
+                       input.compare(input.size() - suffix.size(), suffix.size(), suffix) == 0;
+        }
+
+        ASSERT_TRUE(isSplice) << output;
+    }
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    EXPECT_THROW(FuseThis(newEntry, 0u, firstInput_, 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(FuseThis(newEntry, input.size(), nullptr, 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(FuseThis(newEntry, input.size(), input.data(), 1u, input.size(), testCaseKey_), RuntimeException);
+}
+
+TEST_F(FuseMutationTest, TestFuseNext)
+{
+    // The output must be a prefix of the first input followed by a suffix of the second input.
+
+    const std::string first{firstInput_};
+    const std::string second{secondInput_};
+
+    for (size_t it{0u}; it < 50u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        constexpr size_t minimumSeedIndex{3u};
+
+        FuseNext(newEntry, first.size(), first.data(), 1u, second.size(), second.data(), 2u, minimumSeedIndex, testCaseKey_);
+
+        const std::string output{GetOutput(newEntry)};
+
+        bool isSplice{false};
+
+        for (size_t prefixSize{minimumSeedIndex}; prefixSize <= output.size() && !isSplice; ++prefixSize)
+        {
+            const std::string suffix{output.substr(prefixSize)};
+
+            isSplice = first.compare(0u, prefixSize, output, 0u, prefixSize) == 0 &&
+                       suffix.size() <= second.size() &&
+                       second.compare(second.size() - suffix.size(), suffix.size(), suffix) == 0;
+        }
+
+        ASSERT_TRUE(isSplice) << output;
+    }
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    EXPECT_THROW(FuseNext(newEntry, first.size(), first.data(), 1u, 0u, second.data(), 2u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(FuseNext(newEntry, first.size(), first.data(), 1u, second.size(), nullptr, 2u, 0u, testCaseKey_), RuntimeException);
+}
+
+TEST_F(FuseMutationTest, TestFuseOld)
+{
+    // The output must keep a prefix and a suffix of the first input around a run of the second input.
+
+    const std::string first{firstInput_};
+    const std::string second{secondInput_};
+
+    for (size_t it{0u}; it < 50u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        FuseOld(newEntry, first.size(), first.data(), 1u, second.size(), second.data(), 2u, 0u, testCaseKey_);
+
+        const std::string output{GetOutput(newEntry)};
+
+        bool isEmbedded{false};
+
+        for (size_t prefixSize{0u}; prefixSize <= output.size() && !isEmbedded; ++prefixSize)
+        {
+            if (first.compare(0u, prefixSize, output, 0u, prefixSize) != 0)
+                break;
+
+            for (size_t suffixSize{0u}; prefixSize + suffixSize <= output.size() && !isEmbedded; ++suffixSize)
+            {
+                const std::string borrowed{output.substr(prefixSize, output.size() - prefixSize - suffixSize)};
+
+                isEmbedded = suffixSize <= first.size() &&
+                             first.compare(first.size() - suffixSize, suffixSize, output, output.size() - suffixSize, suffixSize) == 0 &&
+                             second.find(borrowed) != std::string::npos;
+            }
+        }
+
+        ASSERT_TRUE(isEmbedded) << output;
+    }
+}
+}
@@ -0,0 +1,42 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+#pragma once
+
+#ifndef GTEST_DECORATOR
+#define GTEST_DECORATOR std::cout << "\033[32m[          ] \033[37m[ INFO ] "
+#endif
+
+// VMF Includes
+#include "mutationTestFixture.h"
+#include "fuseMutations.hpp"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+class FuseMutationTest : public MutationTestFixture<::vmf::radamsa::mutations::FuseMutations>
+{
+public:
+    virtual ~FuseMutationTest() = default;
+
+protected:
+    static constexpr char firstInput_[]{"<a><b>first</b><c>text</c></a>"};
+    static constexpr char secondInput_[]{"<x><b>second</b><y>more text</y></x>"};
+};
+}
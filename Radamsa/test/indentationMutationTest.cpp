@@ -0,0 +1,198 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <set>
+
+// VMF Includes
+#include "indentationMutationTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(IndentationMutationTest, TestBuildIndentationIndex)
+{
+    // Blank lines are skipped but stay inside the block that surrounds them; the last line has no newline.
+
+    const std::string input{indentationInput_, sizeof(indentationInput_) - 1u};
+    const IndentationIndex index{BuildIndentationIndex(input.data(), input.size())};
+
+    auto getBlock{
+            [&](const IndentationIndex& blockIndex, const std::string& blockInput, const size_t lineIndex)
+            {
+                const IndentedLine& line{blockIndex.Lines[lineIndex]};
+                const size_t endIndex{blockIndex.Lines[line.BlockEndLine - 1u].EndIndex};
+
+                return blockInput.substr(line.StartIndex, endIndex - line.StartIndex);
+            }};
+
+    ASSERT_EQ(index.Lines.size(), 7u);
+
+    const std::vector<std::string> blocks{
+                                    "root:\n  a: 1\n  b:\n    c: 2\n\n    d: 3\n  e: 4\n",
+                                    "  a: 1\n",
+                                    "  b:\n    c: 2\n\n    d: 3\n",
+                                    "    c: 2\n",
+                                    "    d: 3\n",
+                                    "  e: 4\n",
+                                    "next: 5"};
+    const std::vector<size_t> depths{0u, 2u, 2u, 4u, 4u, 2u, 0u};
+
+    for (size_t it{0u}; it < blocks.size(); ++it)
+    {
+        EXPECT_EQ(getBlock(index, input, it), blocks[it]);
+        EXPECT_EQ(index.Lines[it].Depth, depths[it]);
+    }
+
+    EXPECT_EQ(index.SiblingLines, (std::vector<size_t>{0u, 1u, 2u, 3u}));
+
+    // The lines must be found at every alignment of the block scan; leading blank lines, including CRLF ones, are skipped.
+
+    for (size_t padding : {1u, 60u, 63u, 64u, 127u})
+    {
+        const std::string paddedInput{std::string(padding - 1u, '\n') + "\r\n" + input};
+        const IndentationIndex paddedIndex{BuildIndentationIndex(paddedInput.data(), paddedInput.size())};
+
+        ASSERT_EQ(paddedIndex.Lines.size(), index.Lines.size());
+
+        for (size_t it{0u}; it < blocks.size(); ++it)
+            ASSERT_EQ(getBlock(paddedIndex, paddedInput, it), blocks[it]);
+    }
+
+    EXPECT_TRUE(BuildIndentationIndex("\n \n\t\r\n", 6u).Lines.empty());
+    EXPECT_TRUE(BuildIndentationIndex(nullptr, 6u).Lines.empty());
+}
+
+TEST_F(IndentationMutationTest, TestBlockMutations)
+{
+    const std::string input{indentationInput_, sizeof(indentationInput_) - 1u};
+
+    // Every possible result, worked out by hand from the blocks of the input.
+
+    const std::set<std::string> deleted{
+                                "next: 5",
+                                "root:\n  b:\n    c: 2\n\n    d: 3\n  e: 4\nnext: 5",
+                                "root:\n  a: 1\n  e: 4\nnext: 5",
+                                "root:\n  a: 1\n  b:\n\n    d: 3\n  e: 4\nnext: 5",
+                                "root:\n  a: 1\n  b:\n    c: 2\n\n  e: 4\nnext: 5",
+                                "root:\n  a: 1\n  b:\n    c: 2\n\n    d: 3\nnext: 5",
+                                "root:\n  a: 1\n  b:\n    c: 2\n\n    d: 3\n  e: 4\n"};
+    const std::set<std::string> swapped{
+                                "next: 5\nroot:\n  a: 1\n  b:\n    c: 2\n\n    d: 3\n  e: 4",
+                                "root:\n  b:\n    c: 2\n\n    d: 3\n  a: 1\n  e: 4\nnext: 5",
+                                "root:\n  a: 1\n  e: 4\n  b:\n    c: 2\n\n    d: 3\nnext: 5",
+                                "root:\n  a: 1\n  b:\n    d: 3\n\n    c: 2\n  e: 4\nnext: 5"};
+
+    // A duplicated block follows itself; the last block gains the newline it lacks.
+
+    const IndentationIndex index{BuildIndentationIndex(input.data(), input.size())};
+
+    std::set<std::string> duplicated;
+
+    for (const IndentedLine& line : index.Lines)
+    {
+        const size_t endIndex{index.Lines[line.BlockEndLine - 1u].EndIndex};
+        const std::string block{input.substr(line.StartIndex, endIndex - line.StartIndex)};
+
+        duplicated.insert(input.substr(0u, endIndex) + (block.back() == '\n' ? "" : "\n") + block + input.substr(endIndex));
+    }
+
+    EXPECT_EQ(duplicated.count(input + "\nnext: 5"), 1u);
+
+    auto stripIndentation{
+                    [](const std::string& text)
+                    {
+                        std::string stripped;
+                        bool isLineStart{true};
+
+                        for (const char character : text)
+                        {
+                            if (isLineStart && (character == ' ' || character == '\t'))
+                                continue;
+
+                            isLineStart = (character == '\n');
+                            stripped.push_back(character);
+                        }
+
+                        return stripped;
+                    }};
+
+    std::set<std::string> seenDeleted;
+    std::set<std::string> seenSwapped;
+
+    for (size_t it{0u}; it < 200u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        DeleteBlock(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string deletedOutput{GetOutput(newEntry)};
+
+        ASSERT_EQ(deleted.count(deletedOutput), 1u) << deletedOutput;
+
+        seenDeleted.insert(deletedOutput);
+
+        newEntry = storage_->createNewEntry();
+
+        DuplicateBlock(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string duplicatedOutput{GetOutput(newEntry)};
+
+        ASSERT_EQ(duplicated.count(duplicatedOutput), 1u) << duplicatedOutput;
+
+        newEntry = storage_->createNewEntry();
+
+        SwapBlocks(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string swappedOutput{GetOutput(newEntry)};
+
+        ASSERT_EQ(swapped.count(swappedOutput), 1u) << swappedOutput;
+
+        seenSwapped.insert(swappedOutput);
+
+        newEntry = storage_->createNewEntry();
+
+        ReindentBlock(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        // Only leading whitespace changes.
+
+        const std::string reindentedOutput{GetOutput(newEntry)};
+
+        ASSERT_NE(reindentedOutput, input);
+        ASSERT_EQ(stripIndentation(reindentedOutput), stripIndentation(input));
+    }
+
+    EXPECT_EQ(seenDeleted, deleted);
+    EXPECT_EQ(seenSwapped, swapped);
+
+    // Lines starting before the minimum seed index are never selected; when no line is left the buffer is unchanged.
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    DeleteBlock(newEntry, input.size(), input.data(), 2u, input.size() - 1u, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), input);
+
+    newEntry = storage_->createNewEntry();
+
+    EXPECT_THROW(DeleteBlock(newEntry, 0u, input.data(), 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(DuplicateBlock(newEntry, input.size(), nullptr, 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(SwapBlocks(newEntry, input.size(), input.data(), 1u, input.size(), testCaseKey_), RuntimeException);
+}
+}
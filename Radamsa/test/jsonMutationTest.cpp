@@ -0,0 +1,202 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "jsonMutationTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(JsonMutationTest, TestBuildJsonIndex)
+{
+    // Structural characters and escaped quotes inside strings must not split values.
+
+    const std::string input{jsonInput_, sizeof(jsonInput_) - 1u};
+    const JsonIndex jsonIndex{BuildJsonIndex(input.data(), input.size())};
+
+    const std::vector<std::pair<std::string, ContainerType>> expectedValues{
+                                                                        {input, ContainerType::None},
+                                                                        {R"([1, "x,]\"", {"b": null}])", ContainerType::Object},
+                                                                        {"1", ContainerType::Array},
+                                                                        {R"("x,]\"")", ContainerType::Array},
+                                                                        {R"({"b": null})", ContainerType::Array},
+                                                                        {"null", ContainerType::Object},
+                                                                        {R"({"d": true})", ContainerType::Object},
+                                                                        {"true", ContainerType::Object},
+                                                                        {"2", ContainerType::Object}};
+
+    ASSERT_EQ(jsonIndex.Values.size(), expectedValues.size());
+
+    for (size_t it{0u}; it < expectedValues.size(); ++it)
+    {
+        const JsonValue& value{jsonIndex.Values[it]};
+
+        EXPECT_EQ(input.substr(value.StartIndex, value.EndIndex - value.StartIndex), expectedValues[it].first);
+        EXPECT_EQ(value.Parent, expectedValues[it].second);
+    }
+
+    EXPECT_EQ(jsonIndex.ArrayMembers.size(), 3u);
+    EXPECT_EQ(jsonIndex.ObjectMembers.size(), 5u);
+
+    // The member range of an object member covers its key.
+
+    const JsonValue& lastMember{jsonIndex.Values.back()};
+
+    EXPECT_EQ(input.substr(lastMember.MemberStartIndex, lastMember.MemberEndIndex - lastMember.MemberStartIndex), R"( "e": 2)");
+
+    // The string state must carry across blocks, so shift the input through every alignment of a block boundary.
+
+    for (size_t padding{1u}; padding <= 64u; ++padding)
+    {
+        const std::string paddedInput{std::string(padding, ' ') + input};
+        const JsonIndex paddedIndex{BuildJsonIndex(paddedInput.data(), paddedInput.size())};
+
+        ASSERT_EQ(paddedIndex.Values.size(), jsonIndex.Values.size()) << padding;
+
+        for (size_t it{0u}; it < jsonIndex.Values.size(); ++it)
+            ASSERT_EQ(paddedIndex.Values[it].StartIndex, jsonIndex.Values[it].StartIndex + padding);
+    }
+
+    // Runs of backslashes: an even run does not escape the quote that follows it.
+
+    const std::string backslashes{R"(["\\\\", "\\\"]", 3])"};
+
+    EXPECT_EQ(BuildJsonIndex(backslashes.data(), backslashes.size()).ArrayMembers.size(), 3u);
+
+    // Unclosed containers are dropped, the complete values before them are kept.
+
+    const std::string truncated{R"([1, 2] {"a": [3)"};
+
+    EXPECT_EQ(BuildJsonIndex(truncated.data(), truncated.size()).Values.size(), 3u);
+}
+
+TEST_F(JsonMutationTest, TestJsonMutations)
+{
+    const std::string input{jsonInput_, sizeof(jsonInput_) - 1u};
+    const JsonIndex jsonIndex{BuildJsonIndex(input.data(), input.size())};
+
+    std::string sortedInput{input};
+    std::sort(sortedInput.begin(), sortedInput.end());
+
+    for (size_t it{0u}; it < 100u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        SwapValues(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        std::string swapped{GetOutput(newEntry)};
+
+        std::sort(swapped.begin(), swapped.end());
+
+        ASSERT_EQ(swapped, sortedInput);
+
+        // Every output must be reproducible from a single array member or object member of the index.
+
+        newEntry = storage_->createNewEntry();
+
+        DuplicateArrayMember(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string duplicated{GetOutput(newEntry)};
+
+        bool isExpected{false};
+
+        for (const uint32_t member : jsonIndex.ArrayMembers)
+        {
+            const JsonValue& value{jsonIndex.Values[member]};
+            const std::string valueText{input.substr(value.StartIndex, value.EndIndex - value.StartIndex)};
+
+            isExpected |= (duplicated == input.substr(0u, value.EndIndex) + "," + valueText + input.substr(value.EndIndex));
+        }
+
+        ASSERT_TRUE(isExpected) << duplicated;
+
+        newEntry = storage_->createNewEntry();
+
+        DeleteKey(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string deleted{GetOutput(newEntry)};
+
+        isExpected = false;
+
+        for (const uint32_t member : jsonIndex.ObjectMembers)
+        {
+            const JsonValue& value{jsonIndex.Values[member]};
+
+            isExpected |= (deleted == input.substr(0u, value.MemberStartIndex) + input.substr(value.MemberEndIndex + 1u));
+            isExpected |= (deleted == input.substr(0u, value.MemberStartIndex - 1u) + input.substr(value.MemberEndIndex));
+            isExpected |= (deleted == input.substr(0u, value.MemberStartIndex) + input.substr(value.MemberEndIndex));
+        }
+
+        ASSERT_TRUE(isExpected) << deleted;
+    }
+
+    // Removing every key one at a time must keep the commas balanced.
+
+    const std::string object{R"({"a": 1, "b": 2})"};
+
+    for (size_t it{0u}; it < 20u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        DeleteKey(newEntry, object.size(), object.data(), 2u, 0u, testCaseKey_);
+
+        const std::string output{GetOutput(newEntry)};
+
+        ASSERT_TRUE(output == R"({ "b": 2})" || output == R"({"a": 1})") << output;
+    }
+
+    // Splicing takes a whole value from the other buffer.
+
+    const std::string other{R"([{"z": [0]}])"};
+
+    for (size_t it{0u}; it < 100u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        SpliceValue(newEntry, object.size(), object.data(), 2u, other.size(), other.data(), 3u, 0u, testCaseKey_);
+
+        const std::string output{GetOutput(newEntry)};
+
+        bool isExpected{false};
+
+        for (const std::string& replacement : {other, std::string{R"({"z": [0]})"}, std::string{"[0]"}, std::string{"0"}})
+        {
+            isExpected |= (output == replacement);
+            isExpected |= (output == R"({"a": )" + replacement + R"(, "b": 2})");
+            isExpected |= (output == R"({"a": 1, "b": )" + replacement + "}");
+        }
+
+        ASSERT_TRUE(isExpected) << output;
+    }
+
+    // Inputs without JSON values are passed through unchanged.
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    DeleteKey(newEntry, 4u, "text", 4u, 0u, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), "text");
+
+    newEntry = storage_->createNewEntry();
+
+    EXPECT_THROW(SwapValues(newEntry, 0u, input.data(), 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(SwapValues(newEntry, input.size(), nullptr, 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(SwapValues(newEntry, input.size(), input.data(), 1u, input.size(), testCaseKey_), RuntimeException);
+}
+}
@@ -0,0 +1,89 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "jumpMutationTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(JumpMutationTest, TestJump)
+{
+    // The output must be a prefix of the original buffer followed by a non-empty suffix of the other buffer.
+
+    const std::string original{"abcdefghijklmnopqrstuvwxyz"};
+    const std::string other{"0123456789"};
+
+    for (size_t it{0u}; it < 200u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        constexpr size_t minimumSeedIndex{5u};
+
+        Jump(newEntry, original.size(), original.data(), other.size(), other.data(), minimumSeedIndex, testCaseKey_);
+
+        const std::string output{GetOutput(newEntry)};
+        const size_t prefixSize{output.find_first_of(other)};
+
+        ASSERT_NE(prefixSize, std::string::npos);
+        ASSERT_GE(prefixSize, minimumSeedIndex);
+        ASSERT_EQ(output.compare(0u, prefixSize, original, 0u, prefixSize), 0);
+
+        const std::string suffix{output.substr(prefixSize)};
+
+        ASSERT_EQ(other.compare(other.size() - suffix.size(), suffix.size(), suffix), 0);
+    }
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    EXPECT_THROW(Jump(newEntry, 0u, original.data(), other.size(), other.data(), 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(Jump(newEntry, original.size(), original.data(), 0u, other.data(), 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(Jump(newEntry, original.size(), nullptr, other.size(), other.data(), 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(Jump(newEntry, original.size(), original.data(), other.size(), nullptr, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(Jump(newEntry, original.size(), original.data(), other.size(), other.data(), original.size(), testCaseKey_), RuntimeException);
+}
+
+TEST_F(JumpMutationTest, TestJumpLine)
+{
+    // Line aligned jumps keep whole lines of both buffers.
+
+    const std::string original{"a1\na2\na3\na4"};
+    const std::string other{"b1\nb2\nb3\n"};
+
+    const std::vector<std::string> prefixes{"", "a1\n", "a1\na2\n", "a1\na2\na3\n", original};
+    const std::vector<std::string> suffixes{other, "b2\nb3\n", "b3\n"};
+
+    for (size_t it{0u}; it < 200u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        JumpLine(newEntry, original.size(), original.data(), other.size(), other.data(), 0u, testCaseKey_);
+
+        const std::string output{GetOutput(newEntry)};
+
+        bool isExpected{false};
+
+        for (const std::string& prefix : prefixes)
+            for (const std::string& suffix : suffixes)
+                isExpected |= (output == prefix + suffix);
+
+        ASSERT_TRUE(isExpected) << output;
+    }
+}
+}
@@ -1097,6 +1097,137 @@ TEST_F(LineMutationTest, TestIsBinarish)
     }
 }
 
+TEST_F(LineMutationTest, TestLineIndex)
+{
+    // Test the BindLineIndex() method in the LineMutations class.
+    // While a line index is bound to a buffer, GetNumberOfLinesAfterIndex() and GetLineData() answer from it.
+    // Every answer should be identical to the one obtained by scanning the buffer.
+
+    auto compareWithScan{
+                    [&](const char* buffer, const size_t size)
+                    {
+                        std::vector<size_t> numberOfLines;
+                        std::vector<Line> lines;
+
+                        for (size_t characterIndex{0u}; characterIndex < size; ++characterIndex)
+                            numberOfLines.push_back(GetNumberOfLinesAfterIndex(buffer, size, characterIndex));
+
+                        for (size_t lineIndex{0u}; lineIndex < numberOfLines.front(); ++lineIndex)
+                            for (size_t numberOfLinesAfterIndex{0u}; numberOfLinesAfterIndex <= numberOfLines.front(); ++numberOfLinesAfterIndex)
+                                lines.push_back(GetLineData(buffer, size, lineIndex, numberOfLinesAfterIndex));
+
+                        BindLineIndex(buffer, size, std::make_shared<const LineIndex>(BuildLineIndex(buffer, size)));
+
+                        for (size_t characterIndex{0u}; characterIndex < size; ++characterIndex)
+                            ASSERT_EQ(numberOfLines[characterIndex], GetNumberOfLinesAfterIndex(buffer, size, characterIndex));
+
+                        auto expectedLine{lines.begin()};
+
+                        for (size_t lineIndex{0u}; lineIndex < numberOfLines.front(); ++lineIndex)
+                            for (size_t numberOfLinesAfterIndex{0u}; numberOfLinesAfterIndex <= numberOfLines.front(); ++numberOfLinesAfterIndex)
+                                ASSERT_EQ(*expectedLine++, GetLineData(buffer, size, lineIndex, numberOfLinesAfterIndex));
+
+                        // Out of bounds arguments are still rejected.
+
+                        EXPECT_THROW(GetNumberOfLinesAfterIndex(buffer, size, size), RuntimeException);
+                        EXPECT_THROW(GetLineData(buffer, size, numberOfLines.front(), 0u), RuntimeException);
+
+                        UnbindLineIndex();
+                    }};
+
+    {
+        // Valid Input - These subtests should match the scan for the ascii and utf8 buffers.
+
+        compareWithScan(asciiInputBuffer_, sizeof(asciiInputBuffer_));
+        compareWithScan(utf8InputBuffer_, sizeof(utf8InputBuffer_));
+    }
+
+    {
+        // Valid Input - This subtest should match the scan for a buffer spanning several blocks with leading, trailing and adjacent newlines.
+
+        std::string buffer{"\n"};
+
+        for (size_t it{0u}; it < 100u; ++it)
+            buffer += std::string(it % 7u, 'a') + "\n";
+
+        compareWithScan(buffer.data(), buffer.size());
+    }
+
+    {
+        // Valid Input - This subtest should scan a buffer other than the bound one.
+
+        constexpr char boundBuffer[]{"a\nb"};
+        constexpr char otherBuffer[]{"a\nb\nc"};
+
+        BindLineIndex(boundBuffer, sizeof(boundBuffer), std::make_shared<const LineIndex>(BuildLineIndex(boundBuffer, sizeof(boundBuffer))));
+
+        ASSERT_EQ(GetNumberOfLinesAfterIndex(otherBuffer, sizeof(otherBuffer), 0u), 3u);
+        ASSERT_EQ(GetNumberOfLinesAfterIndex(boundBuffer, sizeof(boundBuffer) - 1u, 0u), 2u);
+
+        UnbindLineIndex();
+    }
+}
+
+TEST_F(LineMutationTest, TestPreferredOffsets)
+{
+    // Test the BindPreferredOffsets() method in the LineMutations class.
+    // While preferred offsets are bound to a buffer, GetRandomLineIndex() only draws lines that hold one of them,
+    // unless none of the candidate lines does.
+
+    constexpr char buffer[]{"aa\nbb\ncc\ndd\n"};
+    constexpr size_t size{sizeof(buffer) - 1u};
+
+    // Only the offsets of the third line, "cc\n", are preferred.
+
+    const auto preferredOffsets{std::make_shared<const ::vmf::radamsa::mutations::OffsetBitmap>(std::vector<uint64_t>{0x1c0u}, size)};
+
+    auto drawLineIndices{
+                    [&](const char* drawBuffer, const size_t characterIndex, const size_t maximumLineIndex)
+                    {
+                        const size_t numberOfLinesAfterIndex{GetNumberOfLinesAfterIndex(drawBuffer, size, characterIndex)};
+
+                        std::set<size_t> lineIndices;
+
+                        for (size_t it{0u}; it < 100u; ++it)
+                            lineIndices.insert(GetRandomLineIndex(drawBuffer, size, numberOfLinesAfterIndex, maximumLineIndex));
+
+                        return lineIndices;
+                    }};
+
+    BindPreferredOffsets(buffer, size, preferredOffsets);
+
+    {
+        // Valid Input - These subtests should only draw the preferred line, counted from the line of the character index,
+        // with and without a bound line index.
+
+        ASSERT_EQ(drawLineIndices(buffer, 0u, 3u), (std::set<size_t>{2u}));
+        ASSERT_EQ(drawLineIndices(buffer, 4u, 2u), (std::set<size_t>{1u}));
+
+        BindLineIndex(buffer, size, std::make_shared<const LineIndex>(BuildLineIndex(buffer, size)));
+
+        ASSERT_EQ(drawLineIndices(buffer, 0u, 3u), (std::set<size_t>{2u}));
+        ASSERT_EQ(drawLineIndices(buffer, 7u, 2u), (std::set<size_t>{0u}));
+
+        UnbindLineIndex();
+    }
+
+    {
+        // Valid Input - These subtests should draw uniformly when no candidate line holds a preferred offset, and for
+        // a buffer other than the bound one.
+
+        ASSERT_EQ(drawLineIndices(buffer, 0u, 1u), (std::set<size_t>{0u, 1u}));
+        ASSERT_EQ(drawLineIndices(buffer, 9u, 1u), (std::set<size_t>{0u, 1u}));
+
+        const std::string otherBuffer{buffer};
+
+        ASSERT_EQ(drawLineIndices(otherBuffer.data(), 0u, 3u), (std::set<size_t>{0u, 1u, 2u, 3u}));
+    }
+
+    UnbindPreferredOffsets();
+
+    ASSERT_EQ(drawLineIndices(buffer, 0u, 3u), (std::set<size_t>{0u, 1u, 2u, 3u}));
+}
+
 TEST_F(LineMutationTest, TestDeleteSequentialLines)
 {
     // Test the DeleteSequentialLines() method in the LineMutations class.
@@ -1812,1795 +1943,1887 @@ TEST_F(LineMutationTest, TestDuplicateLine)
 {
     // Test the DuplicateLine() method in the LineMutations class.
     // The method accepts a character buffer, size, and character index.
-    // If the original character buffer is UTF-8, the internal algorithm selects a selects a random line, 
+    // If the original character buffer is ASCII, the internal algorithm selects a selects a random line, 
     // duplicates it, and copies the contents to a null-terminated character buffer.
-    // If the original character buffer is ASCII, no lines are removed and the
+    // If the original character buffer is UTF-8, no lines are duplicated and the
     // original contents are copied to a null-terminated character buffer.
 
     // The expected output data was gathered during a previous run using the default random seed.
     // If the random seed is changed, the output data will also change and the unit tests will fail.
 
     const std::map<std::pair<character_index, random_draw_index>, std::pair<const char* const, expected_buffer_size>> asciiOutput{
-                                                                                            {{0u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{1u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{2u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{3u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{4u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{5u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{6u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{7u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{8u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{9u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{10u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{11u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{12u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{13u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{14u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{15u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{16u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{17u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{18u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{19u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{20u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{21u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{22u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{23u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{24u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{25u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{26u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{27u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{28u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{29u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{30u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}}};
+                                                                                            {{0u, 0u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 1u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 3u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 4u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 5u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 6u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{1u, 0u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 1u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{1u, 3u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 4u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 5u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 7u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 8u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 9u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{2u, 0u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 2u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{2u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{2u, 5u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 6u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 8u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{3u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{3u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{3u, 2u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{3u, 3u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{3u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{3u, 5u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{3u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{3u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{3u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{3u, 9u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{4u, 0u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{4u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{4u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{4u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{4u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{4u, 5u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{4u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{4u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{4u, 8u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{4u, 9u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{5u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 1u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 2u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 3u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 4u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 5u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 6u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{5u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{5u, 9u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{6u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{6u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 3u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{6u, 5u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 6u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 7u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{6u, 9u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{7u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 1u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 2u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{7u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 5u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{7u, 7u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{7u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{8u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{8u, 1u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{8u, 2u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{8u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{8u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{8u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{8u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{8u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{8u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{8u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{9u, 0u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{9u, 1u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{9u, 2u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{9u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{9u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{9u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{9u, 6u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{9u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{9u, 8u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{9u, 9u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{10u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 1u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 2u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 3u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 4u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{10u, 7u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 9u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{11u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{11u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{11u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{11u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{11u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{11u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{11u, 6u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{11u, 7u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{11u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{11u, 9u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{12u, 0u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{12u, 1u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{12u, 2u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{12u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{12u, 4u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{12u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{12u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{12u, 7u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{12u, 8u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{12u, 9u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{13u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{13u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{13u, 2u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{13u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{13u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{13u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{13u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{13u, 7u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{13u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{13u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{14u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{14u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{14u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{14u, 3u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{14u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{14u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{14u, 6u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{14u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{14u, 8u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{14u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{15u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{15u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{15u, 2u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{15u, 3u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{15u, 4u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{15u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{15u, 6u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{15u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{15u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{15u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{16u, 0u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 3u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 4u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{16u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 7u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{16u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{17u, 0u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{17u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{17u, 2u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{17u, 3u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{17u, 4u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{17u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{17u, 6u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{17u, 7u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{17u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{17u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{18u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{18u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{18u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{18u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{18u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{18u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{18u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{18u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{18u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{18u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{19u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{19u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{19u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{19u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{19u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{19u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{19u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{19u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{19u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{19u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{20u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{20u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{20u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{20u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{20u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{20u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{20u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{20u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{20u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{20u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{21u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{21u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{21u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{21u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{21u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{21u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{21u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{21u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{21u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{21u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{22u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{22u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{22u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{22u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{22u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{22u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{22u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{22u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{22u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{22u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{23u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{23u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{23u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{23u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{23u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{23u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{23u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{23u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{23u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{23u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{24u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{25u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{26u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{27u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{28u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{29u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{30u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}}};
 
     const std::map<std::pair<character_index, random_draw_index>, std::pair<const char* const, expected_buffer_size>> utf8Output{
-                                                                                            {{0u, 0u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 1u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 5u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 6u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            
-                                                                                            {{1u, 0u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{1u, 3u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 4u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 7u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 8u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 9u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{2u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{2u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{2u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 6u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            
-                                                                                            {{3u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{3u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{3u, 2u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{3u, 3u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{3u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{3u, 5u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{3u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{3u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{3u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{3u, 9u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{4u, 0u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{4u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{4u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{4u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{4u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{4u, 5u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{4u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{4u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{4u, 8u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{4u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{5u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 2u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 3u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 4u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 5u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{5u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{5u, 9u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{6u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{6u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{6u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 7u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{6u, 9u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{7u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{7u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{7u, 7u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{7u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{8u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{8u, 1u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{8u, 2u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{8u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{8u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{8u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{8u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{8u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{8u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{8u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            
-                                                                                            {{9u, 0u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{9u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{9u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{9u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{9u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{9u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{9u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{9u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{9u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{9u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{10u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 3u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 4u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{10u, 7u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{11u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{11u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{11u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{11u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{11u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{11u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{11u, 6u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{11u, 7u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{11u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{11u, 9u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{12u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{12u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{12u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{12u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{12u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{12u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{12u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{12u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{12u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{12u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{13u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{13u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{13u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{13u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{13u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{13u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{13u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{13u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{13u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{13u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{14u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{14u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{14u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{14u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{14u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{14u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{14u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{14u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{14u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{14u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{15u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{15u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{15u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{15u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{15u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{15u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{15u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{15u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{15u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{15u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{16u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{16u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{16u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{17u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{17u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{17u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{17u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{17u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{17u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{17u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{17u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{17u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{17u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{18u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{18u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{18u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{18u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{18u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{18u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{18u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{18u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{18u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{18u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{19u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{19u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{19u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{19u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{19u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{19u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{19u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{19u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{19u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{19u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{20u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{20u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{20u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{20u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{20u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{20u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{20u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{20u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{20u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{20u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{21u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{21u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{21u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{21u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{21u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{21u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{21u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{21u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{21u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{21u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{22u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{22u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{22u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{22u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{22u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{22u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{22u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{22u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{22u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{22u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{23u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{23u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{23u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{23u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{23u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{23u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{23u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{23u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{23u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{23u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{24u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{25u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{26u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{27u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{28u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{29u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{30u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}}};
-
-    using namespace std::placeholders;
-
-    RunSubtest(
-        asciiInputBuffer_,
-        sizeof(asciiInputBuffer_),
-        asciiOutput,
-        std::bind(&LineMutations::DuplicateLine, this, _1, _2, _3, _4, _5));
+                                                                                            {{0u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-    RunSubtest(
-        utf8InputBuffer_,
-        sizeof(utf8InputBuffer_),
-        utf8Output,
-        std::bind(&LineMutations::DuplicateLine, this, _1, _2, _3, _4, _5));
-}
+                                                                                            {{1u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-TEST_F(LineMutationTest, TestCopyLineCloseBy)
-{
-    // Test the CopyLineCloseBy() method in the LineMutations class.
-    // The method accepts a character buffer, size, and character index.
-    // If the original character buffer is UTF-8, the internal algorithm selects two random lines (source and destination), 
-    // duplicates the source at destination, shifts the contents, and copies the contents to a null-terminated character buffer.
-    // If the original character buffer is ASCII, no lines are removed and the
-    // original contents are copied to a null-terminated character buffer.
+                                                                                            {{2u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-    // The expected output data was gathered during a previous run using the default random seed.
-    // If the random seed is changed, the output data will also change and the unit tests will fail.
+                                                                                            {{3u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-    const std::map<std::pair<character_index, random_draw_index>, std::pair<const char* const, expected_buffer_size>> asciiOutput{
-                                                                                            {{0u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{1u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{2u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{3u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{4u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{5u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{6u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{7u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{8u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{9u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{10u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{11u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{12u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{13u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{14u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{15u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{16u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{17u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{18u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{19u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{20u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{21u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{22u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{23u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{24u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{25u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{26u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{27u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{28u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{29u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{30u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}}};
+                                                                                            {{4u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-    const std::map<std::pair<character_index, random_draw_index>, std::pair<const char* const, expected_buffer_size>> utf8Output{
-                                                                                            {{0u, 0u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 1u}, {u8"🤣0\n🤣1\n🤣3\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 2u}, {u8"🤣0\n🤣2\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣0\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 5u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 6u}, {u8"🤣4\0\0🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{0u, 7u}, {u8"🤣0\n🤣1\n🤣0\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 8u}, {u8"🤣3\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{0u, 9u}, {u8"🤣1\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            
-                                                                                            {{1u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-                                                                                            {{1u, 2u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{1u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣0\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{1u, 6u}, {u8"🤣1\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 7u}, {u8"🤣0\n🤣3\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{1u, 9u}, {u8"🤣0\n🤣4\0\0🤣1\n🤣2\n🤣3\n🤣4\0\0", 39}},
-
-                                                                                            {{2u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣1\n🤣4\0\0", 38}},
-                                                                                            {{2u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 2u}, {u8"🤣3\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 4u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 5u}, {u8"🤣0\n🤣1\n🤣3\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 6u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 7u}, {u8"🤣1\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{2u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-                                                                                            {{2u, 9u}, {u8"🤣4\0\0🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            
-                                                                                            {{3u, 0u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{3u, 1u}, {u8"🤣0\n🤣2\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{3u, 2u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{3u, 3u}, {u8"🤣1\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{3u, 4u}, {u8"🤣4\0\0🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{3u, 5u}, {u8"🤣0\n🤣2\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{3u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣1\n🤣4\0\0", 38}},
-                                                                                            {{3u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{3u, 8u}, {u8"🤣4\0\0🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{3u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{4u, 0u}, {u8"🤣4\0\0🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{4u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣0\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{4u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{4u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{4u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{4u, 5u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{4u, 6u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{4u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-                                                                                            {{4u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-                                                                                            {{4u, 9u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{5u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 1u}, {u8"🤣1\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 2u}, {u8"🤣0\n🤣1\n🤣0\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 3u}, {u8"🤣4\0\0🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{5u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{5u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-                                                                                            {{5u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 8u}, {u8"🤣0\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{5u, 9u}, {u8"🤣3\n🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{6u, 0u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 1u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣1\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 3u}, {u8"🤣0\n🤣4\0\0🤣1\n🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{6u, 4u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{6u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣1\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 8u}, {u8"🤣0\n🤣2\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{6u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{7u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 1u}, {u8"🤣0\n🤣3\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 2u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{7u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣1\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-                                                                                            {{7u, 6u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣1\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{7u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{8u, 0u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{8u, 1u}, {u8"🤣0\n🤣2\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{8u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣1\n🤣4\0\0", 38}},
-                                                                                            {{8u, 3u}, {u8"🤣0\n🤣2\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{8u, 4u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{8u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣1\n🤣4\0\0", 38}},
-                                                                                            {{8u, 6u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{8u, 7u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{8u, 8u}, {u8"🤣0\n🤣2\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{8u, 9u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-
-                                                                                            {{9u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{9u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{9u, 2u}, {u8"🤣0\n🤣3\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{9u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{9u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-                                                                                            {{9u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{9u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{9u, 7u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{9u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{9u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-
-                                                                                            {{10u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{10u, 2u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{10u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 4u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{10u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{10u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{10u, 9u}, {u8"🤣0\n🤣3\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{11u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{11u, 1u}, {u8"🤣0\n🤣2\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{11u, 2u}, {u8"🤣0\n🤣1\n🤣3\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{11u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{11u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣1\n🤣4\0\0", 38}},
-                                                                                            {{11u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{11u, 6u}, {u8"🤣0\n🤣3\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{11u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-                                                                                            {{11u, 8u}, {u8"🤣0\n🤣1\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{11u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{12u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{12u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{12u, 2u}, {u8"🤣0\n🤣1\n🤣3\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{12u, 3u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{12u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{12u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{12u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{12u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{12u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{12u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-
-                                                                                            {{13u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{13u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{13u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{13u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{13u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{13u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{13u, 6u}, {u8"🤣0\n🤣1\n🤣3\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{13u, 7u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{13u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{13u, 9u}, {u8"🤣0\n🤣1\n🤣3\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{14u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{14u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-                                                                                            {{14u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-                                                                                            {{14u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{14u, 4u}, {u8"🤣0\n🤣1\n🤣3\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{14u, 5u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{14u, 6u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{14u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{14u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{14u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{15u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{15u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{15u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{15u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{15u, 4u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{15u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{15u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{15u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣2\n🤣4\0\0", 38}},
-                                                                                            {{15u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{15u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{16u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{16u, 1u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{16u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{16u, 9u}, {u8"🤣0\n🤣1\n🤣3\n🤣2\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{17u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{17u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{17u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{17u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{17u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣2\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{17u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{17u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{17u, 7u}, {u8"🤣0\n🤣1\n🤣4\0\0🤣2\n🤣3\n🤣4\0\0", 39}},
-                                                                                            {{17u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{17u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{18u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{18u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{18u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{18u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{18u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{18u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{18u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{18u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{18u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{18u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{19u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{19u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{19u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{19u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{19u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{19u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{19u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{19u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{19u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{19u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{20u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{20u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{20u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{20u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{20u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{20u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{20u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{20u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{20u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{20u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-
-                                                                                            {{21u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{21u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{21u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{21u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{21u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{21u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{21u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{21u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{21u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{21u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{22u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{22u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{22u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{22u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{22u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{22u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{22u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{22u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{22u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{22u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{23u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{23u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{23u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{23u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{23u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{23u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{23u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{23u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣4\0\0🤣3\n🤣4\0\0", 39}},
-                                                                                            {{23u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-                                                                                            {{23u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣3\n🤣4\0\0", 38}},
-
-                                                                                            {{24u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{24u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{25u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{25u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{26u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{26u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{27u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{27u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{28u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{28u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{29u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{29u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-
-                                                                                            {{30u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}},
-                                                                                            {{30u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0🤣4\0\0", 39}}};
+                                                                                            {{5u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-    using namespace std::placeholders;
+                                                                                            {{6u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-    RunSubtest(
-        asciiInputBuffer_,
-        sizeof(asciiInputBuffer_),
-        asciiOutput,
-        std::bind(&LineMutations::CopyLineCloseBy, this, _1, _2, _3, _4, _5));
+                                                                                            {{7u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-    RunSubtest(
-        utf8InputBuffer_,
-        sizeof(utf8InputBuffer_),
-        utf8Output,
-        std::bind(&LineMutations::CopyLineCloseBy, this, _1, _2, _3, _4, _5));
-}
+                                                                                            {{8u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-TEST_F(LineMutationTest, TestRepeatLine)
-{
-    // Test the RepeatLine() method in the LineMutations class.
-    // The method accepts a character buffer, size, and character index.
-    // If the original character buffer is UTF-8, the internal algorithm selects a selects a random line, 
-    // duplicates it a random number of times, and copies the contents to a null-terminated character buffer.
-    // If the original character buffer is ASCII, no lines are removed and the
-    // original contents are copied to a null-terminated character buffer.
+                                                                                            {{9u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-    // The expected output data was gathered during a previous run using the default random seed.
-    // If the random seed is changed, the output data will also change and the unit tests will fail.
+                                                                                            {{10u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-    // NOTE:
-    // The RepeatLine() method is capable of duplicating the random line a variable number of times.
-    // The range is defined as [1, 2097153].
-    // Since the number of line repetitions is random and can vary greatly, it is not feasible to write a subtest which
-    // exercises the cases where the original character buffer is UTF-8.
-    // Any modifications that are made to the RepeatLine() method should therefore be tested manually
-    // in order to verify correct behavior.
-    // As of 06/29/23, the RepeatLine() method was verified to work for UTF-8 character buffers.
+                                                                                            {{11u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-    const std::map<std::pair<character_index, random_draw_index>, std::pair<const char* const, expected_buffer_size>> asciiOutput{
-                                                                                            {{0u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{0u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{1u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{1u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{2u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{2u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{3u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{3u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{4u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{4u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{5u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{5u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{6u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{6u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{7u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{7u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{8u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{8u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{9u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{9u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{10u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{10u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{11u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{11u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{12u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{12u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{13u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{13u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{14u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{14u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{15u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{15u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{16u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{16u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{17u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{17u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{18u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{18u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{19u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{19u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{20u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{20u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{21u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{21u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{22u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{22u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{23u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{23u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{24u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{24u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{25u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{25u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{26u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{26u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{27u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{27u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{28u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{28u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{29u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{29u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-
-                                                                                            {{30u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}},
-                                                                                            {{30u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0", 32}}};
+                                                                                            {{12u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-    using namespace std::placeholders;
+                                                                                            {{13u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
-    RunSubtest(
-        asciiInputBuffer_,
-        sizeof(asciiInputBuffer_),
-        asciiOutput,
-        std::bind(&LineMutations::RepeatLine, this, _1, _2, _3, _4, _5));
-}
+                                                                                            {{14u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{15u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{16u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{17u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{18u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{19u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{20u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{21u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{22u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{23u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{24u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{25u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{26u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{27u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{28u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{29u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{30u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}}};
+
+    using namespace std::placeholders;
+
+    RunSubtest(
+        asciiInputBuffer_,
+        sizeof(asciiInputBuffer_),
+        asciiOutput,
+        std::bind(&LineMutations::DuplicateLine, this, _1, _2, _3, _4, _5));
+
+    RunSubtest(
+        utf8InputBuffer_,
+        sizeof(utf8InputBuffer_),
+        utf8Output,
+        std::bind(&LineMutations::DuplicateLine, this, _1, _2, _3, _4, _5));
+}
+
+TEST_F(LineMutationTest, TestCopyLineCloseBy)
+{
+    // Test the CopyLineCloseBy() method in the LineMutations class.
+    // The method accepts a character buffer, size, and character index.
+    // If the original character buffer is ASCII, the internal algorithm selects two random lines (source and destination), 
+    // duplicates the source at destination, shifts the contents, and copies the contents to a null-terminated character buffer.
+    // If the original character buffer is UTF-8, no lines are copied and the
+    // original contents are copied to a null-terminated character buffer.
+
+    // The expected output data was gathered during a previous run using the default random seed.
+    // If the random seed is changed, the output data will also change and the unit tests will fail.
+
+    const std::map<std::pair<character_index, random_draw_index>, std::pair<const char* const, expected_buffer_size>> asciiOutput{
+                                                                                            {{0u, 0u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 1u}, {"Line0\nLine1\nLine3\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 2u}, {"Line0\nLine2\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 3u}, {"Line0\nLine1\nLine2\nLine0\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 5u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 6u}, {"Line4\0\0Line0\nLine1\nLine2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{0u, 7u}, {"Line0\nLine1\nLine0\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 8u}, {"Line3\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{0u, 9u}, {"Line1\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{1u, 0u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+                                                                                            {{1u, 2u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{1u, 3u}, {"Line0\nLine1\nLine2\nLine0\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 4u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{1u, 6u}, {"Line1\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 7u}, {"Line0\nLine3\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{1u, 9u}, {"Line0\nLine4\0\0Line1\nLine2\nLine3\nLine4\0\0", 39}},
+
+                                                                                            {{2u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine1\nLine4\0\0", 38}},
+                                                                                            {{2u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 2u}, {"Line3\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 4u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 5u}, {"Line0\nLine1\nLine3\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 6u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 7u}, {"Line1\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{2u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+                                                                                            {{2u, 9u}, {"Line4\0\0Line0\nLine1\nLine2\nLine3\nLine4\0\0", 39}},
+
+                                                                                            {{3u, 0u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{3u, 1u}, {"Line0\nLine2\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{3u, 2u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{3u, 3u}, {"Line1\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{3u, 4u}, {"Line4\0\0Line0\nLine1\nLine2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{3u, 5u}, {"Line0\nLine2\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{3u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine1\nLine4\0\0", 38}},
+                                                                                            {{3u, 7u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{3u, 8u}, {"Line4\0\0Line0\nLine1\nLine2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{3u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{4u, 0u}, {"Line4\0\0Line0\nLine1\nLine2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{4u, 1u}, {"Line0\nLine1\nLine2\nLine0\nLine3\nLine4\0\0", 38}},
+                                                                                            {{4u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{4u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{4u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{4u, 5u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{4u, 6u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{4u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+                                                                                            {{4u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+                                                                                            {{4u, 9u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{5u, 0u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 1u}, {"Line1\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 2u}, {"Line0\nLine1\nLine0\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 3u}, {"Line4\0\0Line0\nLine1\nLine2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{5u, 4u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{5u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+                                                                                            {{5u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 8u}, {"Line0\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{5u, 9u}, {"Line3\nLine0\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{6u, 0u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 1u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 2u}, {"Line0\nLine1\nLine2\nLine1\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 3u}, {"Line0\nLine4\0\0Line1\nLine2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{6u, 4u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{6u, 6u}, {"Line0\nLine1\nLine2\nLine1\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 7u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 8u}, {"Line0\nLine2\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{6u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{7u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 1u}, {"Line0\nLine3\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 2u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{7u, 3u}, {"Line0\nLine1\nLine2\nLine1\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 4u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+                                                                                            {{7u, 6u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 7u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 8u}, {"Line0\nLine1\nLine2\nLine1\nLine3\nLine4\0\0", 38}},
+                                                                                            {{7u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{8u, 0u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{8u, 1u}, {"Line0\nLine2\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{8u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine1\nLine4\0\0", 38}},
+                                                                                            {{8u, 3u}, {"Line0\nLine2\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{8u, 4u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{8u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine1\nLine4\0\0", 38}},
+                                                                                            {{8u, 6u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{8u, 7u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{8u, 8u}, {"Line0\nLine2\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{8u, 9u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+
+                                                                                            {{9u, 0u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{9u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{9u, 2u}, {"Line0\nLine3\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{9u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{9u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+                                                                                            {{9u, 5u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{9u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{9u, 7u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{9u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{9u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+
+                                                                                            {{10u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{10u, 2u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{10u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 4u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 6u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{10u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{10u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{10u, 9u}, {"Line0\nLine3\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{11u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{11u, 1u}, {"Line0\nLine2\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{11u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{11u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{11u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine1\nLine4\0\0", 38}},
+                                                                                            {{11u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{11u, 6u}, {"Line0\nLine3\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{11u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+                                                                                            {{11u, 8u}, {"Line0\nLine1\nLine1\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{11u, 9u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{12u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{12u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{12u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{12u, 3u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{12u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{12u, 5u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{12u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{12u, 7u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{12u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{12u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+
+                                                                                            {{13u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{13u, 1u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{13u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{13u, 3u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{13u, 4u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{13u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{13u, 6u}, {"Line0\nLine1\nLine3\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{13u, 7u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{13u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{13u, 9u}, {"Line0\nLine1\nLine3\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{14u, 0u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{14u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+                                                                                            {{14u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+                                                                                            {{14u, 3u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{14u, 4u}, {"Line0\nLine1\nLine3\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{14u, 5u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{14u, 6u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{14u, 7u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{14u, 8u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{14u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{15u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{15u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{15u, 2u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{15u, 3u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{15u, 4u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{15u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{15u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{15u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine2\nLine4\0\0", 38}},
+                                                                                            {{15u, 8u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{15u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{16u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{16u, 1u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{16u, 2u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 3u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 5u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 8u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{16u, 9u}, {"Line0\nLine1\nLine3\nLine2\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{17u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{17u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{17u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{17u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{17u, 4u}, {"Line0\nLine1\nLine2\nLine2\nLine3\nLine4\0\0", 38}},
+                                                                                            {{17u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{17u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{17u, 7u}, {"Line0\nLine1\nLine4\0\0Line2\nLine3\nLine4\0\0", 39}},
+                                                                                            {{17u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{17u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{18u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{18u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{18u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{18u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{18u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{18u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{18u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{18u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{18u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{18u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{19u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{19u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{19u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{19u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{19u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{19u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{19u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{19u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{19u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{19u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{20u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{20u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{20u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{20u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{20u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{20u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{20u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{20u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{20u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{20u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+
+                                                                                            {{21u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{21u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{21u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{21u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{21u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{21u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{21u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{21u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{21u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{21u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{22u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{22u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{22u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{22u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{22u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{22u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{22u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{22u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{22u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{22u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{23u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{23u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{23u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{23u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{23u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{23u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{23u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{23u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\nLine4\0\0", 39}},
+                                                                                            {{23u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+                                                                                            {{23u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine3\nLine4\0\0", 38}},
+
+                                                                                            {{24u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{24u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{25u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{25u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{26u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{26u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{27u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{27u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{28u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{28u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{29u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{29u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+
+                                                                                            {{30u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}},
+                                                                                            {{30u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0Line4\0\0", 39}}};
+
+    const std::map<std::pair<character_index, random_draw_index>, std::pair<const char* const, expected_buffer_size>> utf8Output{
+                                                                                            {{0u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{1u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{2u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{3u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{4u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{5u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{6u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{7u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{8u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{9u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{10u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{11u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{12u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{13u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{14u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{15u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{16u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{17u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{18u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{19u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{20u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{21u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{22u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{23u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{24u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{25u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{26u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{27u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{28u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{29u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{30u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}}};
+
+    using namespace std::placeholders;
+
+    RunSubtest(
+        asciiInputBuffer_,
+        sizeof(asciiInputBuffer_),
+        asciiOutput,
+        std::bind(&LineMutations::CopyLineCloseBy, this, _1, _2, _3, _4, _5));
+
+    RunSubtest(
+        utf8InputBuffer_,
+        sizeof(utf8InputBuffer_),
+        utf8Output,
+        std::bind(&LineMutations::CopyLineCloseBy, this, _1, _2, _3, _4, _5));
+}
+
+TEST_F(LineMutationTest, TestCopyLineCloseByAfterTrailingNewline)
+{
+    // A line copied to the empty line after a trailing newline is appended to the end,
+    // so the lines in front of the character index are never moved.
+
+    const std::string input{"Head\nBody\n"};
+    constexpr size_t characterIndex{5u};
+
+    using namespace std::placeholders;
+
+    for (size_t it{0u}; it < 100u; ++it)
+    {
+        std::tuple<int, std::unique_ptr<SimpleStorage>, unsigned long> testCaseStorageTuple{
+                                                                                        RunLineMutationCallback(
+                                                                                                            input.data(),
+                                                                                                            input.size(),
+                                                                                                            characterIndex,
+                                                                                                            std::bind(&LineMutations::CopyLineCloseBy, this, _1, _2, _3, _4, _5))};
+
+        const int testCaseKey{std::get<0u>(testCaseStorageTuple)};
+        const unsigned long entryId{std::get<2u>(testCaseStorageTuple)};
+        StorageEntry* storageEntryPtr{std::get<1u>(testCaseStorageTuple)->getEntryByID(entryId)};
+
+        const std::string output{storageEntryPtr->getBufferPointer(testCaseKey), static_cast<size_t>(storageEntryPtr->getBufferSize(testCaseKey))};
+
+        ASSERT_EQ(output.back(), '\0');
+        ASSERT_EQ(output.substr(0u, characterIndex), input.substr(0u, characterIndex));
+        ASSERT_EQ(output.find('\0'), output.size() - 1u);
+    }
+}
+
+TEST_F(LineMutationTest, TestRepeatLine)
+{
+    // Test the RepeatLine() method in the LineMutations class.
+    // The method accepts a character buffer, size, and character index.
+    // If the original character buffer is ASCII, the internal algorithm selects a selects a random line, 
+    // duplicates it a random number of times, and copies the contents to a null-terminated character buffer.
+    // If the original character buffer is UTF-8, no lines are repeated and the
+    // original contents are copied to a null-terminated character buffer.
+
+    // The expected output data was gathered during a previous run using the default random seed.
+    // If the random seed is changed, the output data will also change and the unit tests will fail.
+
+    // NOTE:
+    // The RepeatLine() method is capable of duplicating the random line a variable number of times.
+    // The range is defined as [1, 2097153].
+    // Since the number of line repetitions is random and can vary greatly, the outputs for the ASCII character buffer
+    // are not listed; instead, each output is checked to be the original buffer with one of its lines repeated.
+
+    const std::map<std::pair<character_index, random_draw_index>, std::pair<const char* const, expected_buffer_size>> utf8Output{
+                                                                                            {{0u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{0u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{1u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{1u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{2u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{2u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{3u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{3u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{4u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{4u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{5u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{5u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{6u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{6u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{7u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{7u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{8u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{8u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{9u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{9u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{10u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{10u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{11u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{11u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{12u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{12u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{13u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{13u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{14u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{14u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{15u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{15u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{16u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{16u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{17u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{17u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{18u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{18u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{19u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{19u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{20u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{20u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{21u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{21u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{22u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{22u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{23u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{23u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{24u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{24u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{25u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{25u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{26u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{26u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{27u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{27u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{28u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{28u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{29u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{29u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
+                                                                                            {{30u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+                                                                                            {{30u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}}};
+
+    using namespace std::placeholders;
+
+    const Line_Mutation_Callback repeatLine{std::bind(&LineMutations::RepeatLine, this, _1, _2, _3, _4, _5)};
+
+    const std::string input{asciiInputBuffer_, sizeof(asciiInputBuffer_)};
+
+    std::vector<std::string> lines;
+
+    for (size_t lineStart{0u}; lineStart < input.size(); lineStart += lines.back().size())
+    {
+        const size_t lineEnd{input.find('\n', lineStart)};
+
+        lines.push_back(input.substr(lineStart, (lineEnd == std::string::npos) ? std::string::npos : lineEnd - lineStart + 1u));
+    }
+
+    for (const auto& characterIndex : characterIndices_)
+    {
+        constexpr size_t numberOfRandomDraws{10u};
+
+        for (size_t randomDrawIndex{0u}; randomDrawIndex < numberOfRandomDraws; ++randomDrawIndex)
+        {
+            std::tuple<int, std::unique_ptr<SimpleStorage>, unsigned long> testCaseStorageTuple{
+                                                                                            RunLineMutationCallback(
+                                                                                                            asciiInputBuffer_,
+                                                                                                            sizeof(asciiInputBuffer_),
+                                                                                                            characterIndex,
+                                                                                                            repeatLine)};
+
+            const int testCaseKey{std::get<0u>(testCaseStorageTuple)};
+            const unsigned long entryId{std::get<2u>(testCaseStorageTuple)};
+            StorageEntry* storageEntryPtr{std::get<1u>(testCaseStorageTuple)->getEntryByID(entryId)};
+
+            const int outputBufferSize{storageEntryPtr->getBufferSize(testCaseKey)};
+            const char* const outputBuffer{storageEntryPtr->getBufferPointer(testCaseKey)};
+
+            ASSERT_GT(outputBufferSize, static_cast<int>(input.size() + 1u));
+            ASSERT_EQ(outputBuffer[outputBufferSize - 1u], 0u);
+
+            // The output must be the input with one of its lines repeated back to back.
+
+            const std::string output{outputBuffer, static_cast<size_t>(outputBufferSize - 1)};
+
+            bool isRepeatedLine{false};
+
+            for (size_t lineIndex{0u}, lineStart{0u}; lineIndex < lines.size() && !isRepeatedLine; lineStart += lines[lineIndex].size(), ++lineIndex)
+            {
+                const std::string& line{lines[lineIndex]};
+                const size_t addedSize{output.size() - input.size()};
+
+                if (addedSize % line.size() != 0u)
+                    continue;
+
+                std::string expectedOutput{input.substr(0u, lineStart)};
+
+                for (size_t it{0u}; it <= addedSize / line.size(); ++it)
+                    expectedOutput += line;
+
+                expectedOutput += input.substr(lineStart + line.size());
+
+                isRepeatedLine = (output == expectedOutput);
+            }
+
+            ASSERT_TRUE(isRepeatedLine);
+        }
+    }
+
+    RunSubtest(
+        utf8InputBuffer_,
+        sizeof(utf8InputBuffer_),
+        utf8Output,
+        repeatLine);
+}
 
 TEST_F(LineMutationTest, TestSwapLine)
 {
@@ -3618,130 +3841,130 @@ TEST_F(LineMutationTest, TestSwapLine)
                                                                                             {{0u, 0u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
                                                                                             {{0u, 1u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
                                                                                             {{0u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{0u, 3u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{0u, 3u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{0u, 4u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{0u, 5u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
+                                                                                            {{0u, 5u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
                                                                                             {{0u, 6u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{0u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{0u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{0u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{0u, 7u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{0u, 8u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{0u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
 
                                                                                             {{1u, 0u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{1u, 1u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{1u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{1u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{1u, 3u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
                                                                                             {{1u, 4u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
                                                                                             {{1u, 5u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{1u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{1u, 6u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{1u, 7u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
                                                                                             {{1u, 8u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{1u, 9u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
 
-                                                                                            {{2u, 0u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{2u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{2u, 0u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
+                                                                                            {{2u, 1u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{2u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{2u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{2u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{2u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{2u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{2u, 5u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{2u, 6u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{2u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{2u, 8u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{2u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{2u, 7u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{2u, 8u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
+                                                                                            {{2u, 9u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
 
-                                                                                            {{3u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{3u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{3u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{3u, 2u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{3u, 3u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{3u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{3u, 4u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{3u, 5u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
-                                                                                            {{3u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{3u, 6u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{3u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{3u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{3u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{3u, 9u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
 
-                                                                                            {{4u, 0u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
-                                                                                            {{4u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{4u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{4u, 0u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{4u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{4u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{4u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{4u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{4u, 4u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{4u, 5u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{4u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{4u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{4u, 6u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{4u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{4u, 8u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
-                                                                                            {{4u, 9u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{4u, 9u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
 
                                                                                             {{5u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{5u, 1u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{5u, 2u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
+                                                                                            {{5u, 1u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
+                                                                                            {{5u, 2u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
                                                                                             {{5u, 3u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{5u, 4u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{5u, 5u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{5u, 6u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{5u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{5u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{5u, 6u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
+                                                                                            {{5u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{5u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{5u, 9u}, {"Line1\nLine0\nLine2\nLine3\nLine4\0\0", 32}},
 
-                                                                                            {{6u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{6u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{6u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{6u, 3u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{6u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{6u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{6u, 1u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{6u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{6u, 3u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
+                                                                                            {{6u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{6u, 5u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{6u, 6u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{6u, 6u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{6u, 7u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
-                                                                                            {{6u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{6u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{6u, 9u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
 
-                                                                                            {{7u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{7u, 0u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{7u, 1u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{7u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{7u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{7u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{7u, 2u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
+                                                                                            {{7u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{7u, 4u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{7u, 5u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{7u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{7u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{7u, 7u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
-                                                                                            {{7u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{7u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{7u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{7u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
 
-                                                                                            {{8u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{8u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{8u, 1u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{8u, 2u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{8u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{8u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{8u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{8u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{8u, 5u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{8u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{8u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{8u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{8u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{8u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{8u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
 
                                                                                             {{9u, 0u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
-                                                                                            {{9u, 1u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{9u, 1u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{9u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{9u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{9u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{9u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{9u, 3u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{9u, 4u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{9u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{9u, 6u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{9u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{9u, 8u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{9u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{9u, 8u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{9u, 9u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
 
-                                                                                            {{10u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{10u, 0u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{10u, 1u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{10u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{10u, 2u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{10u, 3u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{10u, 4u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
-                                                                                            {{10u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{10u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{10u, 5u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{10u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{10u, 7u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
-                                                                                            {{10u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{10u, 8u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{10u, 9u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
 
-                                                                                            {{11u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{11u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{11u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{11u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{11u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{11u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{11u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{11u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{11u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{11u, 4u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{11u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{11u, 6u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{11u, 7u}, {"Line0\nLine2\nLine1\nLine3\nLine4\0\0", 32}},
                                                                                             {{11u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
@@ -3750,38 +3973,38 @@ TEST_F(LineMutationTest, TestSwapLine)
                                                                                             {{12u, 0u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{12u, 1u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{12u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{12u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{12u, 3u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{12u, 4u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{12u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{12u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{12u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{12u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{12u, 7u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{12u, 8u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{12u, 9u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
 
-                                                                                            {{13u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{13u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{13u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{13u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{13u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{13u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{13u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{13u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{13u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{13u, 4u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{13u, 5u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{13u, 6u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{13u, 7u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{13u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{13u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{13u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
 
                                                                                             {{14u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{14u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{14u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{14u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{14u, 3u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{14u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{14u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{14u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{14u, 5u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{14u, 6u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{14u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{14u, 8u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{14u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{14u, 9u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
 
-                                                                                            {{15u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{15u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{15u, 0u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{15u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{15u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{15u, 3u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{15u, 4u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
@@ -3789,95 +4012,95 @@ TEST_F(LineMutationTest, TestSwapLine)
                                                                                             {{15u, 6u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{15u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{15u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{15u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{15u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
 
                                                                                             {{16u, 0u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{16u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{16u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{16u, 1u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
+                                                                                            {{16u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{16u, 3u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{16u, 4u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{16u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{16u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{16u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{16u, 6u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{16u, 7u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{16u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{16u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{16u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{16u, 9u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
 
                                                                                             {{17u, 0u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{17u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{17u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{17u, 2u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{17u, 3u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{17u, 4u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{17u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{17u, 5u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{17u, 6u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
                                                                                             {{17u, 7u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
-                                                                                            {{17u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{17u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{17u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{17u, 9u}, {"Line0\nLine1\nLine3\nLine2\nLine4\0\0", 32}},
 
                                                                                             {{18u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{18u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{18u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{18u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{18u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{18u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{18u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{18u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{18u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{18u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{18u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{18u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{18u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{18u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{18u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{18u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
 
                                                                                             {{19u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{19u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{19u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{19u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{19u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{19u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{19u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{19u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{19u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{19u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{19u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{19u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{19u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{19u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{19u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{19u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{19u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
 
-                                                                                            {{20u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{20u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{20u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{20u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{20u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{20u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{20u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{20u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{20u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{20u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{20u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{20u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{20u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{20u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{20u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{20u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{20u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
 
-                                                                                            {{21u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{21u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{21u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{21u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{21u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{21u, 3u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{21u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{21u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{21u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{21u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{21u, 8u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{21u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{21u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{21u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{21u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{21u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{21u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{21u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
 
-                                                                                            {{22u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{22u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{22u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{22u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{22u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{22u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{22u, 4u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{22u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{22u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{22u, 6u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{22u, 7u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{22u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{22u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{22u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{22u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{22u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
 
-                                                                                            {{23u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{23u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
-                                                                                            {{23u, 2u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{23u, 0u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{23u, 1u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
+                                                                                            {{23u, 2u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{23u, 3u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{23u, 4u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{23u, 5u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{23u, 5u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{23u, 6u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{23u, 7u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
                                                                                             {{23u, 8u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
-                                                                                            {{23u, 9u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
+                                                                                            {{23u, 9u}, {"Line0\nLine1\nLine2\nLine4\0\0Line3\n", 32}},
 
                                                                                             {{24u, 0u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
                                                                                             {{24u, 1u}, {"Line0\nLine1\nLine2\nLine3\nLine4\0\0", 32}},
@@ -3967,7 +4190,7 @@ TEST_F(LineMutationTest, TestSwapLine)
                                                                                             {{0u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{0u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{0u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
-                                                                                            
+
                                                                                             {{1u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{1u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{1u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
@@ -3989,7 +4212,7 @@ TEST_F(LineMutationTest, TestSwapLine)
                                                                                             {{2u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{2u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{2u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
-                                                                                            
+
                                                                                             {{3u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{3u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{3u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
@@ -4054,8 +4277,8 @@ TEST_F(LineMutationTest, TestSwapLine)
                                                                                             {{8u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{8u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{8u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
-                                                                                            {{8u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},                                                                                            
-                                                                                            
+                                                                                            {{8u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
+
                                                                                             {{9u, 0u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{9u, 1u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{9u, 2u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
@@ -4063,7 +4286,7 @@ TEST_F(LineMutationTest, TestSwapLine)
                                                                                             {{9u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{9u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{9u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
-                                                                                            {{9u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},  
+                                                                                            {{9u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{9u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{9u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
 
@@ -4073,7 +4296,7 @@ TEST_F(LineMutationTest, TestSwapLine)
                                                                                             {{10u, 3u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{10u, 4u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{10u, 5u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
-                                                                                            {{10u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},  
+                                                                                            {{10u, 6u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{10u, 7u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{10u, 8u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
                                                                                             {{10u, 9u}, {u8"🤣0\n🤣1\n🤣2\n🤣3\n🤣4\0\0", 32}},
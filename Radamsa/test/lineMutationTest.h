@@ -37,7 +37,11 @@
 // C/C++ Includes
 #include <tuple>
 #include <map>
+#include <memory>
+#include <set>
 #include <functional>
+#include <string>
+#include <vector>
 
 // Google Test Includes
 #include "gtest/gtest.h"
@@ -0,0 +1,173 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "markupMutationTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(MarkupMutationTest, TestBuildMarkupTree)
+{
+    // Processing instructions, comments, void and self-closing tags are leaves; comments hide the brackets inside them.
+
+    const std::string input{markupInput_, sizeof(markupInput_) - 1u};
+    const MarkupTree tree{BuildMarkupTree(input.data(), input.size())};
+
+    auto expectElement{
+                [&](const size_t elementIndex, const std::string& text, const size_t depth)
+                {
+                    ASSERT_LT(elementIndex, tree.Elements.size());
+
+                    const Element& element{tree.Elements[elementIndex]};
+
+                    EXPECT_EQ(input.substr(element.StartIndex, element.EndIndex - element.StartIndex), text);
+                    EXPECT_EQ(element.Depth, depth);
+                }};
+
+    ASSERT_EQ(tree.Elements.size(), 6u);
+
+    expectElement(0u, "<?xml version=\"1.0\"?>", 0u);
+    expectElement(1u, "<a x=\"1\"><b>text<br></b><!-- <c> --><c/></a>", 0u);
+    expectElement(2u, "<b>text<br></b>", 1u);
+    expectElement(3u, "<br>", 2u);
+    expectElement(4u, "<!-- <c> -->", 1u);
+    expectElement(5u, "<c/>", 1u);
+
+    // The tags must be found at every alignment of the block scan.
+
+    for (size_t padding : {1u, 60u, 63u, 64u, 127u})
+    {
+        const std::string paddedInput{std::string(padding, ' ') + input};
+        const MarkupTree paddedTree{BuildMarkupTree(paddedInput.data(), paddedInput.size())};
+
+        ASSERT_EQ(paddedTree.Elements.size(), tree.Elements.size());
+
+        for (size_t it{0u}; it < tree.Elements.size(); ++it)
+        {
+            ASSERT_EQ(paddedTree.Elements[it].StartIndex, tree.Elements[it].StartIndex + padding);
+            ASSERT_EQ(paddedTree.Elements[it].EndIndex, tree.Elements[it].EndIndex + padding);
+        }
+    }
+
+    EXPECT_TRUE(BuildMarkupTree("no markup", 9u).Elements.empty());
+    EXPECT_TRUE(BuildMarkupTree("<unterminated", 13u).Elements.empty());
+}
+
+TEST_F(MarkupMutationTest, TestElementMutations)
+{
+    const std::string input{markupInput_, sizeof(markupInput_) - 1u};
+    const MarkupTree tree{BuildMarkupTree(input.data(), input.size())};
+
+    for (size_t it{0u}; it < 100u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        DuplicateElement(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string duplicated{GetOutput(newEntry)};
+        const size_t addedSize{duplicated.size() - input.size()};
+
+        ASSERT_GT(duplicated.size(), input.size());
+
+        // Removing one copy of an element must restore the original buffer.
+
+        bool isRestorable{false};
+
+        for (const Element& element : tree.Elements)
+            if (element.EndIndex - element.StartIndex == addedSize &&
+                duplicated.compare(0u, element.EndIndex, input, 0u, element.EndIndex) == 0 &&
+                duplicated.compare(element.EndIndex + addedSize, std::string::npos, input, element.EndIndex, std::string::npos) == 0)
+                isRestorable = true;
+
+        ASSERT_TRUE(isRestorable) << duplicated;
+
+        newEntry = storage_->createNewEntry();
+
+        DeleteElement(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string deleted{GetOutput(newEntry)};
+
+        ASSERT_LT(deleted.size(), input.size());
+
+        size_t prefixSize{0u};
+
+        while (prefixSize < deleted.size() && input[prefixSize] == deleted[prefixSize])
+            ++prefixSize;
+
+        ASSERT_EQ(deleted.compare(prefixSize, std::string::npos, input, prefixSize + input.size() - deleted.size(), std::string::npos), 0);
+
+        newEntry = storage_->createNewEntry();
+
+        SwapElements(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        std::string swapped{GetOutput(newEntry)};
+
+        ASSERT_EQ(swapped.size(), input.size());
+
+        std::sort(swapped.begin(), swapped.end());
+        std::string sortedInput{input};
+        std::sort(sortedInput.begin(), sortedInput.end());
+
+        ASSERT_EQ(swapped, sortedInput);
+
+        newEntry = storage_->createNewEntry();
+
+        NestElement(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string nested{GetOutput(newEntry)};
+
+        // The output must be some element replacing one of its descendants, or nested right after its opening tag.
+
+        bool isNesting{false};
+
+        for (size_t outerIndex{0u}; outerIndex < tree.Elements.size(); ++outerIndex)
+        {
+            const Element& outer{tree.Elements[outerIndex]};
+            const std::string outerText{input.substr(outer.StartIndex, outer.EndIndex - outer.StartIndex)};
+            const size_t openingTagEnd{input.find('>', outer.StartIndex) + 1u};
+
+            isNesting |= (nested == input.substr(0u, openingTagEnd) + outerText + input.substr(openingTagEnd));
+
+            for (size_t innerIndex{outerIndex + 1u}; innerIndex < tree.Elements.size() && tree.Elements[innerIndex].StartIndex < outer.EndIndex; ++innerIndex)
+            {
+                const Element& inner{tree.Elements[innerIndex]};
+
+                isNesting |= (nested == input.substr(0u, inner.StartIndex) + outerText + input.substr(inner.EndIndex));
+            }
+        }
+
+        ASSERT_TRUE(isNesting) << nested;
+    }
+
+    // Elements before the minimum seed index are never picked; the tail holds none, so the output is unchanged.
+
+    const size_t tailIndex{input.rfind('>') + 1u};
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    DeleteElement(newEntry, input.size(), input.data(), 1u, tailIndex, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), input);
+
+    EXPECT_THROW(DeleteElement(newEntry, 0u, input.data(), 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(DeleteElement(newEntry, input.size(), nullptr, 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(DeleteElement(newEntry, input.size(), input.data(), 1u, input.size(), testCaseKey_), RuntimeException);
+}
+}
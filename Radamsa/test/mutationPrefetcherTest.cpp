@@ -0,0 +1,90 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "mutationPrefetcherTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST(MutationPrefetcherTest, TestTryPop)
+{
+    using ::vmf::radamsa::mutations::MutationPrefetcher;
+
+    auto createProducer{
+                    [](const size_t workerIndex) -> MutationPrefetcher::Producer
+                    {
+                        return [workerIndex](const unsigned long seedId, const std::string& seed, std::string& output)
+                               {
+                                   output = std::to_string(seedId) + ":" + seed + ":" + std::to_string(workerIndex);
+                               };
+                    }};
+
+    ASSERT_THROW(MutationPrefetcher(0u, 4u, createProducer), RuntimeException);
+
+    MutationPrefetcher prefetcher{2u, 4u, createProducer};
+
+    ASSERT_EQ(prefetcher.GetNumberOfWorkers(), 2u);
+
+    std::string output;
+
+    ASSERT_FALSE(prefetcher.HasSeed(1u));
+    ASSERT_FALSE(prefetcher.TryPop(output));
+
+    // Only outputs of the current seed are popped, from both workers.
+
+    auto popOutputs{
+                [&](const size_t numberOfOutputs)
+                {
+                    std::vector<std::string> outputs;
+
+                    while (outputs.size() < numberOfOutputs)
+                    {
+                        if (prefetcher.TryPop(output))
+                            outputs.push_back(output);
+                        else
+                            std::this_thread::yield();
+                    }
+
+                    return outputs;
+                }};
+
+    prefetcher.SetSeed(1u, "abc", 3u);
+
+    ASSERT_TRUE(prefetcher.HasSeed(1u));
+
+    const std::vector<std::string> firstOutputs{popOutputs(100u)};
+
+    prefetcher.SetSeed(2u, "xy", 2u);
+
+    ASSERT_FALSE(prefetcher.HasSeed(1u));
+    ASSERT_TRUE(prefetcher.HasSeed(2u));
+
+    const std::vector<std::string> secondOutputs{popOutputs(100u)};
+
+    for (const std::string& it : firstOutputs)
+        ASSERT_TRUE(it == "1:abc:0" || it == "1:abc:1");
+
+    for (const std::string& it : secondOutputs)
+        ASSERT_TRUE(it == "2:xy:0" || it == "2:xy:1");
+
+    ASSERT_NE(std::find(secondOutputs.begin(), secondOutputs.end(), "2:xy:0"), secondOutputs.end());
+    ASSERT_NE(std::find(secondOutputs.begin(), secondOutputs.end(), "2:xy:1"), secondOutputs.end());
+}
+}
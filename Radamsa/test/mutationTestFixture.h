@@ -0,0 +1,87 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+#pragma once
+
+#ifndef GTEST_DECORATOR
+#define GTEST_DECORATOR std::cout << "\033[32m[          ] \033[37m[ INFO ] "
+#endif
+
+// C/C++ Includes
+#include <memory>
+#include <random>
+#include <string>
+
+// Google Test Includes
+#include "gtest/gtest.h"
+
+// VMF Includes
+#include "SimpleStorage.hpp"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+/**
+ * @brief Fixture for the tests of a mutation mixin: a storage module with a "TEST_CASE" buffer key, and the
+ * mixin itself constructed over a default random number generator.
+ */
+template<typename Mutations>
+class MutationTestFixture : public ::testing::Test,
+                            public Mutations
+{
+public:
+    virtual ~MutationTestFixture() = default;
+
+    MutationTestFixture() : Mutations{randomNumberGenerator_}
+    {
+        std::unique_ptr<vmf::StorageRegistry> registry{
+                                            std::make_unique<vmf::StorageRegistry>(
+                                                                        "TEST_INT",
+                                                                        vmf::StorageRegistry::INT,
+                                                                        vmf::StorageRegistry::ASCENDING)};
+        std::unique_ptr<vmf::StorageRegistry> metadata{std::make_unique<vmf::StorageRegistry>()};
+
+        testCaseKey_ = registry->registerKey(
+                                        "TEST_CASE",
+                                        vmf::StorageRegistry::BUFFER,
+                                        vmf::StorageRegistry::READ_WRITE);
+
+        storage_->configure(registry.get(), metadata.get());
+    }
+
+protected:
+    std::string GetOutput(vmf::StorageEntry* entry) const
+    {
+        const int size{entry->getBufferSize(testCaseKey_)};
+
+        EXPECT_GT(size, 0);
+        EXPECT_EQ(entry->getBufferPointer(testCaseKey_)[size - 1], '\0');
+
+        // Drop the null-terminator appended by every mutation.
+
+        return std::string{entry->getBufferPointer(testCaseKey_), static_cast<size_t>(size - 1)};
+    }
+
+    std::unique_ptr<vmf::SimpleStorage> storage_{std::make_unique<vmf::SimpleStorage>("storage")};
+    int testCaseKey_{0};
+
+private:
+    std::default_random_engine randomNumberGenerator_;
+};
+}
@@ -0,0 +1,76 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "offsetBitmapTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST(OffsetBitmapTest, TestSelect)
+{
+    // Offsets 1, 64, 65 and 130 are allowed; the bits past the size are ignored.
+
+    const ::vmf::radamsa::mutations::OffsetBitmap offsetBitmap{{0x02u, 0x03u, 0xf4u}, 131u};
+
+    ASSERT_EQ(offsetBitmap.GetSize(), 131u);
+    ASSERT_EQ(offsetBitmap.GetNumberOfOffsets(), 4u);
+    ASSERT_EQ(offsetBitmap.GetFirstOffset(), 1u);
+
+    const std::vector<size_t> allowedOffsets{1u, 64u, 65u, 130u};
+
+    for (size_t it{0u}; it < allowedOffsets.size(); ++it)
+    {
+        ASSERT_EQ(offsetBitmap.Select(it), allowedOffsets[it]);
+        ASSERT_EQ(offsetBitmap.Rank(allowedOffsets[it]), it);
+    }
+
+    for (size_t it{0u}; it < 200u; ++it)
+        ASSERT_EQ(offsetBitmap.IsAllowed(it), std::find(allowedOffsets.begin(), allowedOffsets.end(), it) != allowedOffsets.end());
+
+    ASSERT_EQ(offsetBitmap.Rank(200u), 4u);
+
+    // Every allowed offset is equally likely.
+
+    constexpr size_t numberOfSamples{40000u};
+
+    std::default_random_engine randomNumberGenerator;
+    std::vector<size_t> counts(131u, 0u);
+
+    for (size_t it{0u}; it < numberOfSamples; ++it)
+        ++counts[offsetBitmap.Sample(randomNumberGenerator)];
+
+    for (const size_t offset : allowedOffsets)
+        ASSERT_NEAR(static_cast<double>(counts[offset]) / numberOfSamples, 0.25, 0.01);
+
+    // A dense bitmap selects every rank in order.
+
+    const ::vmf::radamsa::mutations::OffsetBitmap denseBitmap{std::vector<uint64_t>(4u, ~uint64_t{0u}), 200u};
+
+    ASSERT_EQ(denseBitmap.GetNumberOfOffsets(), 200u);
+
+    for (size_t it{0u}; it < 200u; ++it)
+        ASSERT_EQ(denseBitmap.Select(it), it);
+
+    const ::vmf::radamsa::mutations::OffsetBitmap emptyBitmap{{}, 10u};
+
+    ASSERT_TRUE(emptyBitmap.IsEmpty());
+    ASSERT_THROW(emptyBitmap.Sample(randomNumberGenerator), RuntimeException);
+}
+}
@@ -0,0 +1,71 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "offsetSamplerTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST(OffsetSamplerTest, TestSample)
+{
+    // Overlapping, unsorted and out of bounds protected ranges leave the offsets 2, 3, 7 and 9 allowed.
+
+    const ::vmf::radamsa::mutations::OffsetSampler offsetSampler{10u, {{4u, 7u}, {0u, 2u}, {8u, 9u}, {5u, 7u}, {12u, 20u}}};
+
+    ASSERT_EQ(offsetSampler.GetNumberOfOffsets(), 4u);
+    ASSERT_EQ(offsetSampler.GetFirstOffset(), 2u);
+
+    const std::vector<size_t> allowedOffsets{2u, 3u, 7u, 9u};
+
+    for (size_t it{0u}; it < 12u; ++it)
+        ASSERT_EQ(offsetSampler.IsAllowed(it), std::find(allowedOffsets.begin(), allowedOffsets.end(), it) != allowedOffsets.end());
+
+    // Every allowed offset is equally likely.
+
+    constexpr size_t numberOfSamples{40000u};
+
+    std::default_random_engine randomNumberGenerator;
+    std::vector<size_t> counts(10u, 0u);
+
+    for (size_t it{0u}; it < numberOfSamples; ++it)
+        ++counts[offsetSampler.Sample(randomNumberGenerator)];
+
+    for (size_t it{0u}; it < counts.size(); ++it)
+    {
+        if (offsetSampler.IsAllowed(it))
+            ASSERT_NEAR(static_cast<double>(counts[it]) / numberOfSamples, 0.25, 0.01);
+        else
+            ASSERT_EQ(counts[it], 0u);
+    }
+
+    // Without protected ranges every offset is allowed, and with everything protected the sampler is empty.
+
+    const ::vmf::radamsa::mutations::OffsetSampler unprotectedSampler{5u, {}};
+
+    ASSERT_EQ(unprotectedSampler.GetNumberOfOffsets(), 5u);
+    ASSERT_EQ(unprotectedSampler.GetFirstOffset(), 0u);
+
+    const ::vmf::radamsa::mutations::OffsetSampler protectedSampler{5u, {{0u, 3u}, {2u, 5u}}};
+
+    ASSERT_TRUE(protectedSampler.IsEmpty());
+    ASSERT_FALSE(protectedSampler.IsAllowed(0u));
+    ASSERT_THROW(protectedSampler.Sample(randomNumberGenerator), RuntimeException);
+}
+}
@@ -0,0 +1,227 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "patternMutationTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(PatternMutationTest, TestPieceTable)
+{
+    // Apply the same random edits to a piece table and to a string, and compare the contents after every edit.
+
+    const std::string input{"0123456789abcdefghijklmnopqrstuvwxyz"};
+
+    std::default_random_engine generator;
+    std::string expected{input};
+
+    ::vmf::radamsa::mutations::PieceTable pieceTable{input.data(), input.size()};
+
+    for (size_t it{0u}; it < 500u && !expected.empty(); ++it)
+    {
+        const size_t index{std::uniform_int_distribution<size_t>(0u, expected.size() - 1u)(generator)};
+
+        switch (std::uniform_int_distribution<int>(0, 3)(generator))
+        {
+        case 0:
+            pieceTable.InsertBytes(index, "XY", 2u);
+            expected.insert(index, "XY");
+
+            break;
+        case 1:
+            pieceTable.InsertRepeatedByte(index + 1u, 'Z', 3u);
+            expected.insert(index + 1u, 3u, 'Z');
+
+            break;
+        case 2:
+        {
+            const size_t size{std::min<size_t>(3u, expected.size() - index)};
+
+            pieceTable.EraseBytes(index, size);
+            expected.erase(index, size);
+
+            break;
+        }
+        default:
+            pieceTable.ReplaceByte(index, '#');
+            expected[index] = '#';
+
+            break;
+        }
+
+        ASSERT_EQ(pieceTable.GetSize(), expected.size());
+
+        for (size_t byteIndex{0u}; byteIndex < expected.size(); ++byteIndex)
+            ASSERT_EQ(pieceTable.GetByte(byteIndex), expected[byteIndex]);
+    }
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    pieceTable.Write(newEntry, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), expected);
+
+    // The pieces hold the content in order.
+
+    std::string visitedContent;
+
+    pieceTable.ForEachPiece([&](const char* data, const size_t size) { visitedContent.append(data, size); });
+
+    EXPECT_EQ(visitedContent, expected);
+
+    // The original buffer is never modified.
+
+    EXPECT_EQ(input, "0123456789abcdefghijklmnopqrstuvwxyz");
+
+    EXPECT_THROW(pieceTable.GetByte(expected.size()), RuntimeException);
+    EXPECT_THROW(pieceTable.EraseBytes(expected.size(), 1u), RuntimeException);
+    EXPECT_THROW(pieceTable.InsertBytes(expected.size() + 1u, "X", 1u), RuntimeException);
+}
+
+TEST_F(PatternMutationTest, TestApplyPattern)
+{
+    const std::string input(256u, '\x40');
+
+    auto getChangedIndices{
+                    [&](const std::string& output)
+                    {
+                        std::vector<size_t> changedIndices;
+
+                        for (size_t it{0u}; it < output.size(); ++it)
+                            if (output[it] != input[it])
+                                changedIndices.push_back(it);
+
+                        return changedIndices;
+                    }};
+
+    size_t maximumNumberOfChanges{0u};
+
+    for (size_t it{0u}; it < 200u; ++it)
+    {
+        // Once applies exactly one edit.
+
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        ApplyPattern(newEntry, input.size(), input.data(), 0u, testCaseKey_, PatternType::Once, ByteEditType::IncrementByte);
+
+        const std::string once{GetOutput(newEntry)};
+
+        ASSERT_EQ(once.size(), input.size());
+        ASSERT_EQ(getChangedIndices(once).size(), 1u);
+
+        // Many stacks edits anywhere after the minimum seed index.
+
+        constexpr size_t minimumSeedIndex{100u};
+
+        newEntry = storage_->createNewEntry();
+
+        ApplyPattern(newEntry, input.size(), input.data(), minimumSeedIndex, testCaseKey_, PatternType::Many, ByteEditType::RandomizeByte);
+
+        const std::vector<size_t> manyChanges{getChangedIndices(GetOutput(newEntry))};
+
+        ASSERT_LE(manyChanges.size(), PatternMutations::MAXIMUM_NUMBER_OF_EDITS);
+
+        if (!manyChanges.empty())
+        {
+            ASSERT_GE(manyChanges.front(), minimumSeedIndex);
+        }
+
+        maximumNumberOfChanges = std::max(maximumNumberOfChanges, manyChanges.size());
+
+        // Burst stacks edits within one window.
+
+        newEntry = storage_->createNewEntry();
+
+        ApplyPattern(newEntry, input.size(), input.data(), 0u, testCaseKey_, PatternType::Burst, ByteEditType::FlipByte);
+
+        const std::vector<size_t> burstChanges{getChangedIndices(GetOutput(newEntry))};
+
+        if (!burstChanges.empty())
+        {
+            ASSERT_LT(burstChanges.back() - burstChanges.front(), PatternMutations::BURST_WINDOW_SIZE);
+        }
+
+        // Size changing edits are stacked too.
+
+        newEntry = storage_->createNewEntry();
+
+        ApplyPattern(newEntry, input.size(), input.data(), 0u, testCaseKey_, PatternType::Burst, ByteEditType::DropByte);
+
+        const std::string dropped{GetOutput(newEntry)};
+
+        ASSERT_LE(dropped.size(), input.size() - 2u);
+        ASSERT_EQ(dropped, std::string(dropped.size(), '\x40'));
+    }
+
+    EXPECT_GT(maximumNumberOfChanges, 1u);
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    EXPECT_THROW(ApplyPattern(newEntry, 0u, input.data(), 0u, testCaseKey_, PatternType::Many, ByteEditType::DropByte), RuntimeException);
+    EXPECT_THROW(ApplyPattern(newEntry, input.size(), nullptr, 0u, testCaseKey_, PatternType::Many, ByteEditType::DropByte), RuntimeException);
+    EXPECT_THROW(ApplyPattern(newEntry, input.size(), input.data(), input.size(), testCaseKey_, PatternType::Many, ByteEditType::DropByte), RuntimeException);
+}
+
+TEST_F(PatternMutationTest, TestApplyPatternEditsAtOffsets)
+{
+    // A header, a body and a trailing checksum; only the body may be edited.
+
+    const std::string input{std::string(8u, 'H') + std::string(48u, '\x40') + std::string(4u, 'C')};
+    const ::vmf::radamsa::mutations::OffsetSampler allowedOffsets{input.size(), {{0u, 8u}, {input.size() - 4u, input.size()}}};
+
+    auto getContent{
+                [](const ::vmf::radamsa::mutations::PieceTable& pieceTable)
+                {
+                    std::string content;
+
+                    for (size_t it{0u}; it < pieceTable.GetSize(); ++it)
+                        content.push_back(pieceTable.GetByte(it));
+
+                    return content;
+                }};
+
+    for (size_t it{0u}; it < 200u; ++it)
+    {
+        for (const PatternType patternType : {PatternType::Once, PatternType::Many, PatternType::Burst})
+        {
+            for (const ByteEditType byteEditType : {ByteEditType::DropByte, ByteEditType::RepeatByte, ByteEditType::RandomizeByte})
+            {
+                ::vmf::radamsa::mutations::PieceTable pieceTable{input.data(), input.size()};
+
+                ApplyPatternEditsAtOffsets(pieceTable, allowedOffsets, patternType, byteEditType);
+
+                const std::string output{getContent(pieceTable)};
+
+                ASSERT_GE(output.size(), 12u);
+                ASSERT_EQ(output.substr(0u, 8u), input.substr(0u, 8u));
+                ASSERT_EQ(output.substr(output.size() - 4u), input.substr(input.size() - 4u));
+            }
+        }
+    }
+
+    // Nothing is edited when every byte is protected.
+
+    ::vmf::radamsa::mutations::PieceTable pieceTable{input.data(), input.size()};
+
+    ApplyPatternEditsAtOffsets(pieceTable, ::vmf::radamsa::mutations::OffsetSampler{input.size(), {{0u, input.size()}}}, PatternType::Many, ByteEditType::DropByte);
+
+    EXPECT_EQ(getContent(pieceTable), input);
+}
+}
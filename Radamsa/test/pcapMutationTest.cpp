@@ -0,0 +1,261 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <vector>
+
+// VMF Includes
+#include "pcapMutationTest.h"
+
+namespace
+{
+std::string EncodeUInt32(const uint32_t value, const bool isBigEndian)
+{
+    std::string encodedValue(4u, '\0');
+
+    for (size_t it{0u}; it < 4u; ++it)
+        encodedValue[isBigEndian ? 3u - it : it] = static_cast<char>((value >> (8u * it)) & 0xffu);
+
+    return encodedValue;
+}
+
+uint32_t DecodeUInt32(const std::string& buffer, const size_t index, const bool isBigEndian)
+{
+    uint32_t value{0u};
+
+    for (size_t it{0u}; it < 4u; ++it)
+        value = (value << 8u) | static_cast<uint8_t>(buffer[index + (isBigEndian ? it : 3u - it)]);
+
+    return value;
+}
+
+std::string MakePcapInput(const std::vector<std::string>& packets, const bool isBigEndian)
+{
+    std::string input{EncodeUInt32(0xa1b2c3d4u, isBigEndian) + std::string(16u, '\0') + EncodeUInt32(1u, isBigEndian)};
+
+    for (const std::string& packet : packets)
+        input += std::string(8u, 't') +
+                 EncodeUInt32(static_cast<uint32_t>(packet.size()), isBigEndian) +
+                 EncodeUInt32(static_cast<uint32_t>(packet.size() + 100u), isBigEndian) +
+                 packet;
+
+    return input;
+}
+
+std::string MakePcapNgBlock(const uint32_t type, const std::string& body, const bool isBigEndian)
+{
+    const std::string paddedBody{body + std::string((4u - body.size() % 4u) % 4u, '\0')};
+    const std::string blockLength{EncodeUInt32(static_cast<uint32_t>(paddedBody.size() + 12u), isBigEndian)};
+
+    return EncodeUInt32(type, isBigEndian) + blockLength + paddedBody + blockLength;
+}
+
+// A section header, an interface description, two enhanced packet blocks (the second with an option) and a simple packet block.
+
+std::string MakePcapNgInput(const bool isBigEndian)
+{
+    const std::string firstPacket{"GET / HTTP/1.1"};
+    const std::string secondPacket{"abc"};
+    const std::string simplePacket{"simple!"};
+
+    return MakePcapNgBlock(0x0a0d0d0au, EncodeUInt32(0x1a2b3c4du, isBigEndian) + std::string(12u, '\xff'), isBigEndian) +
+           MakePcapNgBlock(1u, std::string(8u, '\0'), isBigEndian) +
+           MakePcapNgBlock(
+                        6u,
+                        std::string(12u, 'h') +
+                        EncodeUInt32(static_cast<uint32_t>(firstPacket.size()), isBigEndian) +
+                        EncodeUInt32(static_cast<uint32_t>(firstPacket.size()), isBigEndian) +
+                        firstPacket,
+                        isBigEndian) +
+           MakePcapNgBlock(
+                        6u,
+                        std::string(12u, 'h') +
+                        EncodeUInt32(static_cast<uint32_t>(secondPacket.size()), isBigEndian) +
+                        EncodeUInt32(static_cast<uint32_t>(secondPacket.size()), isBigEndian) +
+                        secondPacket + std::string(1u, '\0') +
+                        std::string{"\x01\x00\x02\x00" "ok\0\0" "\0\0\0\0", 12u},
+                        isBigEndian) +
+           MakePcapNgBlock(3u, EncodeUInt32(static_cast<uint32_t>(simplePacket.size()), isBigEndian) + simplePacket, isBigEndian);
+}
+}
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(PcapMutationTest, TestBuildPacketIndex)
+{
+    for (const bool isBigEndian : {false, true})
+    {
+        const std::string pcap{MakePcapInput({"first", "", "third packet"}, isBigEndian)};
+        const PacketIndex pcapIndex{BuildPacketIndex(pcap.data(), pcap.size())};
+
+        ASSERT_EQ(pcapIndex.Format, CaptureFormat::Pcap);
+        ASSERT_EQ(pcapIndex.Packets.size(), 3u);
+        EXPECT_EQ(pcapIndex.Packets[0].DataStartIndex, 40u);
+        EXPECT_EQ(pcapIndex.Packets[0].DataSize, 5u);
+        EXPECT_EQ(pcapIndex.Packets[0].CapturedLengthIndex, 32u);
+        EXPECT_EQ(pcapIndex.Packets[1].DataSize, 0u);
+        EXPECT_EQ(pcap.substr(pcapIndex.Packets[2].DataStartIndex, pcapIndex.Packets[2].DataSize), "third packet");
+        EXPECT_EQ(pcapIndex.Packets[2].BlockLengthIndex, PcapMutations::NO_FIELD);
+        EXPECT_EQ(pcapIndex.Packets[2].IsBigEndian, isBigEndian);
+
+        // A truncated final record ends the index.
+
+        const PacketIndex truncatedIndex{BuildPacketIndex(pcap.data(), pcap.size() - 1u)};
+
+        EXPECT_EQ(truncatedIndex.Packets.size(), 2u);
+
+        const std::string pcapNg{MakePcapNgInput(isBigEndian)};
+        const PacketIndex pcapNgIndex{BuildPacketIndex(pcapNg.data(), pcapNg.size())};
+
+        ASSERT_EQ(pcapNgIndex.Format, CaptureFormat::PcapNg);
+        ASSERT_EQ(pcapNgIndex.Packets.size(), 3u);
+        EXPECT_EQ(pcapNg.substr(pcapNgIndex.Packets[0].DataStartIndex, pcapNgIndex.Packets[0].DataSize), "GET / HTTP/1.1");
+        EXPECT_EQ(pcapNg.substr(pcapNgIndex.Packets[1].DataStartIndex, pcapNgIndex.Packets[1].DataSize), "abc");
+        EXPECT_EQ(pcapNg.substr(pcapNgIndex.Packets[2].DataStartIndex, pcapNgIndex.Packets[2].DataSize), "simple!");
+        EXPECT_EQ(pcapNgIndex.Packets[2].CapturedLengthIndex, PcapMutations::NO_FIELD);
+        EXPECT_EQ(pcapNgIndex.Packets[2].TrailingLengthIndex, pcapNg.size() - 4u);
+        EXPECT_EQ(pcapNgIndex.Packets[2].IsBigEndian, isBigEndian);
+    }
+
+    const std::string text{"plain text that is not a packet capture"};
+
+    EXPECT_EQ(BuildPacketIndex(text.data(), text.size()).Format, CaptureFormat::None);
+    EXPECT_TRUE(BuildPacketIndex(text.data(), text.size()).Packets.empty());
+    EXPECT_TRUE(BuildPacketIndex(nullptr, 100u).Packets.empty());
+}
+
+TEST_F(PcapMutationTest, TestPcapMutations)
+{
+    // Every input gets its own seed ID, as the packet index is cached by seed.
+
+    unsigned long seedId{10u};
+
+    for (const std::string& input : {MakePcapInput({"first", "", "third packet"}, false), MakePcapNgInput(false), MakePcapNgInput(true)})
+    {
+        ++seedId;
+
+        const PacketIndex index{BuildPacketIndex(input.data(), input.size())};
+
+        // Every packet still parses, its length fields match its data, and at most one packet changed by at most the resize limit.
+
+        auto expectValidCapture{
+                            [&](const std::string& output)
+                            {
+                                const PacketIndex outputIndex{BuildPacketIndex(output.data(), output.size())};
+
+                                ASSERT_EQ(outputIndex.Packets.size(), index.Packets.size());
+
+                                size_t numberOfChangedPackets{0u};
+
+                                for (size_t it{0u}; it < index.Packets.size(); ++it)
+                                {
+                                    const Packet& packet{index.Packets[it]};
+                                    const Packet& outputPacket{outputIndex.Packets[it]};
+
+                                    if (outputPacket.DataSize != packet.DataSize ||
+                                        output.compare(outputPacket.DataStartIndex, outputPacket.DataSize, input, packet.DataStartIndex, packet.DataSize) != 0)
+                                        ++numberOfChangedPackets;
+
+                                    EXPECT_LE(std::max(outputPacket.DataSize, packet.DataSize) - std::min(outputPacket.DataSize, packet.DataSize), MAXIMUM_RESIZE);
+
+                                    // The original length keeps the number of bytes that were not captured.
+
+                                    EXPECT_EQ(
+                                        DecodeUInt32(output, outputPacket.OriginalLengthIndex, outputPacket.IsBigEndian) - outputPacket.DataSize,
+                                        DecodeUInt32(input, packet.OriginalLengthIndex, packet.IsBigEndian) - packet.DataSize);
+                                }
+
+                                EXPECT_LE(numberOfChangedPackets, 1u);
+                            }};
+
+        for (size_t it{0u}; it < 200u; ++it)
+        {
+            vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+            MutatePacket(newEntry, input.size(), input.data(), seedId, 0u, testCaseKey_);
+
+            const std::string mutated{GetOutput(newEntry)};
+
+            ASSERT_EQ(mutated.size(), input.size());
+            expectValidCapture(mutated);
+
+            newEntry = storage_->createNewEntry();
+
+            ResizePacket(newEntry, input.size(), input.data(), seedId, 0u, testCaseKey_);
+
+            const std::string resized{GetOutput(newEntry)};
+
+            // pcap records are not padded, so every resize changes the file size; pcapng blocks stay 4 byte aligned.
+
+            if (index.Format == CaptureFormat::Pcap)
+            {
+                ASSERT_NE(resized.size(), input.size());
+            }
+            else
+            {
+                ASSERT_EQ(resized.size() % 4u, 0u);
+            }
+
+            expectValidCapture(resized);
+        }
+    }
+
+    // Packets whose data starts before the minimum seed index are never selected; when none is left the buffer is unchanged.
+
+    const std::string input{MakePcapNgInput(false)};
+    const PacketIndex index{BuildPacketIndex(input.data(), input.size())};
+
+    for (size_t it{0u}; it < 20u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        ResizePacket(newEntry, input.size(), input.data(), 2u, index.Packets[2].DataStartIndex, testCaseKey_);
+
+        const std::string resized{GetOutput(newEntry)};
+
+        // Only the simple packet block, whose length fields follow its block type, can change.
+
+        const size_t blockStartIndex{index.Packets[2].BlockLengthIndex - 4u};
+
+        ASSERT_EQ(resized.compare(0u, blockStartIndex + 4u, input, 0u, blockStartIndex + 4u), 0);
+    }
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    MutatePacket(newEntry, input.size(), input.data(), 2u, input.size() - 1u, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), input);
+
+    const std::string text{"plain text that is not a packet capture"};
+
+    newEntry = storage_->createNewEntry();
+
+    ResizePacket(newEntry, text.size(), text.data(), 3u, 0u, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), text);
+
+    newEntry = storage_->createNewEntry();
+
+    EXPECT_THROW(MutatePacket(newEntry, 0u, input.data(), 2u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(ResizePacket(newEntry, input.size(), nullptr, 2u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(ResizePacket(newEntry, input.size(), input.data(), 2u, input.size(), testCaseKey_), RuntimeException);
+}
+}
@@ -0,0 +1,325 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+
+// VMF Includes
+#include "radamsaInputGeneratorTest.h"
+
+namespace
+{
+// Number of bytes in which two buffers of the same size differ.
+
+size_t GetNumberOfDifferentBytes(const std::string& first, const std::string& second)
+{
+    size_t numberOfDifferentBytes{0u};
+
+    for (size_t it{0u}; it < first.size(); ++it)
+        numberOfDifferentBytes += first[it] != second[it];
+
+    return numberOfDifferentBytes;
+}
+}
+
+namespace vmf::test::modules::radamsa
+{
+TEST_F(RadamsaInputGeneratorTest, TestAddNewTestCases)
+{
+    Initialize(
+            std::string{"TestGenerator:\n"} +
+            "  workers: 3\n" +
+            "  numberOfTestCases: 7\n" +
+            "  childrenPerBase: 2\n" +
+            "TestMutator:\n" +
+            "  algType: ByteMutations_FlipByte\n");
+
+    const std::vector<std::string> seeds{"first seed 0123", "second seed 456", "third seed 7890"};
+
+    for (const std::string& seed : seeds)
+        SaveSeed(seed);
+
+    // Every new entry is mutated once a call returns, the last task included although it only has one child.
+
+    for (size_t it{0u}; it < 20u; ++it)
+    {
+        const std::vector<std::string> outputs{GenerateOutputs()};
+
+        ASSERT_EQ(outputs.size(), 7u);
+
+        for (const std::string& output : outputs)
+            ASSERT_TRUE(
+                    std::any_of(
+                            seeds.begin(),
+                            seeds.end(),
+                            [&](const std::string& seed) { return output.size() == seed.size() && GetNumberOfDifferentBytes(output, seed) == 1u; })) << output;
+    }
+
+    storage_ = std::make_unique<vmf::SimpleStorage>("storage");
+
+    EXPECT_THROW(generator_->addNewTestCases(*storage_), RuntimeException);
+}
+
+TEST_F(RadamsaInputGeneratorTest, TestRunTasks)
+{
+    Initialize(
+            std::string{"TestGenerator:\n"} +
+            "  workers: 3\n" +
+            "TestMutator:\n" +
+            "  algType: ByteMutations_FlipByte\n");
+
+    const std::string seed{"0123456789abcdef"};
+
+    vmf::StorageEntry* baseEntry{SaveSeed(seed)};
+
+    // More tasks than workers are dealt round robin, and every child of every task is written.
+
+    std::vector<TestRadamsaInputGenerator::Task> tasks(10u);
+
+    for (TestRadamsaInputGenerator::Task& task : tasks)
+    {
+        task.Storage = storage_.get();
+        task.BaseEntry = baseEntry;
+
+        for (size_t it{0u}; it < 3u; ++it)
+            task.NewEntries.push_back(storage_->createNewEntry());
+    }
+
+    std::vector<vmf::StorageEntry*> newEntries;
+
+    for (const TestRadamsaInputGenerator::Task& task : tasks)
+        newEntries.insert(newEntries.end(), task.NewEntries.begin(), task.NewEntries.end());
+
+    generator_->RunTasks(tasks);
+
+    for (vmf::StorageEntry* newEntry : newEntries)
+    {
+        ASSERT_EQ(newEntry->getBufferSize(testCaseKey_), static_cast<int>(seed.size() + 1u));
+        ASSERT_EQ(GetNumberOfDifferentBytes(std::string{newEntry->getBufferPointer(testCaseKey_), seed.size()}, seed), 1u);
+    }
+
+    // An exception thrown by a worker is rethrown on the calling thread, and the next batch still runs.
+
+    std::vector<TestRadamsaInputGenerator::Task> failingTasks(1u);
+
+    failingTasks.front().Storage = storage_.get();
+    failingTasks.front().BaseEntry = storage_->createNewEntry();
+    failingTasks.front().NewEntries.push_back(storage_->createNewEntry());
+
+    EXPECT_THROW(generator_->RunTasks(failingTasks), RuntimeException);
+
+    std::vector<TestRadamsaInputGenerator::Task> nextTasks(1u);
+
+    nextTasks.front().Storage = storage_.get();
+    nextTasks.front().BaseEntry = baseEntry;
+    nextTasks.front().NewEntries.push_back(storage_->createNewEntry());
+
+    vmf::StorageEntry* nextEntry{nextTasks.front().NewEntries.front()};
+
+    generator_->RunTasks(nextTasks);
+
+    EXPECT_EQ(nextEntry->getBufferSize(testCaseKey_), static_cast<int>(seed.size() + 1u));
+}
+
+TEST_F(RadamsaInputGeneratorTest, TestSelectBaseIndex)
+{
+    Initialize(
+            std::string{"TestGenerator:\n"} +
+            "  workers: 1\n" +
+            "TestMutator:\n" +
+            "  algType: ByteMutations_FlipByte\n");
+
+    // The first quarter of the entries is selected about half of the time, and every index stays in range.
+
+    constexpr size_t numberOfSamples{10000u};
+
+    size_t numberOfFrontSamples{0u};
+
+    for (size_t it{0u}; it < numberOfSamples; ++it)
+    {
+        const size_t index{generator_->SelectBaseIndex(100u)};
+
+        ASSERT_LT(index, 100u);
+
+        numberOfFrontSamples += index < 25u;
+    }
+
+    EXPECT_NEAR(static_cast<double>(numberOfFrontSamples) / numberOfSamples, 0.5, 0.03);
+    EXPECT_EQ(generator_->SelectBaseIndex(1u), 0u);
+}
+
+TEST_F(RadamsaInputGeneratorTest, TestSeededDeterminism)
+{
+    auto generateSeededOutputs{
+                        [&](const int seed, const int workers)
+                        {
+                            Initialize(
+                                    std::string{"vmfFramework:\n"} +
+                                    "  seed: " + std::to_string(seed) + "\n" +
+                                    "TestGenerator:\n" +
+                                    "  workers: " + std::to_string(workers) + "\n" +
+                                    "  numberOfTestCases: 24\n" +
+                                    "  childrenPerBase: 3\n" +
+                                    "TestMutator:\n" +
+                                    "  algType: ByteMutations_FlipByte,ByteMutations_InsertByte,ByteMutations_DropByte\n");
+
+                            for (size_t it{0u}; it < 4u; ++it)
+                                SaveSeed("seed number " + std::to_string(it) + " of the corpus");
+
+                            std::vector<std::string> outputs;
+
+                            for (size_t it{0u}; it < 5u; ++it)
+                            {
+                                const std::vector<std::string> callOutputs{GenerateOutputs()};
+
+                                outputs.insert(outputs.end(), callOutputs.begin(), callOutputs.end());
+                            }
+
+                            return outputs;
+                        }};
+
+    // The same seed and worker count give the same outputs in the same order, however the workers are scheduled.
+
+    const std::vector<std::string> outputs{generateSeededOutputs(7, 4)};
+
+    ASSERT_EQ(outputs.size(), 120u);
+
+    for (size_t it{0u}; it < 3u; ++it)
+        ASSERT_EQ(generateSeededOutputs(7, 4), outputs);
+
+    EXPECT_NE(generateSeededOutputs(8, 4), outputs);
+
+    // A seeded run only reproduces with the same worker count, so the count must be explicit.
+
+    EXPECT_THROW(
+            Initialize(
+                    std::string{"vmfFramework:\n"} +
+                    "  seed: 7\n" +
+                    "TestMutator:\n" +
+                    "  algType: ByteMutations_FlipByte\n"),
+            RuntimeException);
+}
+
+TEST_F(RadamsaInputGeneratorTest, TestEffectorCalibration)
+{
+    Initialize(
+            std::string{"TestGenerator:\n"} +
+            "  workers: 2\n" +
+            "  numberOfTestCases: 8\n" +
+            "  effectorCalibration: true\n" +
+            "  effectorBlockSize: 4\n" +
+            "  coverageKey: COVERAGE\n" +
+            "TestMutator:\n" +
+            "  algType: ByteMutations_FlipByte\n");
+
+    const int coverageKey{registry_->registerKey("COVERAGE", vmf::StorageRegistry::BUFFER, vmf::StorageRegistry::READ_WRITE)};
+    const int effectorMapKey{registry_->registerKey("RADAMSA_EFFECTOR_MAP", vmf::StorageRegistry::BUFFER, vmf::StorageRegistry::READ_ONLY)};
+    const int hungTag{registry_->registerTag("HUNG", vmf::StorageRegistry::READ_WRITE)};
+
+    // The coverage only depends on byte 5, so the second block is the only one that inverting changes the coverage of.
+
+    auto execute{
+            [&](vmf::StorageEntry* entry)
+            {
+                char* coverage{entry->allocateBuffer(coverageKey, 2)};
+
+                coverage[0] = 1;
+                coverage[1] = entry->getBufferPointer(testCaseKey_)[5] == '5' ? 1 : 2;
+            }};
+
+    const std::string seed{"0123456789abcdef"};
+
+    vmf::StorageEntry* seedEntry{SaveSeed(seed)};
+
+    execute(seedEntry);
+
+    // The four probes of the seed take the place of the first four children; the fourth probe hangs.
+
+    std::vector<std::string> outputs{GenerateOutputs()};
+
+    ASSERT_EQ(outputs.size(), 8u);
+
+    for (size_t it{0u}; it < 4u; ++it)
+    {
+        std::string probe{seed};
+
+        for (size_t byteIndex{it * 4u}; byteIndex < it * 4u + 4u; ++byteIndex)
+            probe[byteIndex] = static_cast<char>(~probe[byteIndex]);
+
+        ASSERT_EQ(outputs[it], probe);
+    }
+
+    {
+        std::unique_ptr<vmf::Iterator> newEntries{storage_->getNewEntries()};
+
+        for (size_t it{0u}; newEntries->hasNext(); ++it)
+        {
+            vmf::StorageEntry* entry{newEntries->getNext()};
+
+            if (it == 3u)
+                entry->addTag(hungTag);
+            else
+                execute(entry);
+        }
+    }
+
+    // The map is only written once every probe is examined, with one bit per byte of each effective block.
+
+    ASSERT_LE(seedEntry->getBufferSize(effectorMapKey), 0);
+
+    generator_->examineTestCaseResults(*storage_);
+
+    ASSERT_EQ(seedEntry->getBufferSize(effectorMapKey), 2);
+    EXPECT_EQ(static_cast<uint8_t>(seedEntry->getBufferPointer(effectorMapKey)[0]), 0xf0u);
+    EXPECT_EQ(static_cast<uint8_t>(seedEntry->getBufferPointer(effectorMapKey)[1]), 0xf0u);
+
+    // A calibrated seed is not probed again, and a seed whose probe comes back without coverage gets no map.
+
+    vmf::StorageEntry* otherSeedEntry{SaveSeed("fedcba9876543210")};
+
+    execute(otherSeedEntry);
+
+    outputs = GenerateOutputs();
+
+    ASSERT_EQ(outputs.size(), 8u);
+    ASSERT_EQ(outputs[0], "\x99\x9a\x9b\x9c" "ba9876543210");
+
+    {
+        std::unique_ptr<vmf::Iterator> newEntries{storage_->getNewEntries()};
+
+        for (size_t it{0u}; newEntries->hasNext(); ++it)
+        {
+            vmf::StorageEntry* entry{newEntries->getNext()};
+
+            if (it != 0u)
+                execute(entry);
+        }
+    }
+
+    generator_->examineTestCaseResults(*storage_);
+
+    EXPECT_LE(otherSeedEntry->getBufferSize(effectorMapKey), 0);
+
+    outputs = GenerateOutputs();
+
+    for (const std::string& output : outputs)
+        ASSERT_EQ(output.size(), seed.size());
+}
+}
@@ -0,0 +1,162 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+#pragma once
+
+#ifndef GTEST_DECORATOR
+#define GTEST_DECORATOR std::cout << "\033[32m[          ] \033[37m[ INFO ] "
+#endif
+
+// C/C++ Includes
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Google Test Includes
+#include "gtest/gtest.h"
+
+// VMF Includes
+#include "MockConfigurationManager.hpp"
+#include "SimpleStorage.hpp"
+#include "radamsaInputGenerator.hpp"
+#include "radamsaMutator.hpp"
+
+namespace vmf::test::modules::radamsa
+{
+class RadamsaInputGeneratorTest : public ::testing::Test
+{
+public:
+    virtual ~RadamsaInputGeneratorTest() = default;
+
+protected:
+    /**
+     * @brief Exposes the task dealing of the generator to the tests.
+     */
+    class TestRadamsaInputGenerator : public ::vmf::modules::radamsa::RadamsaInputGenerator
+    {
+    public:
+        TestRadamsaInputGenerator(std::string name) noexcept : RadamsaInputGenerator{name} {}
+
+        using RadamsaInputGenerator::Task;
+        using RadamsaInputGenerator::RunTasks;
+        using RadamsaInputGenerator::SelectBaseIndex;
+    };
+
+    /**
+     * @brief Configuration that hands the generator its RadamsaMutator submodule.
+     */
+    class GeneratorConfigurationManager : public MockConfigurationManager
+    {
+    public:
+        GeneratorConfigurationManager(std::vector<std::string> configurationFiles, Module* mutator) :
+            MockConfigurationManager{configurationFiles},
+            mutator_{mutator} {}
+
+        virtual std::vector<Module*> getSubModules(std::string /*parentName*/) override { return {mutator_}; }
+
+    private:
+        Module* mutator_;
+    };
+
+    /**
+     * @brief Initializes mutator_ and generator_ from the TestMutator and TestGenerator sections of the
+     * configuration, and configures storage_ with their storage needs.
+     */
+    void Initialize(const std::string& configuration)
+    {
+        mutator_ = std::make_unique<::vmf::modules::radamsa::RadamsaMutator>("TestMutator");
+        generator_ = std::make_unique<TestRadamsaInputGenerator>("TestGenerator");
+        storage_ = std::make_unique<vmf::SimpleStorage>("storage");
+
+        std::vector<std::string> configurationFiles;
+
+        configurationFiles.emplace_back(
+                                std::string{"modules:\n"} +
+                                "    - name: TestGenerator\n" +
+                                "      className: \"vmf::modules::radamsa::RadamsaInputGenerator\"\n" +
+                                "      children:\n" +
+                                "        - name: TestMutator\n" +
+                                "          className: \"vmf::modules::radamsa::RadamsaMutator\"\n" +
+                                configuration);
+
+        configurationManager_ = std::make_unique<GeneratorConfigurationManager>(configurationFiles, mutator_.get());
+
+        mutator_->init(*configurationManager_);
+        generator_->init(*configurationManager_);
+
+        registry_ = std::make_unique<vmf::StorageRegistry>("TEST_INT", vmf::StorageRegistry::INT, vmf::StorageRegistry::ASCENDING);
+        metadata_ = std::make_unique<vmf::StorageRegistry>();
+
+        mutator_->registerStorageNeeds(*registry_);
+        generator_->registerStorageNeeds(*registry_);
+
+        testCaseKey_ = registry_->registerKey("TEST_CASE", vmf::StorageRegistry::BUFFER, vmf::StorageRegistry::READ_WRITE);
+
+        storage_->configure(registry_.get(), metadata_.get());
+    }
+
+    vmf::StorageEntry* SaveSeed(const std::string& seed)
+    {
+        vmf::StorageEntry* entry{storage_->createNewEntry()};
+
+        memcpy(entry->allocateBuffer(testCaseKey_, static_cast<int>(seed.size())), seed.data(), seed.size());
+
+        storage_->saveEntry(entry);
+
+        return entry;
+    }
+
+    /**
+     * @brief Returns the outputs of one addNewTestCases call, without their null-terminators.
+     */
+    std::vector<std::string> GenerateOutputs()
+    {
+        storage_->clearNewAndLocalEntries();
+
+        generator_->addNewTestCases(*storage_);
+
+        std::vector<std::string> outputs;
+        std::unique_ptr<vmf::Iterator> newEntries{storage_->getNewEntries()};
+
+        while (newEntries->hasNext())
+        {
+            vmf::StorageEntry* entry{newEntries->getNext()};
+
+            const int size{entry->getBufferSize(testCaseKey_)};
+
+            EXPECT_GT(size, 0);
+            EXPECT_EQ(entry->getBufferPointer(testCaseKey_)[size - 1], '\0');
+
+            outputs.emplace_back(entry->getBufferPointer(testCaseKey_), static_cast<size_t>(size - 1));
+        }
+
+        return outputs;
+    }
+
+    std::unique_ptr<::vmf::modules::radamsa::RadamsaMutator> mutator_;
+    std::unique_ptr<TestRadamsaInputGenerator> generator_;
+    std::unique_ptr<ConfigInterface> configurationManager_;
+    std::unique_ptr<vmf::StorageRegistry> registry_;
+    std::unique_ptr<vmf::StorageRegistry> metadata_;
+    std::unique_ptr<vmf::SimpleStorage> storage_;
+    int testCaseKey_{0};
+};
+}
@@ -196,6 +196,79 @@ TEST_F(UninitializedRadamsaMutatorTest, TestInit)
                                 std::move("  algType: LineMutations_SwapLine"))},
                 AlgorithmType::LineMutations_SwapLine);
 
+    // Valid Input - This subtest should accept a weighted list of algorithm types, including radamsa short names, and start on the first one.
+
+    runInitMethod(
+                std::string{
+                        std::move(
+                            std::string{"modules:\n"} +
+                                std::move("    - name: TestMutator\n") +
+                                std::move("      className: \"vmf::modules::radamsa::RadamsaMutator\"\n") +
+                                std::move("TestMutator:\n") + 
+                                std::move("  algType: \"bd=3, LineMutations_RepeatLine=2, bf\""))},
+                AlgorithmType::ByteMutations_DropByte);
+
+    ASSERT_EQ(algorithmTypes_.size(), 3u);
+
+    // Valid Input - This subtest should accept adaptive scheduling over a list of algorithm types.
+
+    runInitMethod(
+                std::string{
+                        std::move(
+                            std::string{"modules:\n"} +
+                                std::move("    - name: TestMutator\n") +
+                                std::move("      className: \"vmf::modules::radamsa::RadamsaMutator\"\n") +
+                                std::move("TestMutator:\n") + 
+                                std::move("  algType: \"bd, lr, bf\"\n") +
+                                std::move("  adaptiveScheduling: true"))},
+                AlgorithmType::ByteMutations_DropByte);
+
+    ASSERT_EQ(algorithmScheduler_.GetNumberOfArms(), 3u);
+
+    // Erroneous Input - This subtest should trigger a runtime exception since the adaptive feedback interval is not positive.
+
+    EXPECT_THROW(
+            runInitMethod(
+                    std::string{
+                            std::move(
+                                std::string{"modules:\n"} +
+                                    std::move("    - name: TestMutator\n") +
+                                    std::move("      className: \"vmf::modules::radamsa::RadamsaMutator\"\n") +
+                                    std::move("TestMutator:\n") + 
+                                    std::move("  algType: \"bd, lr\"\n") +
+                                    std::move("  adaptiveScheduling: true\n") +
+                                    std::move("  adaptiveFeedbackInterval: 0"))},
+                    AlgorithmType::Unknown),
+            RuntimeException);
+
+    // Erroneous Input - This subtest should trigger a runtime exception since a weight of the list is not a number.
+
+    EXPECT_THROW(
+            runInitMethod(
+                    std::string{
+                            std::move(
+                                std::string{"modules:\n"} +
+                                    std::move("    - name: TestMutator\n") +
+                                    std::move("      className: \"vmf::modules::radamsa::RadamsaMutator\"\n") +
+                                    std::move("TestMutator:\n") + 
+                                    std::move("  algType: \"bd=3,lr=x\""))},
+                    AlgorithmType::Unknown),
+            RuntimeException);
+
+    // Erroneous Input - This subtest should trigger a runtime exception since an algorithm type of the list is Unknown.
+
+    EXPECT_THROW(
+            runInitMethod(
+                    std::string{
+                            std::move(
+                                std::string{"modules:\n"} +
+                                    std::move("    - name: TestMutator\n") +
+                                    std::move("      className: \"vmf::modules::radamsa::RadamsaMutator\"\n") +
+                                    std::move("TestMutator:\n") + 
+                                    std::move("  algType: \"bd=3,Unmapped=2\""))},
+                    AlgorithmType::Unknown),
+            RuntimeException);
+
     // Erroneous Input - This subtest should trigger a runtime exception since the algorithm type is Unknown.
 
     EXPECT_THROW(
@@ -372,7 +445,7 @@ TEST_F(InitializedRadamsaMutatorTest, TestCreateTestCase_LineMutations_AsciiInpu
         {
             // Valid Input - This subtest should update the algorithm type to LineMutations_DuplicateLine and execute successfuly.
 
-            constexpr int expectedBufferSize{sizeof(asciiInput_) + 1};
+            constexpr int expectedBufferSize{sizeof(asciiInput_) * 2 + 1};
 
             RunSetTestCaseMethod(AlgorithmType::LineMutations_DuplicateLine, expectedBufferSize, baseEntry);
         }
@@ -380,7 +453,7 @@ TEST_F(InitializedRadamsaMutatorTest, TestCreateTestCase_LineMutations_AsciiInpu
         {
             // Valid Input - This subtest should update the algorithm type to LineMutations_CopyLineCloseBy and execute successfuly.
 
-            constexpr int expectedBufferSize{sizeof(asciiInput_) + 1};
+            constexpr int expectedBufferSize{sizeof(asciiInput_) * 2 + 1};
 
             RunSetTestCaseMethod(AlgorithmType::LineMutations_CopyLineCloseBy, expectedBufferSize, baseEntry);
         }
@@ -388,7 +461,7 @@ TEST_F(InitializedRadamsaMutatorTest, TestCreateTestCase_LineMutations_AsciiInpu
         {
             // Valid Input - This subtest should update the algorithm type to LineMutations_RepeatLine and execute successfuly.
 
-            constexpr int expectedBufferSize{sizeof(asciiInput_) + 1};
+            constexpr int expectedBufferSize{sizeof(asciiInput_) * 2 + 1};
 
             RunSetTestCaseMethod(AlgorithmType::LineMutations_RepeatLine, expectedBufferSize, baseEntry);
         }
@@ -427,7 +500,7 @@ TEST_F(InitializedRadamsaMutatorTest, TestCreateTestCase_LineMutations_Utf8Input
         {
             // Valid Input - This subtest should update the algorithm type to LineMutations_DuplicateLine and execute successfuly.
 
-            constexpr int expectedBufferSize{sizeof(utf8Input_) * 2 + 1};
+            constexpr int expectedBufferSize{sizeof(utf8Input_) + 1};
 
             RunSetTestCaseMethod(AlgorithmType::LineMutations_DuplicateLine, expectedBufferSize, baseEntry);
         }
@@ -435,7 +508,7 @@ TEST_F(InitializedRadamsaMutatorTest, TestCreateTestCase_LineMutations_Utf8Input
         {
             // Valid Input - This subtest should update the algorithm type to LineMutations_CopyLineCloseBy and execute successfuly.
 
-            constexpr int expectedBufferSize{sizeof(utf8Input_) * 2 + 1};
+            constexpr int expectedBufferSize{sizeof(utf8Input_) + 1};
 
             RunSetTestCaseMethod(AlgorithmType::LineMutations_CopyLineCloseBy, expectedBufferSize, baseEntry);
         }
@@ -447,7 +520,7 @@ TEST_F(InitializedRadamsaMutatorTest, TestCreateTestCase_LineMutations_Utf8Input
             // If the random seed is changed or new calls to the subtests are added prior to this statement,
             // the output size will also change and the unit tests will fail.
 
-            constexpr int expectedBufferSize{sizeof(utf8Input_) * 2 + 1};
+            constexpr int expectedBufferSize{sizeof(utf8Input_) + 1};
 
             RunSetTestCaseMethod(AlgorithmType::LineMutations_RepeatLine, expectedBufferSize, baseEntry);
         }
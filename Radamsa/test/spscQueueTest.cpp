@@ -0,0 +1,78 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "spscQueueTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST(SpscQueueTest, TestTryPop)
+{
+    using ::vmf::radamsa::mutations::SpscQueue;
+
+    ASSERT_THROW(SpscQueue<int>{0u}, RuntimeException);
+
+    // The capacity is rounded up to a power of two, and values come out in the order they went in.
+
+    SpscQueue<int> queue{3u};
+
+    ASSERT_EQ(queue.GetCapacity(), 4u);
+
+    int value{0};
+
+    ASSERT_FALSE(queue.TryPop(value));
+
+    for (int it{0}; it < 4; ++it)
+        ASSERT_TRUE(queue.TryPush(int{it}));
+
+    ASSERT_TRUE(queue.IsFull());
+    ASSERT_FALSE(queue.TryPush(4));
+
+    for (int it{0}; it < 4; ++it)
+    {
+        ASSERT_TRUE(queue.TryPop(value));
+        ASSERT_EQ(value, it);
+    }
+
+    ASSERT_FALSE(queue.TryPop(value));
+
+    // A producer thread and a consumer thread pass every value through exactly once.
+
+    constexpr int numberOfValues{100000};
+
+    std::thread producer{
+                    [&]()
+                    {
+                        for (int it{0}; it < numberOfValues; ++it)
+                            while (!queue.TryPush(int{it}))
+                                std::this_thread::yield();
+                    }};
+
+    for (int it{0}; it < numberOfValues; ++it)
+    {
+        while (!queue.TryPop(value))
+            std::this_thread::yield();
+
+        ASSERT_EQ(value, it);
+    }
+
+    producer.join();
+}
+}
@@ -0,0 +1,143 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "stringMutationTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(StringMutationTest, TestBuildStringLiteralIndex)
+{
+    // Escaped quotes do not end a literal, an escaped backslash does not escape the quote after it,
+    // and the unterminated literal at the end is left out.
+
+    const std::string input{stringInput_, sizeof(stringInput_) - 1u};
+
+    auto getLiterals{
+                [](const std::string& text)
+                {
+                    const StringLiteralIndex index{BuildStringLiteralIndex(text.data(), text.size())};
+
+                    std::vector<std::string> literals;
+
+                    for (const StringLiteral& literal : index.Literals)
+                        literals.push_back(text.substr(literal.StartIndex, literal.Size));
+
+                    return literals;
+                }};
+
+    const std::vector<std::string> expected{"key", R"(ab\"c)", "empty", "", R"(x\\)", "tail"};
+
+    EXPECT_EQ(getLiterals(input), expected);
+
+    // The literals must be found at every alignment of the block scan, including escapes that straddle two blocks.
+
+    for (size_t padding : {1u, 55u, 60u, 63u, 64u, 127u})
+        EXPECT_EQ(getLiterals(std::string(padding, ' ') + input), expected);
+
+    EXPECT_EQ(getLiterals(std::string(63u, ' ') + R"("\"")"), (std::vector<std::string>{R"(\")"}));
+    EXPECT_TRUE(getLiterals("no strings").empty());
+    EXPECT_TRUE(BuildStringLiteralIndex(nullptr, 10u).Literals.empty());
+}
+
+TEST_F(StringMutationTest, TestStringMutations)
+{
+    const std::string input{stringInput_, sizeof(stringInput_) - 1u};
+
+    // Empty the literals to get the structure of a buffer, which the mutations must leave unchanged.
+
+    auto getSkeleton{
+                [](const std::string& text)
+                {
+                    const StringLiteralIndex index{BuildStringLiteralIndex(text.data(), text.size())};
+
+                    std::string skeleton;
+                    size_t sourceIndex{0u};
+
+                    for (const StringLiteral& literal : index.Literals)
+                    {
+                        skeleton.append(text, sourceIndex, literal.StartIndex - sourceIndex);
+                        sourceIndex = literal.StartIndex + literal.Size;
+                    }
+
+                    return skeleton + text.substr(sourceIndex);
+                }};
+
+    const std::string skeleton{getSkeleton(input)};
+
+    for (size_t it{0u}; it < 200u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        TruncateString(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string truncated{GetOutput(newEntry)};
+
+        ASSERT_LE(truncated.size(), input.size());
+        ASSERT_EQ(getSkeleton(truncated), skeleton) << truncated;
+
+        newEntry = storage_->createNewEntry();
+
+        RepeatString(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string repeated{GetOutput(newEntry)};
+
+        ASSERT_GT(repeated.size(), input.size());
+        ASSERT_EQ(getSkeleton(repeated), skeleton) << repeated;
+
+        newEntry = storage_->createNewEntry();
+
+        InjectEscape(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string injected{GetOutput(newEntry)};
+
+        ASSERT_GT(injected.size(), input.size());
+        ASSERT_EQ(getSkeleton(injected), skeleton) << injected;
+    }
+
+    // Literals starting before the minimum seed index are never selected; when none is left the buffer is unchanged.
+
+    const size_t tailIndex{input.find("tail")};
+
+    for (size_t it{0u}; it < 20u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        RepeatString(newEntry, input.size(), input.data(), 2u, tailIndex, testCaseKey_);
+
+        const std::string repeated{GetOutput(newEntry)};
+
+        ASSERT_EQ(repeated.compare(0u, tailIndex + 4u, input, 0u, tailIndex + 4u), 0);
+        ASSERT_EQ(repeated.compare(tailIndex + 4u, 4u, "tail"), 0);
+    }
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    TruncateString(newEntry, input.size(), input.data(), 2u, tailIndex + 1u, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), input);
+
+    newEntry = storage_->createNewEntry();
+
+    EXPECT_THROW(TruncateString(newEntry, 0u, input.data(), 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(RepeatString(newEntry, input.size(), nullptr, 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(InjectEscape(newEntry, input.size(), input.data(), 1u, input.size(), testCaseKey_), RuntimeException);
+}
+}
@@ -0,0 +1,197 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <set>
+
+// VMF Includes
+#include "wordMutationTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST_F(WordMutationTest, TestBuildWordTokenIndex)
+{
+    // Words and punctuation runs are separate tokens even when they touch; non-ASCII bytes belong to words.
+
+    const std::string input{wordInput_, sizeof(wordInput_) - 1u};
+
+    auto getTokens{
+            [](const std::string& text)
+            {
+                const WordTokenIndex index{BuildWordTokenIndex(text.data(), text.size())};
+
+                std::vector<std::pair<std::string, bool>> tokens;
+
+                for (const WordToken& token : index.Tokens)
+                    tokens.emplace_back(text.substr(token.StartIndex, token.Size), token.IsWord);
+
+                return tokens;
+            }};
+
+    const std::vector<std::pair<std::string, bool>> expected{
+                                                        {"SELECT", true},
+                                                        {"a", true},
+                                                        {".", false},
+                                                        {"b", true},
+                                                        {",", false},
+                                                        {"c", true},
+                                                        {"FROM", true},
+                                                        {"t", true},
+                                                        {"WHERE", true},
+                                                        {"x", true},
+                                                        {">=", false},
+                                                        {"10", true},
+                                                        {"AND", true},
+                                                        {"caf\xc3\xa9_1", true},
+                                                        {";", false}};
+
+    EXPECT_EQ(getTokens(input), expected);
+
+    // The boundaries must be found at every alignment of the block scan, including tokens that straddle two blocks.
+
+    for (size_t padding : {1u, 50u, 60u, 63u, 64u, 127u})
+        EXPECT_EQ(getTokens(std::string(padding, '\n') + input), expected);
+
+    const std::string blockSizedWord(64u, 'w');
+
+    EXPECT_EQ(getTokens(blockSizedWord), (std::vector<std::pair<std::string, bool>>{{blockSizedWord, true}}));
+    EXPECT_EQ(getTokens(std::string(63u, ' ') + "ab+"), (std::vector<std::pair<std::string, bool>>{{"ab", true}, {"+", false}}));
+    EXPECT_TRUE(getTokens(" \t\r\n").empty());
+    EXPECT_TRUE(BuildWordTokenIndex(nullptr, 10u).Tokens.empty());
+}
+
+TEST_F(WordMutationTest, TestWordMutations)
+{
+    const std::string input{wordInput_, sizeof(wordInput_) - 1u};
+    const WordTokenIndex index{BuildWordTokenIndex(input.data(), input.size())};
+
+    // Work out every possible deletion, and every repetition of a token with its separator up to the maximum count.
+
+    std::set<std::string> deleted;
+    std::set<std::string> duplicated;
+    std::set<std::string> repeated;
+
+    for (size_t it{0u}; it < index.Tokens.size(); ++it)
+    {
+        const WordToken& token{index.Tokens[it]};
+        const size_t endIndex{token.StartIndex + token.Size};
+        const size_t nextIndex{(it + 1u < index.Tokens.size()) ? index.Tokens[it + 1u].StartIndex : input.size()};
+
+        std::string separator{input.substr(endIndex, nextIndex - endIndex)};
+
+        if (separator.empty() && token.IsWord)
+            separator = " ";
+
+        deleted.insert(input.substr(0u, token.StartIndex) + input.substr(endIndex));
+
+        std::string copies;
+
+        for (size_t copy{1u}; copy < MAXIMUM_WORD_REPETITIONS; ++copy)
+        {
+            copies += separator + input.substr(token.StartIndex, token.Size);
+
+            const std::string output{input.substr(0u, endIndex) + copies + input.substr(endIndex)};
+
+            if (copy == 1u)
+                duplicated.insert(output);
+            else
+                repeated.insert(output);
+        }
+    }
+
+    // Swapping keeps the whitespace and the multiset of tokens.
+
+    auto getSortedTokens{
+                    [](const std::string& text)
+                    {
+                        const WordTokenIndex textIndex{BuildWordTokenIndex(text.data(), text.size())};
+
+                        std::multiset<std::string> tokens;
+                        std::string whitespace;
+
+                        for (const WordToken& token : textIndex.Tokens)
+                            tokens.insert(text.substr(token.StartIndex, token.Size));
+
+                        for (const char character : text)
+                            if (character == ' ' || character == '\t')
+                                whitespace.push_back(character);
+
+                        return std::make_pair(tokens, whitespace);
+                    }};
+
+    for (size_t it{0u}; it < 200u; ++it)
+    {
+        vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+        DeleteWord(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string deletedOutput{GetOutput(newEntry)};
+
+        ASSERT_EQ(deleted.count(deletedOutput), 1u) << deletedOutput;
+
+        newEntry = storage_->createNewEntry();
+
+        DuplicateWord(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string duplicatedOutput{GetOutput(newEntry)};
+
+        ASSERT_EQ(duplicated.count(duplicatedOutput), 1u) << duplicatedOutput;
+
+        newEntry = storage_->createNewEntry();
+
+        RepeatWord(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string repeatedOutput{GetOutput(newEntry)};
+
+        ASSERT_EQ(repeated.count(repeatedOutput), 1u) << repeatedOutput;
+
+        newEntry = storage_->createNewEntry();
+
+        SwapWords(newEntry, input.size(), input.data(), 1u, 0u, testCaseKey_);
+
+        const std::string swappedOutput{GetOutput(newEntry)};
+
+        ASSERT_EQ(swappedOutput.size(), input.size());
+        ASSERT_EQ(getSortedTokens(swappedOutput), getSortedTokens(input)) << swappedOutput;
+    }
+
+    // Tokens starting before the minimum seed index are never selected; a single eligible token cannot be swapped.
+
+    const size_t lastTokenIndex{input.size() - 1u};
+
+    vmf::StorageEntry* newEntry{storage_->createNewEntry()};
+
+    SwapWords(newEntry, input.size(), input.data(), 2u, lastTokenIndex, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), input);
+
+    newEntry = storage_->createNewEntry();
+
+    DeleteWord(newEntry, input.size(), input.data(), 2u, lastTokenIndex, testCaseKey_);
+
+    EXPECT_EQ(GetOutput(newEntry), input.substr(0u, lastTokenIndex));
+
+    newEntry = storage_->createNewEntry();
+
+    EXPECT_THROW(DeleteWord(newEntry, 0u, input.data(), 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(SwapWords(newEntry, input.size(), nullptr, 1u, 0u, testCaseKey_), RuntimeException);
+    EXPECT_THROW(RepeatWord(newEntry, input.size(), input.data(), 1u, input.size(), testCaseKey_), RuntimeException);
+}
+}
@@ -0,0 +1,106 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "workStealingDequeTest.h"
+
+namespace vmf::test::modules::radamsa::mutations
+{
+TEST(WorkStealingDequeTest, TestTrySteal)
+{
+    using ::vmf::radamsa::mutations::WorkStealingDeque;
+
+    WorkStealingDeque<int> deque;
+
+    int value{0};
+
+    ASSERT_FALSE(deque.TryPop(value));
+    ASSERT_FALSE(deque.TrySteal(value));
+
+    // The owner takes the newest task and thieves take the oldest one.
+
+    for (int it{0}; it < 4; ++it)
+        deque.Push(int{it});
+
+    ASSERT_TRUE(deque.TryPop(value));
+    ASSERT_EQ(value, 3);
+
+    ASSERT_TRUE(deque.TrySteal(value));
+    ASSERT_EQ(value, 0);
+
+    ASSERT_TRUE(deque.TryPop(value));
+    ASSERT_EQ(value, 2);
+
+    ASSERT_TRUE(deque.TrySteal(value));
+    ASSERT_EQ(value, 1);
+
+    ASSERT_FALSE(deque.TryPop(value));
+
+    // Tasks pushed together keep their order.
+
+    deque.PushAll({4, 5, 6});
+
+    ASSERT_TRUE(deque.TryPop(value));
+    ASSERT_EQ(value, 6);
+
+    ASSERT_TRUE(deque.TrySteal(value));
+    ASSERT_EQ(value, 4);
+
+    ASSERT_TRUE(deque.TryPop(value));
+    ASSERT_EQ(value, 5);
+
+    ASSERT_FALSE(deque.TrySteal(value));
+
+    // An owner and several thieves take every task exactly once.
+
+    constexpr int numberOfTasks{100000};
+
+    for (int it{0}; it < numberOfTasks; ++it)
+        deque.Push(int{it});
+
+    std::vector<std::vector<int>> takenTasks(4u);
+    std::vector<std::thread> workers;
+
+    for (size_t it{0u}; it < takenTasks.size(); ++it)
+        workers.emplace_back(
+                        [&, it]()
+                        {
+                            int task{0};
+
+                            while (it == 0u ? deque.TryPop(task) : deque.TrySteal(task))
+                                takenTasks[it].push_back(task);
+                        });
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    std::vector<int> allTasks;
+
+    for (const std::vector<int>& tasks : takenTasks)
+        allTasks.insert(allTasks.end(), tasks.begin(), tasks.end());
+
+    std::sort(allTasks.begin(), allTasks.end());
+
+    ASSERT_EQ(allTasks.size(), static_cast<size_t>(numberOfTasks));
+
+    for (int it{0}; it < numberOfTasks; ++it)
+        ASSERT_EQ(allTasks[it], it);
+}
+}
@@ -0,0 +1,497 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+// VMF Includes
+#include "ModuleFactory.hpp"
+#include "Logging.hpp"
+#include "radamsaInputGenerator.hpp"
+
+namespace vmf
+{
+REGISTER_MODULE(vmf::modules::radamsa::RadamsaInputGenerator);
+}
+
+vmf::Module* vmf::modules::radamsa::RadamsaInputGenerator::build(std::string name) { return new RadamsaInputGenerator(name); }
+
+vmf::modules::radamsa::RadamsaInputGenerator::~RadamsaInputGenerator()
+{
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+
+        isStopping_ = true;
+    }
+
+    workCondition_.notify_all();
+
+    for (std::thread& worker : workers_)
+        worker.join();
+}
+
+void vmf::modules::radamsa::RadamsaInputGenerator::init(ConfigInterface& config)
+{
+    RadamsaMutator* mutator{nullptr};
+
+    for (Module* module : config.getSubModules(getModuleName()))
+    {
+        RadamsaMutator* radamsaMutator{dynamic_cast<RadamsaMutator*>(module)};
+
+        if (radamsaMutator == nullptr)
+            continue;
+
+        if (mutator != nullptr)
+            throw RuntimeException{"RadamsaInputGenerator requires exactly one RadamsaMutator submodule", RuntimeException::USAGE_ERROR};
+
+        mutator = radamsaMutator;
+    }
+
+    if (mutator == nullptr)
+        throw RuntimeException{"RadamsaInputGenerator requires exactly one RadamsaMutator submodule", RuntimeException::USAGE_ERROR};
+
+    const int numberOfTestCases{config.getIntParam(getModuleName(), "numberOfTestCases", 64)};
+    const int childrenPerBase{config.getIntParam(getModuleName(), "childrenPerBase", 8)};
+    const int numberOfWorkers{config.getIntParam(getModuleName(), "workers", 0)};
+
+    if (numberOfTestCases <= 0 || childrenPerBase <= 0)
+        throw RuntimeException{
+                        "RadamsaInputGenerator numberOfTestCases and childrenPerBase must be positive",
+                        RuntimeException::USAGE_ERROR};
+
+    if (numberOfWorkers < 0)
+        throw RuntimeException{
+                        "RadamsaInputGenerator workers must not be negative",
+                        RuntimeException::USAGE_ERROR};
+
+    numberOfTestCases_ = static_cast<size_t>(numberOfTestCases);
+    childrenPerBase_ = static_cast<size_t>(childrenPerBase);
+
+    // Calibration probes are executed like any other new entry, and their coverage is read back from coverageKey.
+
+    isEffectorCalibrationEnabled_ = config.getBoolParam(getModuleName(), "effectorCalibration", false);
+
+    if (isEffectorCalibrationEnabled_)
+    {
+        const int effectorBlockSize{config.getIntParam(getModuleName(), "effectorBlockSize", 8)};
+
+        if (effectorBlockSize <= 0)
+            throw RuntimeException{
+                            "RadamsaInputGenerator effectorBlockSize must be positive",
+                            RuntimeException::USAGE_ERROR};
+
+        effectorBlockSize_ = static_cast<size_t>(effectorBlockSize);
+        coverageKeyName_ = config.getStringParam(getModuleName(), "coverageKey", "AFL_TRACE_BITS");
+    }
+
+    // Zero workers means one per hardware thread.
+
+    const size_t workerCount{numberOfWorkers > 0 ? static_cast<size_t>(numberOfWorkers) : std::max<size_t>(std::thread::hardware_concurrency(), 1u)};
+
+    // With the framework seed set, base selection and every worker stream are derived from it.
+
+    isDeterministic_ = config.isParam("vmfFramework", "seed");
+
+    // Each worker keeps its own random number stream and per-seed state, so the outputs depend on the number of
+    // workers; the hardware default would make a seeded run differ between machines.
+
+    if (isDeterministic_ && numberOfWorkers == 0)
+        throw RuntimeException{
+                        "RadamsaInputGenerator requires an explicit workers count when vmfFramework.seed is set",
+                        RuntimeException::USAGE_ERROR};
+
+    if (isDeterministic_)
+        RANDOM_NUMBER_GENERATOR_.seed(static_cast<std::default_random_engine::result_type>(config.getIntParam("vmfFramework", "seed")));
+
+    for (size_t it{0u}; it < workerCount; ++it)
+    {
+        workerMutators_.push_back(mutator->CreateWorker(config, RANDOM_NUMBER_GENERATOR_()));
+        taskQueues_.push_back(std::make_unique<vmf::radamsa::mutations::WorkStealingDeque<Task>>());
+    }
+
+    for (size_t it{0u}; it < workerCount; ++it)
+        workers_.emplace_back(&RadamsaInputGenerator::RunWorker, this, it);
+
+    LOG_INFO << "RadamsaInputGenerator started " << workerCount << " workers" << (isDeterministic_ ? " without work stealing" : "");
+}
+
+void vmf::modules::radamsa::RadamsaInputGenerator::registerStorageNeeds(StorageRegistry& registry)
+{
+    testCaseKey_ = registry.registerKey(
+                                    "TEST_CASE",
+                                    StorageRegistry::BUFFER,
+                                    StorageRegistry::READ_WRITE);
+
+    if (isEffectorCalibrationEnabled_)
+    {
+        coverageKey_ = registry.registerKey(
+                                        coverageKeyName_,
+                                        StorageRegistry::BUFFER,
+                                        StorageRegistry::READ_ONLY);
+        hungTag_ = registry.registerTag(
+                                    "HUNG",
+                                    StorageRegistry::READ_ONLY);
+        crashedTag_ = registry.registerTag(
+                                        "CRASHED",
+                                        StorageRegistry::READ_ONLY);
+        effectorMapKey_ = registry.registerKey(
+                                        "RADAMSA_EFFECTOR_MAP",
+                                        StorageRegistry::BUFFER,
+                                        StorageRegistry::READ_WRITE);
+    }
+
+    // The worker mutators are not known to the framework, so their storage needs are registered here.
+
+    for (const std::unique_ptr<RadamsaMutator>& workerMutator : workerMutators_)
+        workerMutator->registerStorageNeeds(registry);
+}
+
+void vmf::modules::radamsa::RadamsaInputGenerator::addNewTestCases(StorageModule& storage)
+{
+    std::unique_ptr<Iterator> savedEntries{storage.getSavedEntries()};
+
+    const int numberOfSavedEntries{savedEntries->getSize()};
+
+    if (numberOfSavedEntries <= 0)
+        throw RuntimeException{"RadamsaInputGenerator requires at least one saved entry to mutate", RuntimeException::USAGE_ERROR};
+
+    // Calibration probes of the saved entries take precedence over their children.
+
+    const size_t numberOfProbes{isEffectorCalibrationEnabled_ ? AddCalibrationProbes(storage, numberOfTestCases_) : 0u};
+
+    // Bases are selected and new entries are created here, in a fixed order, before any worker runs.
+
+    std::vector<Task> tasks;
+
+    for (size_t firstChild{numberOfProbes}; firstChild < numberOfTestCases_; firstChild += childrenPerBase_)
+    {
+        Task task;
+
+        task.Storage = &storage;
+        task.BaseEntry = savedEntries->setIndexTo(static_cast<int>(SelectBaseIndex(static_cast<size_t>(numberOfSavedEntries))));
+
+        for (size_t it{firstChild}; it < std::min(firstChild + childrenPerBase_, numberOfTestCases_); ++it)
+            task.NewEntries.push_back(storage.createNewEntry());
+
+        // The workers cannot read the storage module while others mutate, so each child that may recombine with
+        // another saved entry gets one picked here.
+
+        if (workerMutators_.front()->IsRecombining())
+        {
+            std::uniform_int_distribution<int> distribution(0, numberOfSavedEntries - 1);
+
+            for (size_t it{0u}; it < task.NewEntries.size(); ++it)
+                task.OtherEntries.push_back(savedEntries->setIndexTo(distribution(RANDOM_NUMBER_GENERATOR_)));
+        }
+
+        tasks.push_back(std::move(task));
+    }
+
+    RunTasks(tasks);
+}
+
+bool vmf::modules::radamsa::RadamsaInputGenerator::examineTestCaseResults(StorageModule& storage)
+{
+    if (probes_.empty())
+        return false;
+
+    // A block is effective when inverting it changed the coverage of the seed, or made it hang or crash. Any other
+    // probe without coverage leaves its block unknown, and a seed with unknown blocks gets no effector map, so that
+    // it is mutated as usual.
+
+    std::unique_ptr<Iterator> newEntries{storage.getNewEntries()};
+
+    while (newEntries->hasNext())
+    {
+        StorageEntry* entry{newEntries->getNext()};
+
+        const auto probe{probes_.find(entry->getID())};
+
+        if (probe == probes_.end())
+            continue;
+
+        const unsigned long seedId{probe->second.first};
+        const size_t blockIndex{probe->second.second};
+
+        probes_.erase(probe);
+
+        const auto calibration{calibrations_.find(seedId)};
+
+        if (calibration == calibrations_.end())
+            continue;
+
+        const int coverageSize{entry->getBufferSize(coverageKey_)};
+
+        if (entry->hasTag(hungTag_) || entry->hasTag(crashedTag_))
+            calibration->second.EffectiveBlocks[blockIndex] = true;
+        else if (coverageSize <= 0)
+            ++calibration->second.NumberOfUnknownBlocks;
+        else if (GetCoverageHash(entry->getBufferPointer(coverageKey_), static_cast<size_t>(coverageSize)) != calibration->second.CoverageHash)
+            calibration->second.EffectiveBlocks[blockIndex] = true;
+
+        if (++calibration->second.NumberOfResults == calibration->second.NumberOfBlocks)
+        {
+            if (calibration->second.NumberOfUnknownBlocks == 0u)
+                WriteEffectorMap(storage, seedId, calibration->second);
+            else
+                LOG_WARNING << "RadamsaInputGenerator got " << calibration->second.NumberOfUnknownBlocks << " of "
+                            << calibration->second.NumberOfBlocks << " calibration probes of seed " << seedId
+                            << " back without a " << coverageKeyName_ << " buffer, so the seed gets no effector map";
+
+            calibrations_.erase(calibration);
+        }
+    }
+
+    return false;
+}
+
+size_t vmf::modules::radamsa::RadamsaInputGenerator::AddCalibrationProbes(StorageModule& storage, const size_t maximumNumberOfProbes)
+{
+    // Every saved entry that has not been seen yet is queued for calibration. Entries without coverage cannot be
+    // compared against, so they are never calibrated.
+
+    std::unique_ptr<Iterator> savedEntries{storage.getSavedEntries()};
+
+    while (savedEntries->hasNext())
+    {
+        StorageEntry* entry{savedEntries->getNext()};
+
+        if (!calibratedIds_.insert(entry->getID()).second)
+            continue;
+
+        const int size{entry->getBufferSize(testCaseKey_)};
+        const int coverageSize{entry->getBufferSize(coverageKey_)};
+
+        if (size <= 0 || coverageSize <= 0)
+            continue;
+
+        Calibration calibration;
+
+        calibration.BlockSize = std::max(effectorBlockSize_, (static_cast<size_t>(size) + MAXIMUM_NUMBER_OF_PROBES_ - 1u) / MAXIMUM_NUMBER_OF_PROBES_);
+        calibration.NumberOfBlocks = (static_cast<size_t>(size) + calibration.BlockSize - 1u) / calibration.BlockSize;
+        calibration.CoverageHash = GetCoverageHash(entry->getBufferPointer(coverageKey_), static_cast<size_t>(coverageSize));
+        calibration.EffectiveBlocks.assign(calibration.NumberOfBlocks, false);
+
+        calibrations_.emplace(entry->getID(), std::move(calibration));
+        pendingCalibrationIds_.push_back(entry->getID());
+    }
+
+    // A seed with more blocks than fit into one call is probed over several calls.
+
+    size_t numberOfProbes{0u};
+
+    while (numberOfProbes < maximumNumberOfProbes && !pendingCalibrationIds_.empty())
+    {
+        const unsigned long seedId{pendingCalibrationIds_.front()};
+
+        StorageEntry* seedEntry{storage.getEntryByID(seedId)};
+        Calibration& calibration{calibrations_.at(seedId)};
+
+        if (seedEntry == nullptr)
+        {
+            calibrations_.erase(seedId);
+            pendingCalibrationIds_.pop_front();
+
+            continue;
+        }
+
+        const size_t size{static_cast<size_t>(seedEntry->getBufferSize(testCaseKey_))};
+        const char* buffer{seedEntry->getBufferPointer(testCaseKey_)};
+
+        for (; numberOfProbes < maximumNumberOfProbes && calibration.NextBlockIndex < calibration.NumberOfBlocks; ++numberOfProbes)
+        {
+            const size_t blockStartIndex{calibration.NextBlockIndex * calibration.BlockSize};
+            const size_t blockEndIndex{std::min(blockStartIndex + calibration.BlockSize, size)};
+
+            // A probe is null-terminated like every output of the mutator.
+
+            StorageEntry* probe{storage.createNewEntry()};
+            char* probeBuffer{probe->allocateBuffer(testCaseKey_, static_cast<int>(size + 1u))};
+
+            memcpy(probeBuffer, buffer, size);
+
+            probeBuffer[size] = '\0';
+
+            for (size_t it{blockStartIndex}; it < blockEndIndex; ++it)
+                probeBuffer[it] = static_cast<char>(~probeBuffer[it]);
+
+            probes_.emplace(probe->getID(), std::make_pair(seedId, calibration.NextBlockIndex++));
+        }
+
+        if (calibration.NextBlockIndex == calibration.NumberOfBlocks)
+            pendingCalibrationIds_.pop_front();
+    }
+
+    return numberOfProbes;
+}
+
+void vmf::modules::radamsa::RadamsaInputGenerator::WriteEffectorMap(StorageModule& storage, const unsigned long seedId, const Calibration& calibration)
+{
+    StorageEntry* seedEntry{storage.getEntryByID(seedId)};
+
+    if (seedEntry == nullptr)
+        return;
+
+    // Bit i % 8 of byte i / 8 is set for every byte i of an effective block.
+
+    const size_t size{static_cast<size_t>(seedEntry->getBufferSize(testCaseKey_))};
+    const size_t effectorMapSize{(size + 7u) / 8u};
+
+    char* effectorMap{seedEntry->allocateBuffer(effectorMapKey_, static_cast<int>(effectorMapSize))};
+
+    memset(effectorMap, 0, effectorMapSize);
+
+    for (size_t it{0u}; it < size; ++it)
+        if (calibration.EffectiveBlocks[it / calibration.BlockSize])
+            effectorMap[it / 8u] = static_cast<char>(effectorMap[it / 8u] | (0x01 << (it % 8u)));
+}
+
+uint64_t vmf::modules::radamsa::RadamsaInputGenerator::GetCoverageHash(const char* buffer, const size_t size) noexcept
+{
+    // Hit counts are reduced to the AFL buckets (1, 2, 3, 4-7, 8-15, 16-31, 32-127, 128+) before hashing, so that
+    // a loop that runs a few more times does not make a block effective.
+
+    static const std::array<uint8_t, 256u> buckets{
+                                                []()
+                                                {
+                                                    std::array<uint8_t, 256u> counts{};
+
+                                                    for (size_t it{1u}; it < counts.size(); ++it)
+                                                        counts[it] = (it <= 3u) ? static_cast<uint8_t>(it) :
+                                                                     (it <= 7u) ? 4u :
+                                                                     (it <= 15u) ? 5u :
+                                                                     (it <= 31u) ? 6u :
+                                                                     (it <= 127u) ? 7u : 8u;
+
+                                                    return counts;
+                                                }()};
+
+    // 64-bit FNV-1a.
+
+    uint64_t hash{0xcbf29ce484222325u};
+
+    for (size_t it{0u}; it < size; ++it)
+    {
+        hash ^= buckets[static_cast<uint8_t>(buffer[it])];
+        hash *= 0x100000001b3u;
+    }
+
+    return hash;
+}
+
+size_t vmf::modules::radamsa::RadamsaInputGenerator::SelectBaseIndex(const size_t numberOfSavedEntries)
+{
+    // Storage is sorted by fitness, so the square of a uniform draw favours the front: the first quarter of the
+    // entries is selected half of the time.
+
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    const double draw{distribution(RANDOM_NUMBER_GENERATOR_)};
+
+    return std::min(static_cast<size_t>(draw * draw * static_cast<double>(numberOfSavedEntries)), numberOfSavedEntries - 1u);
+}
+
+void vmf::modules::radamsa::RadamsaInputGenerator::RunTasks(std::vector<Task>& tasks)
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+
+    remainingTasks_ = tasks.size();
+    workerException_ = nullptr;
+
+    // A worker still draining the previous batch may pop without holding mutex_, so each deque receives its tasks
+    // in one step; otherwise the order a worker pops them in, and with it a deterministic run, would depend on timing.
+
+    std::vector<std::vector<Task>> queueTasks(taskQueues_.size());
+
+    for (size_t it{0u}; it < tasks.size(); ++it)
+        queueTasks[it % taskQueues_.size()].push_back(std::move(tasks[it]));
+
+    for (size_t it{0u}; it < taskQueues_.size(); ++it)
+        taskQueues_[it]->PushAll(std::move(queueTasks[it]));
+
+    ++batch_;
+
+    workCondition_.notify_all();
+
+    doneCondition_.wait(lock, [&]() { return remainingTasks_ == 0u; });
+
+    if (workerException_ != nullptr)
+        std::rethrow_exception(workerException_);
+}
+
+bool vmf::modules::radamsa::RadamsaInputGenerator::PopTask(const size_t workerIndex, Task& task)
+{
+    if (taskQueues_[workerIndex]->TryPop(task))
+        return true;
+
+    if (isDeterministic_)
+        return false;
+
+    for (size_t it{1u}; it < taskQueues_.size(); ++it)
+        if (taskQueues_[(workerIndex + it) % taskQueues_.size()]->TrySteal(task))
+            return true;
+
+    return false;
+}
+
+void vmf::modules::radamsa::RadamsaInputGenerator::RunWorker(const size_t workerIndex)
+{
+    uint64_t batch{0u};
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+
+            workCondition_.wait(lock, [&]() { return isStopping_ || batch_ != batch; });
+
+            if (isStopping_)
+                return;
+
+            batch = batch_;
+        }
+
+        Task task;
+
+        while (PopTask(workerIndex, task))
+        {
+            std::exception_ptr exception;
+
+            try
+            {
+                workerMutators_[workerIndex]->MutateWorkerTestCases(*task.Storage, task.BaseEntry, task.NewEntries, task.OtherEntries, testCaseKey_);
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+
+            const std::lock_guard<std::mutex> lock{mutex_};
+
+            if (exception != nullptr && workerException_ == nullptr)
+                workerException_ = exception;
+
+            if (--remainingTasks_ == 0u)
+                doneCondition_.notify_all();
+        }
+    }
+}
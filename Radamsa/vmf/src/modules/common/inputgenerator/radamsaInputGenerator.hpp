@@ -0,0 +1,170 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// VMF Includes
+#include "InputGeneratorModule.hpp"
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+#include "radamsaMutator.hpp"
+#include "workStealingDeque.hpp"
+
+namespace vmf::modules::radamsa
+{
+/**
+ * @brief Input generator that mutates the corpus with RadamsaMutator on several worker threads.
+ *
+ * Every call to addNewTestCases selects base entries from the saved entries, favouring the front of storage
+ * where the fittest entries are sorted, and creates the new entries for their children on the calling thread.
+ * Each base entry and its children form one task, and the tasks are dealt round robin onto one deque per
+ * worker.  A worker mutates with its own RadamsaMutator, created from the configuration of the RadamsaMutator
+ * submodule, and steals from the other deques once its own is empty.  The call returns when every task is done.
+ *
+ * Since the new entries are created before any worker runs, they reach storage in the same order on every run.
+ * When the framework seed is set, stealing is disabled so that every worker mutates the same tasks in the same
+ * order on every run, and the outputs are reproducible as well.
+ *
+ * With effector calibration, every saved entry is probed once before it is mutated: each probe is a copy of
+ * the entry with one block of bytes inverted.  The blocks whose probe changed the coverage are recorded in an
+ * effector map, one bit per byte, that is written to the entry for RadamsaMutator to read.
+ */
+class RadamsaInputGenerator: public InputGeneratorModule
+{
+public:
+    RadamsaInputGenerator() = delete;
+    virtual ~RadamsaInputGenerator();
+
+    RadamsaInputGenerator(std::string name) noexcept : InputGeneratorModule{name} {}
+
+    RadamsaInputGenerator(const RadamsaInputGenerator&) = delete;
+    RadamsaInputGenerator(RadamsaInputGenerator&&) = delete;
+
+    RadamsaInputGenerator& operator=(const RadamsaInputGenerator&) = delete;
+    RadamsaInputGenerator& operator=(RadamsaInputGenerator&&) = delete;
+
+    ////////////////////////////////////
+    // InputGeneratorModule Interface //
+    ////////////////////////////////////
+    virtual void init(ConfigInterface& config);
+
+    virtual void registerStorageNeeds(StorageRegistry& registry);
+
+    virtual void addNewTestCases(StorageModule& storage);
+
+    virtual bool examineTestCaseResults(StorageModule& storage);
+
+    static Module* build(std::string name);
+
+protected:
+    struct Task
+    {
+        StorageModule* Storage{nullptr};
+        StorageEntry* BaseEntry{nullptr};
+        std::vector<StorageEntry*> NewEntries;
+        std::vector<StorageEntry*> OtherEntries; // Saved entries the recombining algorithm types draw from.
+    };
+
+    /**
+     * @brief Probing state of a saved entry, from the first probe until the result of its last probe is examined.
+     */
+    struct Calibration
+    {
+        size_t BlockSize{0u};
+        size_t NumberOfBlocks{0u};
+        size_t NextBlockIndex{0u};
+        size_t NumberOfResults{0u};
+        size_t NumberOfUnknownBlocks{0u}; // Blocks whose probe came back without coverage, hang or crash.
+        uint64_t CoverageHash{0u};
+        std::vector<bool> EffectiveBlocks;
+    };
+
+    size_t SelectBaseIndex(const size_t numberOfSavedEntries);
+
+    size_t AddCalibrationProbes(StorageModule& storage, const size_t maximumNumberOfProbes);
+
+    void WriteEffectorMap(StorageModule& storage, const unsigned long seedId, const Calibration& calibration);
+
+    static uint64_t GetCoverageHash(const char* buffer, const size_t size) noexcept;
+
+    void RunTasks(std::vector<Task>& tasks);
+
+    void RunWorker(const size_t workerIndex);
+
+    bool PopTask(const size_t workerIndex, Task& task);
+
+    std::default_random_engine RANDOM_NUMBER_GENERATOR_;
+
+private:
+    static constexpr int INVALID_TEST_CASE_KEY_{std::numeric_limits<int>::min()};
+
+    int testCaseKey_{INVALID_TEST_CASE_KEY_};
+    size_t numberOfTestCases_{0u};
+    size_t childrenPerBase_{0u};
+    bool isDeterministic_{false};
+
+    // Effector calibration state; only used when the effectorCalibration parameter is set. A seed is probed in
+    // blocks of at least effectorBlockSize_ bytes, and of more on seeds that would otherwise need more probes.
+
+    static constexpr size_t MAXIMUM_NUMBER_OF_PROBES_{1024u};
+
+    bool isEffectorCalibrationEnabled_{false};
+    size_t effectorBlockSize_{0u};
+    int coverageKey_{INVALID_TEST_CASE_KEY_};
+    int hungTag_{INVALID_TEST_CASE_KEY_};
+    int crashedTag_{INVALID_TEST_CASE_KEY_};
+    int effectorMapKey_{INVALID_TEST_CASE_KEY_};
+    std::string coverageKeyName_;
+    std::unordered_set<unsigned long> calibratedIds_;
+    std::unordered_map<unsigned long, Calibration> calibrations_;
+    std::deque<unsigned long> pendingCalibrationIds_;
+    std::unordered_map<unsigned long, std::pair<unsigned long, size_t>> probes_;  // Seed ID and block index of each probe.
+
+    std::vector<std::unique_ptr<RadamsaMutator>> workerMutators_;
+    std::vector<std::unique_ptr<vmf::radamsa::mutations::WorkStealingDeque<Task>>> taskQueues_;
+    std::vector<std::thread> workers_;
+
+    // The workers wait on workCondition_ for a new batch of tasks, and the calling thread waits on doneCondition_
+    // for the batch to finish. Everything below is guarded by mutex_.
+
+    std::mutex mutex_;
+    std::condition_variable workCondition_;
+    std::condition_variable doneCondition_;
+    uint64_t batch_{0u};
+    size_t remainingTasks_{0u};
+    bool isStopping_{false};
+    std::exception_ptr workerException_;
+};
+}
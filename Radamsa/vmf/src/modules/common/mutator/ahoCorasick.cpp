@@ -0,0 +1,120 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <queue>
+
+// VMF Includes
+#include "ahoCorasick.hpp"
+#include "RuntimeException.hpp"
+
+vmf::radamsa::mutations::AhoCorasick::AhoCorasick(const std::vector<std::string>& tokens)
+{
+    if (tokens.size() >= NO_TOKEN)
+        throw RuntimeException{"Too many dictionary tokens", RuntimeException::USAGE_ERROR};
+
+    // Give every byte that appears in a token its own class.
+
+    for (const std::string& token : tokens)
+        for (const char character : token)
+            if (byteClasses_[static_cast<uint8_t>(character)] == 0u)
+                byteClasses_[static_cast<uint8_t>(character)] = static_cast<uint16_t>(numberOfByteClasses_++);
+
+    // Build the trie directly in the transition table, where 0 marks a missing edge since no edge leads back to the root.
+
+    auto addState{
+            [&]()
+            {
+                transitions_.resize(transitions_.size() + numberOfByteClasses_, 0u);
+                stateTokens_.push_back(NO_TOKEN);
+                outputLinks_.push_back(NO_TOKEN);
+
+                return static_cast<uint32_t>(stateTokens_.size() - 1u);
+            }};
+
+    addState();
+
+    for (size_t tokenIndex{0u}; tokenIndex < tokens.size(); ++tokenIndex)
+    {
+        const std::string& token{tokens[tokenIndex]};
+
+        tokenLengths_.push_back(static_cast<uint32_t>(token.size()));
+
+        if (token.empty())
+            continue;
+
+        uint32_t state{0u};
+
+        for (const char character : token)
+        {
+            const size_t transitionIndex{static_cast<size_t>(state) * numberOfByteClasses_ + byteClasses_[static_cast<uint8_t>(character)]};
+
+            if (transitions_[transitionIndex] == 0u)
+            {
+                const uint32_t nextState{addState()};
+
+                transitions_[transitionIndex] = nextState;
+            }
+
+            state = transitions_[transitionIndex];
+        }
+
+        // Duplicate tokens are reported once, under their first index.
+
+        if (stateTokens_[state] == NO_TOKEN)
+            stateTokens_[state] = static_cast<uint32_t>(tokenIndex);
+    }
+
+    // Fill in the missing edges breadth first: a missing edge of a state is the edge of its failure state.
+    // The failure states themselves are only needed during construction.
+
+    std::vector<uint32_t> failureLinks(stateTokens_.size(), 0u);
+    std::queue<uint32_t> states;
+
+    for (size_t byteClass{0u}; byteClass < numberOfByteClasses_; ++byteClass)
+        if (transitions_[byteClass] != 0u)
+            states.push(transitions_[byteClass]);
+
+    while (!states.empty())
+    {
+        const uint32_t state{states.front()};
+        const uint32_t failureState{failureLinks[state]};
+
+        states.pop();
+
+        for (size_t byteClass{0u}; byteClass < numberOfByteClasses_; ++byteClass)
+        {
+            uint32_t& transition{transitions_[static_cast<size_t>(state) * numberOfByteClasses_ + byteClass]};
+            const uint32_t failureTransition{transitions_[static_cast<size_t>(failureState) * numberOfByteClasses_ + byteClass]};
+
+            if (transition == 0u)
+            {
+                transition = failureTransition;
+
+                continue;
+            }
+
+            failureLinks[transition] = failureTransition;
+            outputLinks_[transition] = (stateTokens_[failureTransition] != NO_TOKEN) ? failureTransition : outputLinks_[failureTransition];
+
+            states.push(transition);
+        }
+    }
+}
@@ -0,0 +1,97 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Aho-Corasick automaton that finds every occurrence of a set of tokens in a single pass.
+ *
+ * The automaton is compiled into a complete DFA stored as one flat transition table, indexed by
+ * state * numberOfByteClasses + byteClass.  Bytes that appear in no token share byte class 0, so the
+ * width of the table is the number of distinct token bytes plus one rather than 256.  Matching costs
+ * one table lookup per input byte plus one step per reported occurrence.
+ */
+class AhoCorasick
+{
+public:
+    static constexpr uint32_t NO_TOKEN{std::numeric_limits<uint32_t>::max()};
+
+    AhoCorasick() = default;
+    ~AhoCorasick() = default;
+
+    AhoCorasick(const AhoCorasick&) = delete;
+    AhoCorasick(AhoCorasick&&) = default;
+
+    AhoCorasick& operator=(const AhoCorasick&) = delete;
+    AhoCorasick& operator=(AhoCorasick&&) = default;
+
+    /**
+     * @brief Compiles the automaton; token indices reported by ForEachMatch are indices into tokens.
+     */
+    explicit AhoCorasick(const std::vector<std::string>& tokens);
+
+    size_t GetNumberOfStates() const noexcept { return stateTokens_.size(); }
+
+    /**
+     * @brief Calls visitor(startIndex, tokenIndex) for every occurrence of every token, in order of their end index.
+     */
+    template<typename Visitor>
+    void ForEachMatch(const char* const buffer, const size_t size, Visitor&& visitor) const
+    {
+        if (tokenLengths_.empty())
+            return;
+
+        uint32_t state{0u};
+
+        for (size_t it{0u}; it < size; ++it)
+        {
+            state = transitions_[static_cast<size_t>(state) * numberOfByteClasses_ + byteClasses_[static_cast<uint8_t>(buffer[it])]];
+
+            // Report the token that ends in this state, then every shorter token that is a suffix of it.
+
+            for (uint32_t outputState{(stateTokens_[state] != NO_TOKEN) ? state : outputLinks_[state]};
+                 outputState != NO_TOKEN;
+                 outputState = outputLinks_[outputState])
+            {
+                const uint32_t tokenIndex{stateTokens_[outputState]};
+
+                visitor(it + 1u - tokenLengths_[tokenIndex], static_cast<size_t>(tokenIndex));
+            }
+        }
+    }
+
+private:
+    std::array<uint16_t, 256u> byteClasses_{};
+    size_t numberOfByteClasses_{1u};
+
+    std::vector<uint32_t> transitions_;  // Complete DFA, numberOfByteClasses_ entries per state.
+    std::vector<uint32_t> stateTokens_;  // Token that ends exactly in each state, or NO_TOKEN.
+    std::vector<uint32_t> outputLinks_;  // Nearest state on the failure chain that ends a token, or NO_TOKEN.
+    std::vector<uint32_t> tokenLengths_;
+};
+}
@@ -0,0 +1,94 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "aliasTable.hpp"
+#include "RuntimeException.hpp"
+
+vmf::radamsa::mutations::AliasTable::AliasTable(const std::vector<double>& weights) : probabilities_(weights.size(), 1.0),
+                                                                                     aliases_(weights.size(), 0u)
+{
+    double totalWeight{0.0};
+
+    for (const double weight : weights)
+    {
+        if (!(weight >= 0.0))
+            throw RuntimeException{"Alias table weights must not be negative", RuntimeException::USAGE_ERROR};
+
+        totalWeight += weight;
+    }
+
+    if (weights.empty() || !(totalWeight > 0.0))
+        throw RuntimeException{"Alias table weights must have a positive sum", RuntimeException::USAGE_ERROR};
+
+    // Scale the weights so that their mean is one, then repeatedly fill the column of an index below the mean
+    // with the excess of an index above it.
+
+    std::vector<double> scaledWeights(weights.size());
+    std::vector<size_t> smallIndices;
+    std::vector<size_t> largeIndices;
+
+    for (size_t it{0u}; it < weights.size(); ++it)
+    {
+        scaledWeights[it] = weights[it] * static_cast<double>(weights.size()) / totalWeight;
+
+        (scaledWeights[it] < 1.0 ? smallIndices : largeIndices).push_back(it);
+    }
+
+    while (!smallIndices.empty() && !largeIndices.empty())
+    {
+        const size_t smallIndex{smallIndices.back()};
+        const size_t largeIndex{largeIndices.back()};
+
+        smallIndices.pop_back();
+
+        probabilities_[smallIndex] = scaledWeights[smallIndex];
+        aliases_[smallIndex] = largeIndex;
+
+        scaledWeights[largeIndex] -= 1.0 - scaledWeights[smallIndex];
+
+        if (scaledWeights[largeIndex] < 1.0)
+        {
+            largeIndices.pop_back();
+            smallIndices.push_back(largeIndex);
+        }
+    }
+
+    // Whatever is left is one up to rounding errors, so those columns always keep their own index.
+
+    for (const size_t index : smallIndices)
+        probabilities_[index] = 1.0;
+
+    for (const size_t index : largeIndices)
+        probabilities_[index] = 1.0;
+}
+
+size_t vmf::radamsa::mutations::AliasTable::Sample(std::default_random_engine& randomNumberGenerator) const
+{
+    if (probabilities_.empty())
+        throw RuntimeException{"Cannot sample from an empty alias table", RuntimeException::UNEXPECTED_ERROR};
+
+    std::uniform_int_distribution<size_t> indexDistribution(0u, probabilities_.size() - 1u);
+    std::uniform_real_distribution<double> probabilityDistribution(0.0, 1.0);
+
+    const size_t index{indexDistribution(randomNumberGenerator)};
+
+    return (probabilityDistribution(randomNumberGenerator) < probabilities_[index]) ? index : aliases_[index];
+}
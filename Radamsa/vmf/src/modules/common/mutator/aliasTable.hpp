@@ -0,0 +1,61 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <random>
+#include <vector>
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Vose alias table for sampling indices from a fixed discrete distribution.
+ *
+ * Building the table from n weights takes O(n) time; every sample afterwards takes one uniform index
+ * and one uniform real, whatever the number of weights and however skewed they are.
+ */
+class AliasTable
+{
+public:
+    AliasTable() = default;
+    ~AliasTable() = default;
+
+    AliasTable(const AliasTable&) = default;
+    AliasTable(AliasTable&&) = default;
+
+    AliasTable& operator=(const AliasTable&) = default;
+    AliasTable& operator=(AliasTable&&) = default;
+
+    /**
+     * @brief Builds the table; index i is sampled with probability weights[i] / sum(weights).
+     *
+     * Throws a RuntimeException when there are no weights, a weight is negative, or every weight is zero.
+     */
+    explicit AliasTable(const std::vector<double>& weights);
+
+    size_t GetSize() const noexcept { return probabilities_.size(); }
+
+    size_t Sample(std::default_random_engine& randomNumberGenerator) const;
+
+private:
+    std::vector<double> probabilities_; // Probability of keeping the column's own index rather than its alias.
+    std::vector<size_t> aliases_;
+};
+}
@@ -0,0 +1,221 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+// VMF Includes
+#include "asciiBadMutations.hpp"
+#include "simdScan.hpp"
+
+namespace
+{
+constexpr std::array<std::string_view, 8u> FORMAT_SPECIFIERS{"%n", "%s", "%x", "%p", "%d", "%c", "%99999999999s", "%.1024d"};
+constexpr std::array<std::string_view, 4u> PATH_TRAVERSAL_FRAGMENTS{"../", "..\\", "..%2f", "%2e%2e%2f"};
+constexpr std::array<char, 8u> CONTROL_CHARACTERS{'\0', '\r', '\n', '\t', '\b', '\f', '\x1b', '\x7f'};
+
+constexpr size_t MAXIMUM_FRAGMENT_REPETITIONS{64u};
+}
+
+vmf::radamsa::mutations::AsciiBadMutations::PrintableRunIndex vmf::radamsa::mutations::AsciiBadMutations::BuildPrintableRunIndex(
+                                                                                                                            const char* const buffer,
+                                                                                                                            const size_t size)
+{
+    PrintableRunIndex runIndex;
+
+    if (buffer == nullptr)
+        return runIndex;
+
+    // Printable text is the visible ASCII range plus horizontal tabs.
+
+    auto isPrintable{
+                [](const char* const block) -> uint64_t
+                {
+                    return simd::RangeMask(block, 0x20u, 0x7eu) | simd::EqualMask(block, '\t');
+                }};
+
+    size_t cumulativeSize{0u};
+
+    simd::ForEachRun(
+                buffer,
+                size,
+                isPrintable,
+                [&](const size_t startIndex, const size_t runSize)
+                {
+                    if (runSize < PrintableRunIndex::MINIMUM_RUN_SIZE)
+                        return;
+
+                    runIndex.Runs.push_back(PrintableRun{startIndex, runSize});
+                    runIndex.CumulativeSizes.push_back(cumulativeSize);
+
+                    cumulativeSize += runSize;
+                });
+
+    runIndex.CumulativeSizes.push_back(cumulativeSize);
+
+    return runIndex;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::AsciiBadMutations::PrintableRunIndex> vmf::radamsa::mutations::AsciiBadMutations::GetPrintableRunIndex(
+                                                                                                                                                const char* const buffer,
+                                                                                                                                                const size_t size,
+                                                                                                                                                const unsigned long seedId)
+{
+    return printableRunIndexCache_.GetOrBuild(
+                                        seedId,
+                                        [&]() { return BuildPrintableRunIndex(buffer, size); });
+}
+
+size_t vmf::radamsa::mutations::AsciiBadMutations::GetRandomInjectionIndex(
+                                                                        const PrintableRunIndex& runIndex,
+                                                                        const size_t originalSize,
+                                                                        const size_t minimumSeedIndex)
+{
+    // Number the printable bytes from the first run onward, skip the ones before the minimum seed index,
+    // pick one of the remaining ones at random and map it back to its run with a binary search.
+
+    const std::vector<PrintableRun>& runs{runIndex.Runs};
+    const std::vector<size_t>& cumulativeSizes{runIndex.CumulativeSizes};
+
+    const auto firstRun{
+                    std::partition_point(
+                                    runs.begin(),
+                                    runs.end(),
+                                    [&](const PrintableRun& run) { return run.StartIndex + run.Size <= minimumSeedIndex; })};
+
+    if (firstRun == runs.end())
+        return GetRandomValueWithinBounds(minimumSeedIndex, originalSize);
+
+    const size_t firstRunIndex{static_cast<size_t>(firstRun - runs.begin())};
+    const size_t firstRank{
+                        cumulativeSizes[firstRunIndex] +
+                        ((minimumSeedIndex > firstRun->StartIndex) ? (minimumSeedIndex - firstRun->StartIndex) : 0u)};
+
+    const size_t randomRank{GetRandomValueWithinBounds(firstRank, cumulativeSizes.back() - 1u)};
+
+    const size_t runNumber{
+                        static_cast<size_t>(
+                                    std::upper_bound(
+                                                cumulativeSizes.begin(),
+                                                cumulativeSizes.end(),
+                                                randomRank) - cumulativeSizes.begin()) - 1u};
+
+    return runs[runNumber].StartIndex + (randomRank - cumulativeSizes[runNumber]);
+}
+
+void vmf::radamsa::mutations::AsciiBadMutations::InjectBadString(
+                                                            StorageEntry* newEntry,
+                                                            const size_t originalSize,
+                                                            const char* originalBuffer,
+                                                            const unsigned long originalId,
+                                                            const size_t minimumSeedIndex,
+                                                            const int testCaseKey)
+{
+    // Consume the original buffer by injecting a bad string into a printable run and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const size_t injectionIndex{
+                            GetRandomInjectionIndex(
+                                            *GetPrintableRunIndex(originalBuffer, originalSize, originalId),
+                                            originalSize,
+                                            minimumSeedIndex)};
+
+    // Select the bad string and work out its size before allocating, so that it can be written straight into the new buffer.
+
+    const auto badStringType{
+                        static_cast<BadStringType>(
+                                            GetRandomValueWithinBounds(
+                                                                0u,
+                                                                static_cast<size_t>(BadStringType::Count) - 1u))};
+
+    std::string_view fragment;
+    size_t numberOfRepetitions{GetRandomValueWithinBounds(1u, MAXIMUM_FRAGMENT_REPETITIONS)};
+
+    switch (badStringType)
+    {
+    case BadStringType::FormatSpecifier:
+        fragment = FORMAT_SPECIFIERS[GetRandomValueWithinBounds(0u, FORMAT_SPECIFIERS.size() - 1u)];
+
+        break;
+    case BadStringType::PathTraversal:
+        fragment = PATH_TRAVERSAL_FRAGMENTS[GetRandomValueWithinBounds(0u, PATH_TRAVERSAL_FRAGMENTS.size() - 1u)];
+
+        break;
+    case BadStringType::RepeatedString:
+        numberOfRepetitions = GetRandomByteRepetitionLength();
+
+        break;
+    case BadStringType::ControlCharacter:
+        break;
+    default:
+        throw RuntimeException{"Invalid bad string type", RuntimeException::UNEXPECTED_ERROR};
+    }
+
+    const size_t badStringSize{fragment.empty() ? numberOfRepetitions : fragment.size() * numberOfRepetitions};
+
+    // The new buffer will be larger than the original buffer by the size of the bad string;
+    // additionally, it will contain one additional byte since a null-terminator will be appended to the end.
+
+    const size_t newBufferSize{originalSize + badStringSize + 1u};
+
+    char* newBuffer{newEntry->allocateBuffer(testCaseKey, static_cast<int>(newBufferSize))};
+    char* badString{newBuffer + injectionIndex};
+
+    memcpy(newBuffer, originalBuffer, injectionIndex);
+
+    switch (badStringType)
+    {
+    case BadStringType::RepeatedString:
+    {
+        // Repeat the printable character found at the injection point, or 'A' at the very end of the buffer.
+
+        const char repeatedCharacter{(injectionIndex < originalSize) ? originalBuffer[injectionIndex] : 'A'};
+
+        memset(badString, repeatedCharacter, badStringSize);
+
+        break;
+    }
+    case BadStringType::ControlCharacter:
+        for (size_t it{0u}; it < badStringSize; ++it)
+            badString[it] = CONTROL_CHARACTERS[GetRandomValueWithinBounds(0u, CONTROL_CHARACTERS.size() - 1u)];
+
+        break;
+    default:
+        for (size_t it{0u}; it < numberOfRepetitions; ++it)
+            memcpy(badString + it * fragment.size(), fragment.data(), fragment.size());
+
+        break;
+    }
+
+    memcpy(badString + badStringSize, originalBuffer + injectionIndex, originalSize - injectionIndex);
+    newBuffer[newBufferSize - 1u] = '\0';
+}
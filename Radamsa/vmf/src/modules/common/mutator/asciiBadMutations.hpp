@@ -0,0 +1,108 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "seedCache.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Implements the radamsa ascii bad mutation (ab).
+ *
+ * Injects strings that commonly upset text handling code (format specifiers, long repeated strings,
+ * path traversal fragments and control characters) into a printable text run of the input.
+ * The printable runs of a seed are found with a block classifier in a single pass and cached by
+ * storage entry ID; picking an injection point is then a binary search over the run sizes.
+ */
+class AsciiBadMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    struct PrintableRun
+    {
+        size_t StartIndex{0u};
+        size_t Size{0u};
+    };
+
+    struct PrintableRunIndex
+    {
+        // Runs shorter than this are mostly incidental bytes of binary data rather than text.
+
+        static constexpr size_t MINIMUM_RUN_SIZE{4u};
+
+        std::vector<PrintableRun> Runs;
+        std::vector<size_t> CumulativeSizes; // CumulativeSizes[i] is the total size of Runs[0] up to (but excluding) Runs[i].
+    };
+
+    enum class BadStringType : uint8_t
+    {
+        FormatSpecifier = 0u,
+        RepeatedString,
+        PathTraversal,
+        ControlCharacter,
+        Count
+    };
+
+    AsciiBadMutations() = delete;
+    virtual ~AsciiBadMutations() = default;
+
+    AsciiBadMutations(const AsciiBadMutations&) = delete;
+    AsciiBadMutations(AsciiBadMutations&&) = delete;
+
+    AsciiBadMutations& operator=(const AsciiBadMutations&) = delete;
+    AsciiBadMutations& operator=(AsciiBadMutations&&) = delete;
+
+    void InjectBadString(
+                    StorageEntry* newEntry,
+                    const size_t originalSize,
+                    const char* originalBuffer,
+                    const unsigned long originalId,
+                    const size_t minimumSeedIndex,
+                    const int testCaseKey);
+
+protected:
+    AsciiBadMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static PrintableRunIndex BuildPrintableRunIndex(
+                                                const char* const buffer,
+                                                const size_t size);
+
+    std::shared_ptr<const PrintableRunIndex> GetPrintableRunIndex(
+                                                            const char* const buffer,
+                                                            const size_t size,
+                                                            const unsigned long seedId);
+
+    size_t GetRandomInjectionIndex(
+                                const PrintableRunIndex& runIndex,
+                                const size_t originalSize,
+                                const size_t minimumSeedIndex);
+
+private:
+    SeedCache<PrintableRunIndex> printableRunIndexCache_;
+};
+}
@@ -0,0 +1,100 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+
+// VMF Includes
+#include "banditScheduler.hpp"
+#include "RuntimeException.hpp"
+
+vmf::radamsa::mutations::BanditScheduler::BanditScheduler(const size_t numberOfArms) : arms_(numberOfArms),
+                                                                                       outputHistory_(OUTPUT_HISTORY_SIZE)
+{
+    if (numberOfArms == 0u)
+        throw RuntimeException{"The bandit scheduler needs at least one arm", RuntimeException::USAGE_ERROR};
+}
+
+size_t vmf::radamsa::mutations::BanditScheduler::SelectArm(std::default_random_engine& randomNumberGenerator) const
+{
+    if (arms_.empty())
+        throw RuntimeException{"Cannot select an arm of an empty bandit scheduler", RuntimeException::UNEXPECTED_ERROR};
+
+    // A Beta(a, b) draw is X / (X + Y) with X ~ Gamma(a) and Y ~ Gamma(b); the uniform prior is Beta(1, 1).
+
+    size_t selectedArm{0u};
+    double selectedYield{-1.0};
+
+    for (size_t arm{0u}; arm < arms_.size(); ++arm)
+    {
+        const double rewards{arms_[arm].Rewards};
+        const double failures{std::max(arms_[arm].Trials - rewards, 0.0)};
+
+        std::gamma_distribution<double> rewardDistribution(rewards + 1.0, 1.0);
+        std::gamma_distribution<double> failureDistribution(failures + 1.0, 1.0);
+
+        const double rewardDraw{rewardDistribution(randomNumberGenerator)};
+        const double yield{rewardDraw / (rewardDraw + failureDistribution(randomNumberGenerator))};
+
+        if (yield > selectedYield)
+        {
+            selectedArm = arm;
+            selectedYield = yield;
+        }
+    }
+
+    return selectedArm;
+}
+
+void vmf::radamsa::mutations::BanditScheduler::RecordOutput(const unsigned long outputId, const size_t arm)
+{
+    ArmStatistics& statistics{arms_.at(arm)};
+
+    if (statistics.Trials >= MAXIMUM_NUMBER_OF_TRIALS)
+    {
+        statistics.Trials *= 0.5;
+        statistics.Rewards *= 0.5;
+    }
+
+    statistics.Trials += 1.0;
+
+    // Output IDs are consecutive, so the history keeps the most recent outputs and overwrites the oldest.
+
+    outputHistory_[outputId % OUTPUT_HISTORY_SIZE] = OutputRecord{outputId, arm, true};
+}
+
+bool vmf::radamsa::mutations::BanditScheduler::RecordReward(const unsigned long outputId)
+{
+    if (outputHistory_.empty())
+        return false;
+
+    OutputRecord& record{outputHistory_[outputId % OUTPUT_HISTORY_SIZE]};
+
+    if (!record.IsValid || record.OutputId != outputId)
+        return false;
+
+    // An output is only rewarded once, however often it is seen.
+
+    record.IsValid = false;
+
+    arms_[record.Arm].Rewards += 1.0;
+
+    return true;
+}
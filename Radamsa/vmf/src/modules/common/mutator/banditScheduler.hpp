@@ -0,0 +1,90 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <random>
+#include <vector>
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Thompson sampling scheduler over a fixed set of arms, rewarded by the outputs that found new coverage.
+ *
+ * Each arm keeps a count of trials (outputs produced) and rewards (outputs that were later found to reach new
+ * coverage), and an arm is selected by drawing a yield from the Beta posterior of every arm and taking the largest.
+ * Outputs are remembered in a direct-mapped history indexed by output ID, so a reward can be attributed to the arm
+ * that produced it.  Recording an output or a reward is O(1) and never allocates; the history is allocated once.
+ * The counts of an arm are halved whenever its trials reach MAXIMUM_NUMBER_OF_TRIALS, so an arm that stops finding
+ * coverage loses its share within a bounded number of trials.
+ */
+class BanditScheduler
+{
+public:
+    static constexpr size_t OUTPUT_HISTORY_SIZE{4096u};
+    static constexpr double MAXIMUM_NUMBER_OF_TRIALS{4096.0};
+
+    BanditScheduler() = default;
+    ~BanditScheduler() = default;
+
+    explicit BanditScheduler(const size_t numberOfArms);
+
+    BanditScheduler(const BanditScheduler&) = delete;
+    BanditScheduler(BanditScheduler&&) = default;
+
+    BanditScheduler& operator=(const BanditScheduler&) = delete;
+    BanditScheduler& operator=(BanditScheduler&&) = default;
+
+    size_t GetNumberOfArms() const noexcept { return arms_.size(); }
+
+    double GetTrials(const size_t arm) const { return arms_.at(arm).Trials; }
+
+    double GetRewards(const size_t arm) const { return arms_.at(arm).Rewards; }
+
+    /**
+     * @brief Returns the arm with the largest yield drawn from the posteriors; the cost is linear in the number of arms.
+     */
+    size_t SelectArm(std::default_random_engine& randomNumberGenerator) const;
+
+    void RecordOutput(const unsigned long outputId, const size_t arm);
+
+    /**
+     * @brief Rewards the arm that produced the output; returns false when the output is no longer in the history.
+     */
+    bool RecordReward(const unsigned long outputId);
+
+private:
+    struct ArmStatistics
+    {
+        double Trials{0.0};
+        double Rewards{0.0};
+    };
+
+    struct OutputRecord
+    {
+        unsigned long OutputId{0u};
+        size_t Arm{0u};
+        bool IsValid{false};
+    };
+
+    std::vector<ArmStatistics> arms_;
+    std::vector<OutputRecord> outputHistory_;
+};
+}
@@ -0,0 +1,69 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <cstring>
+#include <initializer_list>
+
+// VMF Includes
+#include "StorageEntry.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief A range of bytes that is copied into a mutated buffer.
+ */
+struct BufferSegment
+{
+    const char* Data;
+    size_t Size;
+};
+
+/**
+ * @brief Allocates the test case buffer of newEntry and writes the segments into it back to back.
+ *
+ * Structure-aware mutations describe their output as ranges of the original buffer plus any new bytes,
+ * so the output is produced with one allocation and one copy per segment.  As with every other mutation,
+ * a null-terminator is appended to the end.
+ */
+inline void WriteSegments(
+                    StorageEntry* newEntry,
+                    const int testCaseKey,
+                    std::initializer_list<BufferSegment> segments)
+{
+    size_t newBufferSize{1u};
+
+    for (const BufferSegment& segment : segments)
+        newBufferSize += segment.Size;
+
+    char* newBuffer{newEntry->allocateBuffer(testCaseKey, static_cast<int>(newBufferSize))};
+    char* destination{newBuffer};
+
+    for (const BufferSegment& segment : segments)
+    {
+        memcpy(destination, segment.Data, segment.Size);
+
+        destination += segment.Size;
+    }
+
+    newBuffer[newBufferSize - 1u] = '\0';
+}
+}
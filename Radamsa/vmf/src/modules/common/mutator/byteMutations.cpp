@@ -140,10 +140,9 @@ void vmf::radamsa::mutations::ByteMutations::FlipByte(
                                                         upper)};
 
     // Select a random bit to flip from the random byte.
-    // When computing the random bit shift,
-    // we add 1 so that a maximum number of 8 bit shift operations can be performed against a char containing the value 0x01.
+    // The bit shift is bounded by the most significant bit, since shifting 0x01 any further would leave the byte unchanged.
 
-    const size_t randomBitShift{GetRandomValueWithinBounds(0u, std::numeric_limits<char>::digits + 1u)};
+    const size_t randomBitShift{GetRandomValueWithinBounds(0u, std::numeric_limits<uint8_t>::digits - 1u)};
     const char randomMaskedBit{static_cast<char>(0x01u << randomBitShift)};
 
     // Flip the random byte by performing an XOR operation with a random masked bit.
@@ -327,6 +326,40 @@ void vmf::radamsa::mutations::ByteMutations::PermuteByte(
     }
 }
 
+void vmf::radamsa::mutations::ByteMutations::PermuteAllowedBytes(
+                                                            StorageEntry* newEntry,
+                                                            const size_t originalSize,
+                                                            const char* originalBuffer,
+                                                            const OffsetSampler& allowedOffsets,
+                                                            const int testCaseKey)
+{
+    // Consume the original buffer by swapping every allowed byte with a random allowed byte and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (allowedOffsets.IsEmpty())
+        throw RuntimeException{"No offset of the buffer is allowed", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const size_t newBufferSize{originalSize + 1u};
+
+    char* newBuffer{newEntry->allocateBuffer(testCaseKey, static_cast<int>(newBufferSize))};
+    memcpy(newBuffer, originalBuffer, originalSize);
+    newBuffer[originalSize] = '\0';
+
+    allowedOffsets.ForEachRange(
+                            [&](const size_t startIndex, const size_t endIndex)
+                            {
+                                for (size_t sourceIndex{startIndex}; sourceIndex < endIndex; ++sourceIndex)
+                                    std::swap(newBuffer[sourceIndex], newBuffer[allowedOffsets.Sample(RANDOM_NUMBER_GENERATOR_)]);
+                            });
+}
+
 void vmf::radamsa::mutations::ByteMutations::IncrementByte(
                                                         StorageEntry* newEntry,
                                                         const size_t originalSize,
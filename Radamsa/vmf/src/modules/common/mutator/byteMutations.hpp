@@ -24,6 +24,7 @@
 #include "StorageEntry.hpp"
 #include "RuntimeException.hpp"
 #include "mutationBase.hpp"
+#include "offsetSampler.hpp"
 
 
 namespace vmf::radamsa::mutations
@@ -102,6 +103,16 @@ public:
             const size_t minimumSeedIndex,
             const int testCaseKey);
 
+    /**
+     * @brief Rearranges the bytes at the allowed offsets among themselves; the other bytes keep their place.
+     */
+    void PermuteAllowedBytes(
+            StorageEntry* newEntry,
+            const size_t originalBufferSize,
+            const char* originalBuffer,
+            const OffsetSampler& allowedOffsets,
+            const int testCaseKey);
+
     void IncrementByte(
             StorageEntry* newEntry,
             const size_t originalBufferSize,
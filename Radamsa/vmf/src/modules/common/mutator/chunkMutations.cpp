@@ -0,0 +1,414 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <array>
+
+// VMF Includes
+#include "chunkMutations.hpp"
+#include "bufferSegments.hpp"
+
+namespace
+{
+using ChunkLayout = vmf::radamsa::mutations::ChunkMutations::ChunkLayout;
+
+// Layouts are tried in order and the first one that matches is used, so the layouts with the most
+// fixed structure, which are the least likely to match by chance, come first.
+
+constexpr std::array<ChunkLayout, 13u> CHUNK_LAYOUTS{
+                                                ChunkLayout{0u, 4u, true, 8u, 1u},  // PNG: length, type, data, CRC.
+                                                ChunkLayout{4u, 4u, false, 0u, 2u}, // RIFF: ID, little-endian length, data padded to even.
+                                                ChunkLayout{4u, 4u, true, 0u, 2u},  // IFF: ID, big-endian length, data padded to even.
+                                                ChunkLayout{0u, 4u, false, 0u, 1u},
+                                                ChunkLayout{0u, 4u, true, 0u, 1u},
+                                                ChunkLayout{2u, 2u, false, 0u, 1u},
+                                                ChunkLayout{2u, 2u, true, 0u, 1u},
+                                                ChunkLayout{1u, 2u, false, 0u, 1u},
+                                                ChunkLayout{1u, 2u, true, 0u, 1u},
+                                                ChunkLayout{0u, 2u, false, 0u, 1u},
+                                                ChunkLayout{0u, 2u, true, 0u, 1u},
+                                                ChunkLayout{1u, 1u, false, 0u, 1u}, // TLV with one byte type and length.
+                                                ChunkLayout{0u, 1u, false, 0u, 1u}};
+
+constexpr char PADDING[8u]{};
+}
+
+size_t vmf::radamsa::mutations::ChunkMutations::GetChunkSize(
+                                                        const char* const buffer,
+                                                        const size_t size,
+                                                        const ChunkLayout& layout,
+                                                        const size_t startIndex) noexcept
+{
+    // Returns the size of the chunk that starts at startIndex, or 0 when it does not fit in the buffer.
+    // The final chunk of a buffer may leave out its alignment padding.
+
+    const size_t headerSize{static_cast<size_t>(layout.LengthOffset) + layout.LengthSize + layout.ExtraSize};
+
+    if (startIndex + headerSize > size)
+        return 0u;
+
+    const uint64_t unpaddedSize{headerSize + ReadLength(buffer, layout, startIndex + layout.LengthOffset)};
+    const uint64_t paddedSize{((unpaddedSize + layout.Alignment - 1u) / layout.Alignment) * layout.Alignment};
+
+    const size_t remainingSize{size - startIndex};
+
+    if (paddedSize <= remainingSize)
+        return static_cast<size_t>(paddedSize);
+
+    return (unpaddedSize == remainingSize) ? remainingSize : 0u;
+}
+
+uint64_t vmf::radamsa::mutations::ChunkMutations::ReadLength(
+                                                        const char* const buffer,
+                                                        const ChunkLayout& layout,
+                                                        const size_t lengthIndex) noexcept
+{
+    uint64_t length{0u};
+
+    for (size_t it{0u}; it < layout.LengthSize; ++it)
+    {
+        const size_t byteIndex{layout.IsBigEndian ? it : layout.LengthSize - 1u - it};
+
+        length = (length << 8u) | static_cast<uint8_t>(buffer[lengthIndex + byteIndex]);
+    }
+
+    return length;
+}
+
+void vmf::radamsa::mutations::ChunkMutations::WriteLength(
+                                                        char* const buffer,
+                                                        const ChunkLayout& layout,
+                                                        const size_t lengthIndex,
+                                                        const uint64_t length) noexcept
+{
+    // A length that no longer fits in the field is saturated.
+
+    const uint64_t maximumLength{(uint64_t{1u} << (8u * layout.LengthSize)) - 1u};
+
+    uint64_t value{std::min(length, maximumLength)};
+
+    for (size_t it{0u}; it < layout.LengthSize; ++it)
+    {
+        const size_t byteIndex{layout.IsBigEndian ? layout.LengthSize - 1u - it : it};
+
+        buffer[lengthIndex + byteIndex] = static_cast<char>(value & 0xffu);
+        value >>= 8u;
+    }
+}
+
+vmf::radamsa::mutations::ChunkMutations::ChunkIndex vmf::radamsa::mutations::ChunkMutations::BuildChunkIndex(
+                                                                                                        const char* const buffer,
+                                                                                                        const size_t size)
+{
+    ChunkIndex index;
+
+    if (buffer == nullptr)
+        return index;
+
+    // chainLengths[i] is the number of chunks in the chain that starts at offset i and ends exactly at the end
+    // of the buffer, or 0 when there is no such chain. Following a chunk always moves forward, so a single
+    // backward pass resolves every offset from the offsets after it.
+
+    std::vector<uint32_t> chainLengths(size + 1u, 0u);
+
+    for (const ChunkLayout& layout : CHUNK_LAYOUTS)
+    {
+        for (size_t it{size}; it-- > 0u;)
+        {
+            const size_t chunkSize{GetChunkSize(buffer, size, layout, it)};
+
+            if (chunkSize == 0u)
+                chainLengths[it] = 0u;
+            else if (it + chunkSize == size)
+                chainLengths[it] = 1u;
+            else
+                chainLengths[it] = (chainLengths[it + chunkSize] > 0u) ? chainLengths[it + chunkSize] + 1u : 0u;
+        }
+
+        // The records of a format start right after its file header, so only chains that start early count.
+
+        const size_t lastStartIndex{std::min(size, MAXIMUM_HEADER_SIZE)};
+
+        size_t chainStartIndex{0u};
+
+        while (chainStartIndex < lastStartIndex && chainLengths[chainStartIndex] < MINIMUM_NUMBER_OF_CHUNKS)
+            ++chainStartIndex;
+
+        if (chainStartIndex == lastStartIndex)
+            continue;
+
+        index.Layout = layout;
+
+        for (size_t chunkStartIndex{chainStartIndex}; chunkStartIndex < size;)
+        {
+            const size_t chunkSize{GetChunkSize(buffer, size, layout, chunkStartIndex)};
+
+            index.Chunks.push_back(Chunk{chunkStartIndex, chunkSize});
+
+            chunkStartIndex += chunkSize;
+        }
+
+        // A single chunk that starts before the chain, ends at the end of the buffer and whose data holds
+        // the whole chain is its container, as the RIFF header is for the chunks of a RIFF file.
+
+        for (size_t containerIndex{chainStartIndex}; containerIndex-- > 0u;)
+        {
+            const size_t dataStartIndex{containerIndex + layout.LengthOffset + layout.LengthSize + layout.ExtraSize};
+
+            if (chainLengths[containerIndex] == 1u && dataStartIndex <= chainStartIndex)
+            {
+                index.HasContainer = true;
+                index.ContainerLengthIndex = containerIndex + layout.LengthOffset;
+
+                break;
+            }
+        }
+
+        break;
+    }
+
+    return index;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::ChunkMutations::ChunkIndex> vmf::radamsa::mutations::ChunkMutations::GetChunkIndex(
+                                                                                                                            const char* const buffer,
+                                                                                                                            const size_t size,
+                                                                                                                            const unsigned long seedId)
+{
+    return chunkIndexCache_.GetOrBuild(
+                                    seedId,
+                                    [&]() { return BuildChunkIndex(buffer, size); });
+}
+
+bool vmf::radamsa::mutations::ChunkMutations::GetRandomChunkIndex(
+                                                            const ChunkIndex& index,
+                                                            const size_t minimumSeedIndex,
+                                                            size_t& chunkIndex)
+{
+    // Chunks are in buffer order, so the ones at or after the minimum seed index form a suffix of the list.
+
+    const auto firstChunk{
+                    std::partition_point(
+                                    index.Chunks.begin(),
+                                    index.Chunks.end(),
+                                    [&](const Chunk& chunk) { return chunk.StartIndex < minimumSeedIndex; })};
+
+    if (firstChunk == index.Chunks.end())
+        return false;
+
+    chunkIndex = GetRandomValueWithinBounds(
+                                        static_cast<size_t>(firstChunk - index.Chunks.begin()),
+                                        index.Chunks.size() - 1u);
+
+    return true;
+}
+
+void vmf::radamsa::mutations::ChunkMutations::AdjustContainerLength(
+                                                                StorageEntry* newEntry,
+                                                                const ChunkIndex& index,
+                                                                const char* originalBuffer,
+                                                                const int64_t sizeChange,
+                                                                const size_t minimumSeedIndex,
+                                                                const int testCaseKey)
+{
+    // The container header comes before every chunk, so its length field is at the same offset in the new buffer.
+    // A length field before the minimum seed index is protected, so it is left as it was in the original buffer.
+
+    if (!index.HasContainer || sizeChange == 0 || index.ContainerLengthIndex < minimumSeedIndex)
+        return;
+
+    const uint64_t length{ReadLength(originalBuffer, index.Layout, index.ContainerLengthIndex)};
+    const uint64_t newLength{
+                        (sizeChange < 0 && length < static_cast<uint64_t>(-sizeChange)) ?
+                            0u :
+                            static_cast<uint64_t>(static_cast<int64_t>(length) + sizeChange)};
+
+    WriteLength(newEntry->getBufferPointer(testCaseKey), index.Layout, index.ContainerLengthIndex, newLength);
+}
+
+void vmf::radamsa::mutations::ChunkMutations::DeleteChunk(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long originalId,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by removing a random chunk and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const ChunkIndex> index{GetChunkIndex(originalBuffer, originalSize, originalId)};
+
+    size_t chunkIndex{0u};
+
+    if (!GetRandomChunkIndex(*index, minimumSeedIndex, chunkIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const Chunk& chunk{index->Chunks[chunkIndex]};
+    const size_t chunkEndIndex{chunk.StartIndex + chunk.Size};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, chunk.StartIndex},
+             {originalBuffer + chunkEndIndex, originalSize - chunkEndIndex}});
+
+    AdjustContainerLength(newEntry, *index, originalBuffer, -static_cast<int64_t>(chunk.Size), minimumSeedIndex, testCaseKey);
+}
+
+void vmf::radamsa::mutations::ChunkMutations::DuplicateChunk(
+                                                            StorageEntry* newEntry,
+                                                            const size_t originalSize,
+                                                            const char* originalBuffer,
+                                                            const unsigned long originalId,
+                                                            const size_t minimumSeedIndex,
+                                                            const int testCaseKey)
+{
+    // Consume the original buffer by repeating a random chunk right after itself and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const ChunkIndex> index{GetChunkIndex(originalBuffer, originalSize, originalId)};
+
+    size_t chunkIndex{0u};
+
+    if (!GetRandomChunkIndex(*index, minimumSeedIndex, chunkIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const Chunk& chunk{index->Chunks[chunkIndex]};
+    const size_t chunkEndIndex{chunk.StartIndex + chunk.Size};
+
+    // An unpadded final chunk is padded before its copy, so that the copy stays aligned.
+
+    const size_t paddingSize{(index->Layout.Alignment - chunk.Size % index->Layout.Alignment) % index->Layout.Alignment};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, chunkEndIndex},
+             {PADDING, paddingSize},
+             {originalBuffer + chunk.StartIndex, chunk.Size},
+             {originalBuffer + chunkEndIndex, originalSize - chunkEndIndex}});
+
+    AdjustContainerLength(
+                        newEntry,
+                        *index,
+                        originalBuffer,
+                        static_cast<int64_t>(paddingSize + chunk.Size),
+                        minimumSeedIndex,
+                        testCaseKey);
+}
+
+void vmf::radamsa::mutations::ChunkMutations::SwapChunks(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long originalId,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by swapping two random chunks and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const ChunkIndex> index{GetChunkIndex(originalBuffer, originalSize, originalId)};
+
+    // Swapping moves whole chunks, so the total size and the container length stay the same. An unpadded
+    // final chunk keeps its place, since moving it in front of another chunk would misalign that chunk.
+
+    const size_t firstEligibleIndex{
+                                static_cast<size_t>(
+                                            std::partition_point(
+                                                            index->Chunks.begin(),
+                                                            index->Chunks.end(),
+                                                            [&](const Chunk& chunk) { return chunk.StartIndex < minimumSeedIndex; }) - index->Chunks.begin())};
+
+    size_t numberOfSwappableChunks{index->Chunks.size()};
+
+    if (!index->Chunks.empty() && index->Chunks.back().Size % index->Layout.Alignment != 0u)
+        --numberOfSwappableChunks;
+
+    if (firstEligibleIndex + 2u > numberOfSwappableChunks)
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    size_t firstChunkIndex{GetRandomValueWithinBounds(firstEligibleIndex, numberOfSwappableChunks - 1u)};
+    size_t secondChunkIndex{GetRandomValueWithinBounds(firstEligibleIndex, numberOfSwappableChunks - 2u)};
+
+    if (secondChunkIndex >= firstChunkIndex)
+        ++secondChunkIndex;
+    else
+        std::swap(firstChunkIndex, secondChunkIndex);
+
+    const Chunk& firstChunk{index->Chunks[firstChunkIndex]};
+    const Chunk& secondChunk{index->Chunks[secondChunkIndex]};
+
+    const size_t firstEndIndex{firstChunk.StartIndex + firstChunk.Size};
+    const size_t secondEndIndex{secondChunk.StartIndex + secondChunk.Size};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, firstChunk.StartIndex},
+             {originalBuffer + secondChunk.StartIndex, secondChunk.Size},
+             {originalBuffer + firstEndIndex, secondChunk.StartIndex - firstEndIndex},
+             {originalBuffer + firstChunk.StartIndex, firstChunk.Size},
+             {originalBuffer + secondEndIndex, originalSize - secondEndIndex}});
+}
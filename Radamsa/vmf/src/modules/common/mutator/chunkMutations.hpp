@@ -0,0 +1,155 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <cstdint>
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "seedCache.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Record level mutations of binary inputs made of length-prefixed chunks.
+ *
+ * A seed is matched against a list of common record layouts (PNG and RIFF/IFF style chunks, TLV
+ * records with 8, 16 or 32 bit lengths in either byte order).  A layout matches when a chain of at
+ * least MINIMUM_NUMBER_OF_CHUNKS records, each found by following the length of the previous one, starts
+ * within the first MAXIMUM_HEADER_SIZE bytes and ends exactly at the end of the seed.  The chain lengths
+ * of every offset are resolved in one backward pass per layout, and the matching chunks are cached by
+ * storage entry ID.  Deleting, duplicating or swapping whole chunks keeps every chunk length valid, and the
+ * length of an enclosing container chunk, such as the RIFF header, is updated to match.
+ */
+class ChunkMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    static constexpr size_t MINIMUM_NUMBER_OF_CHUNKS{3u};
+    static constexpr size_t MAXIMUM_HEADER_SIZE{64u};
+
+    struct ChunkLayout
+    {
+        uint8_t LengthOffset{0u}; // Bytes before the length field, such as a type or chunk ID.
+        uint8_t LengthSize{0u};   // 1, 2 or 4.
+        bool IsBigEndian{false};
+        uint8_t ExtraSize{0u};    // Bytes after the length field that the length does not count, such as a type and CRC.
+        uint8_t Alignment{1u};    // Chunks are padded to a multiple of this size.
+    };
+
+    struct Chunk
+    {
+        size_t StartIndex{0u};
+        size_t Size{0u};
+    };
+
+    struct ChunkIndex
+    {
+        ChunkLayout Layout;
+        std::vector<Chunk> Chunks;
+
+        bool HasContainer{false};
+        size_t ContainerLengthIndex{0u}; // Offset of the length field of the chunk that encloses all the chunks.
+    };
+
+    ChunkMutations() = delete;
+    virtual ~ChunkMutations() = default;
+
+    ChunkMutations(const ChunkMutations&) = delete;
+    ChunkMutations(ChunkMutations&&) = delete;
+
+    ChunkMutations& operator=(const ChunkMutations&) = delete;
+    ChunkMutations& operator=(ChunkMutations&&) = delete;
+
+    void DeleteChunk(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+    void DuplicateChunk(
+                    StorageEntry* newEntry,
+                    const size_t originalSize,
+                    const char* originalBuffer,
+                    const unsigned long originalId,
+                    const size_t minimumSeedIndex,
+                    const int testCaseKey);
+
+    void SwapChunks(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+protected:
+    ChunkMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static ChunkIndex BuildChunkIndex(
+                                const char* const buffer,
+                                const size_t size);
+
+    std::shared_ptr<const ChunkIndex> GetChunkIndex(
+                                                const char* const buffer,
+                                                const size_t size,
+                                                const unsigned long seedId);
+
+    bool GetRandomChunkIndex(
+                        const ChunkIndex& index,
+                        const size_t minimumSeedIndex,
+                        size_t& chunkIndex);
+
+    static size_t GetChunkSize(
+                            const char* const buffer,
+                            const size_t size,
+                            const ChunkLayout& layout,
+                            const size_t startIndex) noexcept;
+
+    static uint64_t ReadLength(
+                        const char* const buffer,
+                        const ChunkLayout& layout,
+                        const size_t lengthIndex) noexcept;
+
+    static void WriteLength(
+                        char* const buffer,
+                        const ChunkLayout& layout,
+                        const size_t lengthIndex,
+                        const uint64_t length) noexcept;
+
+    static void AdjustContainerLength(
+                                StorageEntry* newEntry,
+                                const ChunkIndex& index,
+                                const char* originalBuffer,
+                                const int64_t sizeChange,
+                                const size_t minimumSeedIndex,
+                                const int testCaseKey);
+
+private:
+    SeedCache<ChunkIndex> chunkIndexCache_;
+};
+}
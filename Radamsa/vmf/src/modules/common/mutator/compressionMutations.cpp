@@ -0,0 +1,273 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <array>
+#include <climits>
+
+// zlib Includes
+#include <zlib.h>
+
+// VMF Includes
+#include "compressionMutations.hpp"
+#include "bufferSegments.hpp"
+
+namespace
+{
+constexpr uint8_t GZIP_FIRST_MAGIC_BYTE{0x1fu};
+constexpr uint8_t GZIP_SECOND_MAGIC_BYTE{0x8bu};
+constexpr uint8_t DEFLATE_METHOD{0x08u};
+
+constexpr size_t INFLATE_CHUNK_SIZE{16384u};
+
+int GetWindowBits(const vmf::radamsa::mutations::CompressionMutations::CompressionFormat format) noexcept
+{
+    // zlib selects the wrapper from the window bits: gzip adds 16 and raw deflate negates them.
+
+    switch (format)
+    {
+    case vmf::radamsa::mutations::CompressionMutations::CompressionFormat::Gzip:
+        return MAX_WBITS + 16;
+    case vmf::radamsa::mutations::CompressionMutations::CompressionFormat::RawDeflate:
+        return -MAX_WBITS;
+    default:
+        return MAX_WBITS;
+    }
+}
+
+bool IsZlibHeader(const uint8_t compressionMethod, const uint8_t flags) noexcept
+{
+    // Deflate with a window of at most 32KiB, a valid header check and no preset dictionary.
+
+    return (compressionMethod & 0x0fu) == DEFLATE_METHOD &&
+           (compressionMethod >> 4u) <= 7u &&
+           ((compressionMethod << 8u) | flags) % 31u == 0u &&
+           (flags & 0x20u) == 0u;
+}
+}
+
+bool vmf::radamsa::mutations::CompressionMutations::Inflate(
+                                                        const char* const buffer,
+                                                        const size_t size,
+                                                        const CompressionFormat format,
+                                                        std::string& payload,
+                                                        size_t& compressedSize)
+{
+    z_stream stream{};
+
+    if (inflateInit2(&stream, GetWindowBits(format)) != Z_OK)
+        return false;
+
+    std::array<char, INFLATE_CHUNK_SIZE> chunk;
+
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(buffer));
+    stream.avail_in = static_cast<uInt>(std::min<size_t>(size, UINT_MAX));
+
+    payload.clear();
+
+    int status{Z_OK};
+
+    // inflate stops with Z_BUF_ERROR when the input ends before the stream does.
+
+    while (status == Z_OK)
+    {
+        stream.next_out = reinterpret_cast<Bytef*>(chunk.data());
+        stream.avail_out = static_cast<uInt>(chunk.size());
+
+        status = inflate(&stream, Z_NO_FLUSH);
+
+        payload.append(chunk.data(), chunk.size() - stream.avail_out);
+
+        if (payload.size() > MAXIMUM_PAYLOAD_SIZE)
+            status = Z_MEM_ERROR;
+    }
+
+    compressedSize = static_cast<size_t>(stream.total_in);
+
+    inflateEnd(&stream);
+
+    return status == Z_STREAM_END;
+}
+
+std::string vmf::radamsa::mutations::CompressionMutations::Deflate(
+                                                                const std::string& payload,
+                                                                const CompressionFormat format)
+{
+    z_stream stream{};
+
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, GetWindowBits(format), 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        throw RuntimeException{"Failed to initialize the deflate stream", RuntimeException::UNEXPECTED_ERROR};
+
+    // The bound is large enough for the whole stream, so a single call finishes it.
+
+    std::string compressed(deflateBound(&stream, static_cast<uLong>(payload.size())), '\0');
+
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(payload.data()));
+    stream.avail_in = static_cast<uInt>(payload.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&compressed[0]);
+    stream.avail_out = static_cast<uInt>(compressed.size());
+
+    const int status{deflate(&stream, Z_FINISH)};
+
+    compressed.resize(static_cast<size_t>(stream.total_out));
+
+    deflateEnd(&stream);
+
+    if (status != Z_STREAM_END)
+        throw RuntimeException{"Failed to deflate the mutated payload", RuntimeException::UNEXPECTED_ERROR};
+
+    return compressed;
+}
+
+vmf::radamsa::mutations::CompressionMutations::CompressedRegionIndex vmf::radamsa::mutations::CompressionMutations::BuildCompressedRegionIndex(
+                                                                                                                                    const char* const buffer,
+                                                                                                                                    const size_t size)
+{
+    CompressedRegionIndex index;
+
+    if (buffer == nullptr)
+        return index;
+
+    // Every offset with a gzip or zlib header is tried; a stream that inflates to its end is recorded and skipped over.
+    // Most false header matches fail within the first few bytes of the stream.
+
+    size_t startIndex{0u};
+
+    while (startIndex + 2u < size)
+    {
+        const uint8_t firstByte{static_cast<uint8_t>(buffer[startIndex])};
+        const uint8_t secondByte{static_cast<uint8_t>(buffer[startIndex + 1u])};
+
+        CompressedRegion region;
+
+        region.StartIndex = startIndex;
+
+        if (firstByte == GZIP_FIRST_MAGIC_BYTE &&
+            secondByte == GZIP_SECOND_MAGIC_BYTE &&
+            static_cast<uint8_t>(buffer[startIndex + 2u]) == DEFLATE_METHOD)
+        {
+            region.Format = CompressionFormat::Gzip;
+        }
+        else if (IsZlibHeader(firstByte, secondByte))
+        {
+            region.Format = CompressionFormat::Zlib;
+        }
+        else
+        {
+            ++startIndex;
+
+            continue;
+        }
+
+        if (Inflate(buffer + startIndex, size - startIndex, region.Format, region.Payload, region.Size))
+        {
+            startIndex += region.Size;
+
+            index.Regions.push_back(std::move(region));
+        }
+        else
+        {
+            ++startIndex;
+        }
+    }
+
+    // A raw deflate stream has no header, so it is only accepted when it spans the whole seed.
+
+    if (index.Regions.empty() && size >= MINIMUM_RAW_STREAM_SIZE)
+    {
+        CompressedRegion region;
+
+        region.Format = CompressionFormat::RawDeflate;
+
+        if (Inflate(buffer, size, region.Format, region.Payload, region.Size) && region.Size == size)
+            index.Regions.push_back(std::move(region));
+    }
+
+    return index;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::CompressionMutations::CompressedRegionIndex> vmf::radamsa::mutations::CompressionMutations::GetCompressedRegionIndex(
+                                                                                                                                                        const char* const buffer,
+                                                                                                                                                        const size_t size,
+                                                                                                                                                        const unsigned long seedId)
+{
+    return compressedRegionIndexCache_.GetOrBuild(
+                                            seedId,
+                                            [&]() { return BuildCompressedRegionIndex(buffer, size); });
+}
+
+void vmf::radamsa::mutations::CompressionMutations::MutateCompressedRegion(
+                                                                        StorageEntry* newEntry,
+                                                                        const size_t originalSize,
+                                                                        const char* originalBuffer,
+                                                                        const unsigned long originalId,
+                                                                        const size_t minimumSeedIndex,
+                                                                        const int testCaseKey,
+                                                                        const std::function<void(PieceTable&)>& mutatePayload)
+{
+    // Consume the original buffer by replacing a compressed region with its mutated and recompressed payload and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const CompressedRegionIndex> index{GetCompressedRegionIndex(originalBuffer, originalSize, originalId)};
+
+    const auto firstRegion{
+                    std::partition_point(
+                                    index->Regions.begin(),
+                                    index->Regions.end(),
+                                    [&](const CompressedRegion& region) { return region.StartIndex < minimumSeedIndex; })};
+
+    if (firstRegion == index->Regions.end())
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const CompressedRegion& region{
+                            index->Regions[
+                                GetRandomValueWithinBounds(
+                                                    static_cast<size_t>(firstRegion - index->Regions.begin()),
+                                                    index->Regions.size() - 1u)]};
+
+    PieceTable payload{region.Payload.data(), region.Payload.size()};
+
+    mutatePayload(payload);
+
+    const std::string compressed{Deflate(payload.GetContent(), region.Format)};
+    const size_t regionEndIndex{region.StartIndex + region.Size};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, region.StartIndex},
+             {compressed.data(), compressed.size()},
+             {originalBuffer + regionEndIndex, originalSize - regionEndIndex}});
+}
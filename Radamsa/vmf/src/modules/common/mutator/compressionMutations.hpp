@@ -0,0 +1,128 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "pieceTable.hpp"
+#include "seedCache.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Mutates the decompressed payload of a deflate stream embedded in a seed and recompresses it in place.
+ *
+ * Byte edits of compressed bytes almost always break the stream or its checksum, so they never reach the
+ * code behind the decompressor.  zlib and gzip streams are found anywhere in a seed from their headers, and a
+ * seed that is a raw deflate stream as a whole is recognized too.  Every stream is inflated once and the
+ * payloads are cached by storage entry ID; a mutation edits a piece table over one payload, deflates the
+ * result with the same wrapper, and splices it over the original stream.
+ */
+class CompressionMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    // Streams that inflate to more than this are ignored, so a decompression bomb cannot exhaust memory.
+
+    static constexpr size_t MAXIMUM_PAYLOAD_SIZE{size_t{16u} << 20u};
+
+    // Raw deflate streams have no header to validate, so they are only accepted when they are this large.
+
+    static constexpr size_t MINIMUM_RAW_STREAM_SIZE{8u};
+
+    enum class CompressionFormat : uint8_t
+    {
+        Zlib,
+        Gzip,
+        RawDeflate
+    };
+
+    struct CompressedRegion
+    {
+        size_t StartIndex{0u};
+        size_t Size{0u};        // Compressed size, including the header and trailer of the wrapper.
+        CompressionFormat Format{CompressionFormat::Zlib};
+        std::string Payload;
+    };
+
+    struct CompressedRegionIndex
+    {
+        std::vector<CompressedRegion> Regions; // Non-overlapping, in buffer order.
+    };
+
+    CompressionMutations() = delete;
+    virtual ~CompressionMutations() = default;
+
+    CompressionMutations(const CompressionMutations&) = delete;
+    CompressionMutations(CompressionMutations&&) = delete;
+
+    CompressionMutations& operator=(const CompressionMutations&) = delete;
+    CompressionMutations& operator=(CompressionMutations&&) = delete;
+
+    /**
+     * @brief Applies mutatePayload to the payload of a random compressed region and recompresses it.
+     *
+     * When the seed holds no compressed region that starts at or after minimumSeedIndex, the buffer is passed through unchanged.
+     */
+    void MutateCompressedRegion(
+                            StorageEntry* newEntry,
+                            const size_t originalSize,
+                            const char* originalBuffer,
+                            const unsigned long originalId,
+                            const size_t minimumSeedIndex,
+                            const int testCaseKey,
+                            const std::function<void(PieceTable&)>& mutatePayload);
+
+protected:
+    CompressionMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static CompressedRegionIndex BuildCompressedRegionIndex(
+                                                    const char* const buffer,
+                                                    const size_t size);
+
+    std::shared_ptr<const CompressedRegionIndex> GetCompressedRegionIndex(
+                                                                    const char* const buffer,
+                                                                    const size_t size,
+                                                                    const unsigned long seedId);
+
+    static bool Inflate(
+                    const char* const buffer,
+                    const size_t size,
+                    const CompressionFormat format,
+                    std::string& payload,
+                    size_t& compressedSize);
+
+    static std::string Deflate(
+                        const std::string& payload,
+                        const CompressionFormat format);
+
+private:
+    SeedCache<CompressedRegionIndex> compressedRegionIndexCache_;
+};
+}
@@ -0,0 +1,360 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <fstream>
+#include <unordered_set>
+
+// VMF Includes
+#include "dictionaryMutations.hpp"
+#include "bufferSegments.hpp"
+
+void vmf::radamsa::mutations::DictionaryMutations::SetDictionary(const std::vector<std::string>& tokens)
+{
+    std::shared_ptr<Dictionary> dictionary{std::make_shared<Dictionary>()};
+    std::unordered_set<std::string> uniqueTokens;
+
+    for (const std::string& token : tokens)
+        if (!token.empty() && uniqueTokens.insert(token).second)
+            dictionary->Tokens.push_back(token);
+
+    dictionary->Matcher = AhoCorasick{dictionary->Tokens};
+
+    // The cached occurrences refer to the previous dictionary.
+
+    tokenOccurrenceIndexCache_.Clear();
+    dictionary_ = std::move(dictionary);
+}
+
+bool vmf::radamsa::mutations::DictionaryMutations::ParseDictionaryLine(const std::string& line, std::string& token)
+{
+    const size_t startIndex{line.find_first_not_of(" \t")};
+    const size_t endIndex{line.find_last_not_of(" \t\r\n")};
+
+    if (startIndex == std::string::npos || line[startIndex] == '#')
+        return false;
+
+    const size_t openingQuoteIndex{line.find('"', startIndex)};
+    const size_t closingQuoteIndex{line.rfind('"')};
+
+    token.clear();
+
+    if (openingQuoteIndex == std::string::npos || closingQuoteIndex == openingQuoteIndex)
+    {
+        token = line.substr(startIndex, endIndex - startIndex + 1u);
+
+        return true;
+    }
+
+    // Quoted token, as used by AFL and libFuzzer dictionaries.
+
+    auto getHexValue{
+                [](const char character) -> int
+                {
+                    if (character >= '0' && character <= '9')
+                        return character - '0';
+
+                    if (character >= 'a' && character <= 'f')
+                        return character - 'a' + 10;
+
+                    if (character >= 'A' && character <= 'F')
+                        return character - 'A' + 10;
+
+                    return -1;
+                }};
+
+    for (size_t it{openingQuoteIndex + 1u}; it < closingQuoteIndex; ++it)
+    {
+        if (line[it] != '\\' || it + 1u >= closingQuoteIndex)
+        {
+            token.push_back(line[it]);
+
+            continue;
+        }
+
+        const char escapedCharacter{line[++it]};
+
+        if (escapedCharacter == 'x' && it + 2u < closingQuoteIndex && getHexValue(line[it + 1u]) >= 0 && getHexValue(line[it + 2u]) >= 0)
+        {
+            token.push_back(static_cast<char>(getHexValue(line[it + 1u]) * 16 + getHexValue(line[it + 2u])));
+
+            it += 2u;
+        }
+        else
+            token.push_back(escapedCharacter);
+    }
+
+    return !token.empty();
+}
+
+std::vector<std::string> vmf::radamsa::mutations::DictionaryMutations::LoadDictionaryFile(const std::string& path)
+{
+    std::ifstream file{path, std::ios::binary};
+
+    if (!file.is_open())
+        throw RuntimeException{"Unable to open dictionary file " + path, RuntimeException::USAGE_ERROR};
+
+    std::vector<std::string> tokens;
+    std::string line;
+    std::string token;
+
+    while (std::getline(file, line))
+        if (ParseDictionaryLine(line, token))
+            tokens.push_back(token);
+
+    return tokens;
+}
+
+vmf::radamsa::mutations::DictionaryMutations::TokenOccurrenceIndex vmf::radamsa::mutations::DictionaryMutations::BuildTokenOccurrenceIndex(
+                                                                                                                                    const Dictionary& dictionary,
+                                                                                                                                    const char* const buffer,
+                                                                                                                                    const size_t size)
+{
+    TokenOccurrenceIndex occurrenceIndex;
+
+    if (buffer == nullptr)
+        return occurrenceIndex;
+
+    std::vector<TokenOccurrence>& occurrences{occurrenceIndex.Occurrences};
+
+    dictionary.Matcher.ForEachMatch(
+                            buffer,
+                            size,
+                            [&](const size_t startIndex, const size_t tokenIndex)
+                            {
+                                if (occurrences.size() < TokenOccurrenceIndex::MAXIMUM_NUMBER_OF_OCCURRENCES)
+                                    occurrences.push_back(TokenOccurrence{static_cast<uint32_t>(startIndex), static_cast<uint32_t>(tokenIndex)});
+                            });
+
+    // The matcher reports occurrences by end index.
+
+    std::stable_sort(
+                occurrences.begin(),
+                occurrences.end(),
+                [](const TokenOccurrence& left, const TokenOccurrence& right) { return left.StartIndex < right.StartIndex; });
+
+    return occurrenceIndex;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::DictionaryMutations::TokenOccurrenceIndex> vmf::radamsa::mutations::DictionaryMutations::GetTokenOccurrenceIndex(
+                                                                                                                                                        const Dictionary& dictionary,
+                                                                                                                                                        const char* const buffer,
+                                                                                                                                                        const size_t size,
+                                                                                                                                                        const unsigned long seedId)
+{
+    return tokenOccurrenceIndexCache_.GetOrBuild(
+                                            seedId,
+                                            [&]() { return BuildTokenOccurrenceIndex(dictionary, buffer, size); });
+}
+
+bool vmf::radamsa::mutations::DictionaryMutations::GetRandomOccurrence(
+                                                                const TokenOccurrenceIndex& occurrenceIndex,
+                                                                const size_t minimumSeedIndex,
+                                                                TokenOccurrence& occurrence)
+{
+    const std::vector<TokenOccurrence>& occurrences{occurrenceIndex.Occurrences};
+
+    const auto firstOccurrence{
+                        std::partition_point(
+                                        occurrences.begin(),
+                                        occurrences.end(),
+                                        [&](const TokenOccurrence& it) { return it.StartIndex < minimumSeedIndex; })};
+
+    if (firstOccurrence == occurrences.end())
+        return false;
+
+    occurrence = occurrences[GetRandomValueWithinBounds(static_cast<size_t>(firstOccurrence - occurrences.begin()), occurrences.size() - 1u)];
+
+    return true;
+}
+
+void vmf::radamsa::mutations::DictionaryMutations::InsertToken(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long /*originalId*/,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by inserting a random dictionary token at a random position and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const Dictionary> dictionary{dictionary_};
+
+    if (dictionary == nullptr || dictionary->Tokens.empty())
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const std::string& token{dictionary->Tokens[GetRandomValueWithinBounds(0u, dictionary->Tokens.size() - 1u)]};
+    const size_t insertionIndex{GetRandomValueWithinBounds(minimumSeedIndex, originalSize)};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, insertionIndex},
+             {token.data(), token.size()},
+             {originalBuffer + insertionIndex, originalSize - insertionIndex}});
+}
+
+void vmf::radamsa::mutations::DictionaryMutations::ReplaceToken(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long originalId,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by replacing a random token occurrence with a random dictionary token and appending a null-terminator to the end.
+    // Inputs without occurrences get a token inserted instead.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const Dictionary> dictionary{dictionary_};
+    TokenOccurrence occurrence;
+
+    if (dictionary == nullptr ||
+        !GetRandomOccurrence(*GetTokenOccurrenceIndex(*dictionary, originalBuffer, originalSize, originalId), minimumSeedIndex, occurrence))
+    {
+        InsertToken(newEntry, originalSize, originalBuffer, originalId, minimumSeedIndex, testCaseKey);
+
+        return;
+    }
+
+    const size_t occurrenceEndIndex{occurrence.StartIndex + dictionary->Tokens[occurrence.TokenIndex].size()};
+    const std::string& token{dictionary->Tokens[GetRandomValueWithinBounds(0u, dictionary->Tokens.size() - 1u)]};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, occurrence.StartIndex},
+             {token.data(), token.size()},
+             {originalBuffer + occurrenceEndIndex, originalSize - occurrenceEndIndex}});
+}
+
+void vmf::radamsa::mutations::DictionaryMutations::DuplicateToken(
+                                                            StorageEntry* newEntry,
+                                                            const size_t originalSize,
+                                                            const char* originalBuffer,
+                                                            const unsigned long originalId,
+                                                            const size_t minimumSeedIndex,
+                                                            const int testCaseKey)
+{
+    // Consume the original buffer by repeating a random token occurrence right after itself and appending a null-terminator to the end.
+    // Inputs without occurrences get a token inserted instead.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const Dictionary> dictionary{dictionary_};
+    TokenOccurrence occurrence;
+
+    if (dictionary == nullptr ||
+        !GetRandomOccurrence(*GetTokenOccurrenceIndex(*dictionary, originalBuffer, originalSize, originalId), minimumSeedIndex, occurrence))
+    {
+        InsertToken(newEntry, originalSize, originalBuffer, originalId, minimumSeedIndex, testCaseKey);
+
+        return;
+    }
+
+    const std::string& token{dictionary->Tokens[occurrence.TokenIndex]};
+    const size_t occurrenceEndIndex{occurrence.StartIndex + token.size()};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, occurrenceEndIndex},
+             {token.data(), token.size()},
+             {originalBuffer + occurrenceEndIndex, originalSize - occurrenceEndIndex}});
+}
+
+void vmf::radamsa::mutations::DictionaryMutations::ExtendToken(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long originalId,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by following a random token occurrence with a random dictionary token and appending a null-terminator to the end.
+    // Inputs without occurrences get a token inserted instead.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const Dictionary> dictionary{dictionary_};
+    TokenOccurrence occurrence;
+
+    if (dictionary == nullptr ||
+        !GetRandomOccurrence(*GetTokenOccurrenceIndex(*dictionary, originalBuffer, originalSize, originalId), minimumSeedIndex, occurrence))
+    {
+        InsertToken(newEntry, originalSize, originalBuffer, originalId, minimumSeedIndex, testCaseKey);
+
+        return;
+    }
+
+    const size_t occurrenceEndIndex{occurrence.StartIndex + dictionary->Tokens[occurrence.TokenIndex].size()};
+    const std::string& token{dictionary->Tokens[GetRandomValueWithinBounds(0u, dictionary->Tokens.size() - 1u)]};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, occurrenceEndIndex},
+             {token.data(), token.size()},
+             {originalBuffer + occurrenceEndIndex, originalSize - occurrenceEndIndex}});
+}
@@ -0,0 +1,151 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "seedCache.hpp"
+#include "ahoCorasick.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Implements dictionary driven mutations.
+ *
+ * Tokens are inserted at random positions, or the occurrences of tokens already present in the input
+ * are replaced, duplicated or extended with other tokens.  The dictionary is compiled into an Aho-Corasick
+ * automaton, so finding every occurrence is a single pass over the input regardless of the number of
+ * tokens; the occurrences of a seed are cached by storage entry ID.
+ */
+class DictionaryMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    struct Dictionary
+    {
+        std::vector<std::string> Tokens;
+        AhoCorasick Matcher;
+    };
+
+    struct TokenOccurrence
+    {
+        uint32_t StartIndex{0u};
+        uint32_t TokenIndex{0u};
+    };
+
+    struct TokenOccurrenceIndex
+    {
+        // Inputs made of very short tokens can hold an occurrence at nearly every byte, so the index is bounded.
+
+        static constexpr size_t MAXIMUM_NUMBER_OF_OCCURRENCES{0x100000u};
+
+        std::vector<TokenOccurrence> Occurrences; // Ordered by StartIndex.
+    };
+
+    DictionaryMutations() = delete;
+    virtual ~DictionaryMutations() = default;
+
+    DictionaryMutations(const DictionaryMutations&) = delete;
+    DictionaryMutations(DictionaryMutations&&) = delete;
+
+    DictionaryMutations& operator=(const DictionaryMutations&) = delete;
+    DictionaryMutations& operator=(DictionaryMutations&&) = delete;
+
+    /**
+     * @brief Replaces the dictionary. Empty and repeated tokens are dropped.
+     */
+    void SetDictionary(const std::vector<std::string>& tokens);
+
+    std::shared_ptr<const Dictionary> GetDictionary() const noexcept { return dictionary_; }
+
+    /**
+     * @brief Loads a dictionary file in the AFL format.
+     *
+     * Each line holds one token, either quoted (name="token" or "token", with \\, \" and \xNN escapes)
+     * or as raw text.  Blank lines and lines starting with '#' are skipped.
+     */
+    static std::vector<std::string> LoadDictionaryFile(const std::string& path);
+
+    void InsertToken(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+    void ReplaceToken(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+    void DuplicateToken(
+                    StorageEntry* newEntry,
+                    const size_t originalSize,
+                    const char* originalBuffer,
+                    const unsigned long originalId,
+                    const size_t minimumSeedIndex,
+                    const int testCaseKey);
+
+    void ExtendToken(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+protected:
+    DictionaryMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static bool ParseDictionaryLine(const std::string& line, std::string& token);
+
+    static TokenOccurrenceIndex BuildTokenOccurrenceIndex(
+                                                    const Dictionary& dictionary,
+                                                    const char* const buffer,
+                                                    const size_t size);
+
+    std::shared_ptr<const TokenOccurrenceIndex> GetTokenOccurrenceIndex(
+                                                                const Dictionary& dictionary,
+                                                                const char* const buffer,
+                                                                const size_t size,
+                                                                const unsigned long seedId);
+
+    bool GetRandomOccurrence(
+                        const TokenOccurrenceIndex& occurrenceIndex,
+                        const size_t minimumSeedIndex,
+                        TokenOccurrence& occurrence);
+
+private:
+    std::shared_ptr<const Dictionary> dictionary_;
+    SeedCache<TokenOccurrenceIndex> tokenOccurrenceIndexCache_;
+};
+}
@@ -0,0 +1,202 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <cstring>
+
+// VMF Includes
+#include "duplicateFilter.hpp"
+#include "RuntimeException.hpp"
+
+namespace
+{
+constexpr uint64_t PRIME_1{0x9E3779B185EBCA87u};
+constexpr uint64_t PRIME_2{0xC2B2AE3D27D4EB4Fu};
+constexpr uint64_t PRIME_3{0x165667B19E3779F9u};
+
+inline uint64_t RotateLeft(const uint64_t value, const unsigned int bits) noexcept { return (value << bits) | (value >> (64u - bits)); }
+
+inline uint64_t ReadUInt64(const char* const data) noexcept
+{
+    uint64_t word;
+
+    memcpy(&word, data, sizeof(word));
+
+    return word;
+}
+
+inline uint64_t MixLane(const uint64_t lane, const uint64_t word) noexcept { return RotateLeft(lane + word * PRIME_2, 31u) * PRIME_1; }
+
+inline uint64_t Avalanche(uint64_t hash) noexcept
+{
+    hash ^= hash >> 33u;
+    hash *= PRIME_2;
+    hash ^= hash >> 29u;
+    hash *= PRIME_3;
+    hash ^= hash >> 32u;
+
+    return hash;
+}
+}
+
+vmf::radamsa::mutations::DuplicateFilter::DuplicateFilter(const size_t capacity) : capacity_{capacity}
+{
+    if (capacity == 0u)
+        throw RuntimeException{"The duplicate filter capacity must be greater than 0", RuntimeException::USAGE_ERROR};
+
+    constexpr size_t blockSizeInBits{sizeof(Block) * 8u};
+
+    const size_t numberOfBlocks{std::max<size_t>((capacity * BITS_PER_HASH + blockSizeInBits - 1u) / blockSizeInBits, 1u)};
+
+    currentBlocks_.resize(numberOfBlocks);
+    previousBlocks_.resize(numberOfBlocks);
+}
+
+size_t vmf::radamsa::mutations::DuplicateFilter::GetBlockIndex(const uint64_t hash) const noexcept
+{
+    // The upper half of the hash picks the block by multiply-shift, and the lower half picks the bits within it.
+
+    return static_cast<size_t>(((hash >> 32u) * static_cast<uint64_t>(currentBlocks_.size())) >> 32u);
+}
+
+bool vmf::radamsa::mutations::DuplicateFilter::BlockContains(const Block& block, const uint64_t hash) noexcept
+{
+    const uint32_t firstHash{static_cast<uint32_t>(hash)};
+    const uint32_t secondHash{static_cast<uint32_t>(hash >> 16u) | 1u};
+
+    for (size_t probe{0u}; probe < NUMBER_OF_PROBES; ++probe)
+    {
+        const uint32_t bitIndex{(firstHash + static_cast<uint32_t>(probe) * secondHash) & 511u};
+
+        if ((block.Words[bitIndex >> 6u] & (uint64_t{1u} << (bitIndex & 63u))) == 0u)
+            return false;
+    }
+
+    return true;
+}
+
+bool vmf::radamsa::mutations::DuplicateFilter::Contains(const uint64_t hash) const noexcept
+{
+    const size_t blockIndex{GetBlockIndex(hash)};
+
+    return BlockContains(currentBlocks_[blockIndex], hash) || BlockContains(previousBlocks_[blockIndex], hash);
+}
+
+void vmf::radamsa::mutations::DuplicateFilter::Insert(const uint64_t hash)
+{
+    if (numberOfInsertions_ == capacity_)
+    {
+        std::swap(currentBlocks_, previousBlocks_);
+        std::fill(currentBlocks_.begin(), currentBlocks_.end(), Block{});
+
+        numberOfInsertions_ = 0u;
+    }
+
+    Block& block{currentBlocks_[GetBlockIndex(hash)]};
+
+    const uint32_t firstHash{static_cast<uint32_t>(hash)};
+    const uint32_t secondHash{static_cast<uint32_t>(hash >> 16u) | 1u};
+
+    for (size_t probe{0u}; probe < NUMBER_OF_PROBES; ++probe)
+    {
+        const uint32_t bitIndex{(firstHash + static_cast<uint32_t>(probe) * secondHash) & 511u};
+
+        block.Words[bitIndex >> 6u] |= uint64_t{1u} << (bitIndex & 63u);
+    }
+
+    ++numberOfInsertions_;
+}
+
+vmf::radamsa::mutations::DuplicateFilter::Hasher::Hasher() noexcept : lanes_{PRIME_1 + PRIME_2, PRIME_2, 0u, 0u - PRIME_1}
+{
+}
+
+void vmf::radamsa::mutations::DuplicateFilter::Hasher::ConsumeStripe(const char* const stripe) noexcept
+{
+    // The four lanes have no dependency on each other, so a stripe costs about as much as a single multiply.
+
+    for (size_t lane{0u}; lane < 4u; ++lane)
+        lanes_[lane] = MixLane(lanes_[lane], ReadUInt64(stripe + lane * sizeof(uint64_t)));
+}
+
+void vmf::radamsa::mutations::DuplicateFilter::Hasher::Update(const char* const data, const size_t size) noexcept
+{
+    size_ += size;
+
+    size_t it{0u};
+
+    // A stripe left incomplete by the previous call is filled up first; whole stripes are then read in place.
+
+    if (numberOfPendingBytes_ > 0u)
+    {
+        it = std::min(size, STRIPE_SIZE - numberOfPendingBytes_);
+
+        memcpy(pendingBytes_.data() + numberOfPendingBytes_, data, it);
+
+        numberOfPendingBytes_ += it;
+
+        if (numberOfPendingBytes_ < STRIPE_SIZE)
+            return;
+
+        ConsumeStripe(pendingBytes_.data());
+
+        numberOfPendingBytes_ = 0u;
+    }
+
+    for (; it + STRIPE_SIZE <= size; it += STRIPE_SIZE)
+        ConsumeStripe(data + it);
+
+    memcpy(pendingBytes_.data(), data + it, size - it);
+
+    numberOfPendingBytes_ = size - it;
+}
+
+uint64_t vmf::radamsa::mutations::DuplicateFilter::Hasher::Finish() const noexcept
+{
+    uint64_t hash{RotateLeft(lanes_[0], 1u) + RotateLeft(lanes_[1], 7u) + RotateLeft(lanes_[2], 12u) + RotateLeft(lanes_[3], 18u)};
+
+    hash += static_cast<uint64_t>(size_) * PRIME_3;
+
+    size_t it{0u};
+
+    for (; it + sizeof(uint64_t) <= numberOfPendingBytes_; it += sizeof(uint64_t))
+        hash = RotateLeft(hash ^ MixLane(0u, ReadUInt64(pendingBytes_.data() + it)), 27u) * PRIME_1 + PRIME_3;
+
+    if (it < numberOfPendingBytes_)
+    {
+        uint64_t word{0u};
+
+        memcpy(&word, pendingBytes_.data() + it, numberOfPendingBytes_ - it);
+
+        hash = RotateLeft(hash ^ MixLane(0u, word), 27u) * PRIME_1 + PRIME_3;
+    }
+
+    return Avalanche(hash);
+}
+
+uint64_t vmf::radamsa::mutations::DuplicateFilter::HashBytes(const char* const data, const size_t size) noexcept
+{
+    Hasher hasher;
+
+    hasher.Update(data, size);
+
+    return hasher.Finish();
+}
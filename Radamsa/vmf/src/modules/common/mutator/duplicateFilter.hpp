@@ -0,0 +1,108 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Remembers the hashes of recently generated outputs, so that duplicate outputs can be caught before they are executed.
+ *
+ * The hashes are kept in a blocked Bloom filter: every hash sets NUMBER_OF_PROBES bits within a single 512-bit block,
+ * so a lookup touches one cache line.  Two generations of the filter are kept, each sized for Capacity hashes; once
+ * the current generation holds Capacity hashes, the previous generation is cleared and becomes the current one.
+ * Memory stays fixed, and a hash is remembered for at least Capacity further insertions.  Like any Bloom filter it
+ * can report a hash that was never inserted, at a rate of about 0.5% at full load.
+ */
+class DuplicateFilter
+{
+public:
+    static constexpr size_t NUMBER_OF_PROBES{8u};
+    static constexpr size_t BITS_PER_HASH{12u};
+
+    DuplicateFilter() = delete;
+    ~DuplicateFilter() = default;
+
+    explicit DuplicateFilter(const size_t capacity);
+
+    DuplicateFilter(const DuplicateFilter&) = delete;
+    DuplicateFilter(DuplicateFilter&&) = delete;
+
+    DuplicateFilter& operator=(const DuplicateFilter&) = delete;
+    DuplicateFilter& operator=(DuplicateFilter&&) = delete;
+
+    size_t GetCapacity() const noexcept { return capacity_; }
+
+    bool Contains(const uint64_t hash) const noexcept;
+
+    void Insert(const uint64_t hash);
+
+    /**
+     * @brief Incremental form of HashBytes, for content that is spread over several buffers.
+     *
+     * Feeding the bytes of a buffer through any number of Update calls gives the same hash as HashBytes on the
+     * whole buffer, so the content never has to be copied together just to be hashed.
+     */
+    class Hasher
+    {
+    public:
+        Hasher() noexcept;
+
+        void Update(const char* const data, const size_t size) noexcept;
+
+        uint64_t Finish() const noexcept;
+
+    private:
+        static constexpr size_t STRIPE_SIZE{4u * sizeof(uint64_t)};
+
+        void ConsumeStripe(const char* const stripe) noexcept;
+
+        std::array<uint64_t, 4u> lanes_;
+        std::array<char, STRIPE_SIZE> pendingBytes_{}; // Bytes that do not fill a whole stripe yet.
+        size_t numberOfPendingBytes_{0u};
+        size_t size_{0u};
+    };
+
+    /**
+     * @brief 64-bit hash of a buffer, mixing four independent lanes of 8 bytes so that long outputs hash at memory speed.
+     */
+    static uint64_t HashBytes(const char* const data, const size_t size) noexcept;
+
+private:
+    struct alignas(64) Block
+    {
+        std::array<uint64_t, 8u> Words{};
+    };
+
+    static bool BlockContains(const Block& block, const uint64_t hash) noexcept;
+
+    size_t GetBlockIndex(const uint64_t hash) const noexcept;
+
+    const size_t capacity_;
+
+    std::vector<Block> currentBlocks_;
+    std::vector<Block> previousBlocks_;
+    size_t numberOfInsertions_{0u};
+};
+}
@@ -0,0 +1,321 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <array>
+
+// VMF Includes
+#include "encodingMutations.hpp"
+#include "bufferSegments.hpp"
+#include "simdScan.hpp"
+
+namespace
+{
+constexpr uint8_t INVALID_DIGIT{0xffu};
+constexpr char BASE64_PADDING{'='};
+
+constexpr char LOWER_CASE_HEX_DIGITS[]{"0123456789abcdef"};
+constexpr char UPPER_CASE_HEX_DIGITS[]{"0123456789ABCDEF"};
+constexpr char BASE64_DIGITS[]{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+
+constexpr std::array<uint8_t, 256u> MakeDecodeTable(const char* const digits, const size_t numberOfDigits, const bool isCaseInsensitive)
+{
+    std::array<uint8_t, 256u> table{};
+
+    for (uint8_t& value : table)
+        value = INVALID_DIGIT;
+
+    for (size_t it{0u}; it < numberOfDigits; ++it)
+    {
+        const uint8_t digit{static_cast<uint8_t>(digits[it])};
+
+        table[digit] = static_cast<uint8_t>(it);
+
+        if (isCaseInsensitive && digit >= 'a' && digit <= 'z')
+            table[digit - 'a' + 'A'] = static_cast<uint8_t>(it);
+    }
+
+    return table;
+}
+
+constexpr std::array<uint8_t, 256u> HEX_DECODE_TABLE{MakeDecodeTable(LOWER_CASE_HEX_DIGITS, 16u, true)};
+constexpr std::array<uint8_t, 256u> BASE64_DECODE_TABLE{MakeDecodeTable(BASE64_DIGITS, 64u, false)};
+
+uint64_t IsBase64Byte(const char* const block) noexcept
+{
+    return vmf::radamsa::mutations::simd::RangeMask(block, 'A', 'Z') |
+           vmf::radamsa::mutations::simd::RangeMask(block, 'a', 'z') |
+           vmf::radamsa::mutations::simd::RangeMask(block, '0', '9') |
+           vmf::radamsa::mutations::simd::EqualMask(block, '+') |
+           vmf::radamsa::mutations::simd::EqualMask(block, '/');
+}
+}
+
+bool vmf::radamsa::mutations::EncodingMutations::DecodeHex(
+                                                        const char* const encoded,
+                                                        const size_t size,
+                                                        std::string& decoded)
+{
+    if (size % 2u != 0u)
+        return false;
+
+    decoded.resize(size / 2u);
+
+    for (size_t it{0u}; it < decoded.size(); ++it)
+    {
+        const uint8_t high{HEX_DECODE_TABLE[static_cast<uint8_t>(encoded[2u * it])]};
+        const uint8_t low{HEX_DECODE_TABLE[static_cast<uint8_t>(encoded[2u * it + 1u])]};
+
+        if (high == INVALID_DIGIT || low == INVALID_DIGIT)
+            return false;
+
+        decoded[it] = static_cast<char>((high << 4u) | low);
+    }
+
+    return true;
+}
+
+bool vmf::radamsa::mutations::EncodingMutations::DecodeBase64(
+                                                            const char* const encoded,
+                                                            const size_t size,
+                                                            std::string& decoded)
+{
+    if (size == 0u || size % 4u != 0u)
+        return false;
+
+    const size_t paddingSize{
+                        (encoded[size - 1u] != BASE64_PADDING) ? 0u :
+                        (encoded[size - 2u] != BASE64_PADDING) ? 1u : 2u};
+
+    decoded.resize(size / 4u * 3u - paddingSize);
+
+    // Every group of four digits holds three bytes; the padding replaces the digits of the missing bytes in the final group.
+
+    for (size_t groupIndex{0u}, outputIndex{0u}; groupIndex < size; groupIndex += 4u, outputIndex += 3u)
+    {
+        uint32_t group{0u};
+
+        for (size_t it{0u}; it < 4u; ++it)
+        {
+            const bool isPadding{groupIndex + it >= size - paddingSize};
+            const uint8_t digit{isPadding ? uint8_t{0u} : BASE64_DECODE_TABLE[static_cast<uint8_t>(encoded[groupIndex + it])]};
+
+            if (digit == INVALID_DIGIT)
+                return false;
+
+            group = (group << 6u) | digit;
+        }
+
+        for (size_t it{0u}; it < 3u && outputIndex + it < decoded.size(); ++it)
+            decoded[outputIndex + it] = static_cast<char>((group >> (16u - 8u * it)) & 0xffu);
+    }
+
+    return true;
+}
+
+std::string vmf::radamsa::mutations::EncodingMutations::EncodeHex(
+                                                                const std::string& decoded,
+                                                                const bool isUpperCase)
+{
+    const char* const digits{isUpperCase ? UPPER_CASE_HEX_DIGITS : LOWER_CASE_HEX_DIGITS};
+
+    std::string encoded(decoded.size() * 2u, '\0');
+
+    for (size_t it{0u}; it < decoded.size(); ++it)
+    {
+        const uint8_t byte{static_cast<uint8_t>(decoded[it])};
+
+        encoded[2u * it] = digits[byte >> 4u];
+        encoded[2u * it + 1u] = digits[byte & 0x0fu];
+    }
+
+    return encoded;
+}
+
+std::string vmf::radamsa::mutations::EncodingMutations::EncodeBase64(const std::string& decoded)
+{
+    std::string encoded((decoded.size() + 2u) / 3u * 4u, BASE64_PADDING);
+
+    for (size_t inputIndex{0u}, outputIndex{0u}; inputIndex < decoded.size(); inputIndex += 3u, outputIndex += 4u)
+    {
+        const size_t groupSize{std::min<size_t>(3u, decoded.size() - inputIndex)};
+
+        uint32_t group{0u};
+
+        for (size_t it{0u}; it < 3u; ++it)
+            group = (group << 8u) | ((it < groupSize) ? static_cast<uint8_t>(decoded[inputIndex + it]) : 0u);
+
+        // A group of n bytes is written as n + 1 digits, and the rest of the group stays padding.
+
+        for (size_t it{0u}; it <= groupSize; ++it)
+            encoded[outputIndex + it] = BASE64_DIGITS[(group >> (18u - 6u * it)) & 0x3fu];
+    }
+
+    return encoded;
+}
+
+vmf::radamsa::mutations::EncodingMutations::EncodedRegionIndex vmf::radamsa::mutations::EncodingMutations::BuildEncodedRegionIndex(
+                                                                                                                            const char* const buffer,
+                                                                                                                            const size_t size)
+{
+    EncodedRegionIndex index;
+
+    if (buffer == nullptr)
+        return index;
+
+    // Hex digits are a subset of the base64 alphabet, so both encodings are found as runs of base64 digits.
+    // Each run long enough to be a candidate is classified by the letters and digits it holds.
+
+    simd::ForEachRun(
+                buffer,
+                size,
+                IsBase64Byte,
+                [&](const size_t startIndex, const size_t runSize)
+                {
+                    if (runSize < MINIMUM_ENCODED_SIZE)
+                        return;
+
+                    bool isHex{true};
+                    bool hasDigit{false};
+                    bool hasLowerCase{false};
+                    bool hasUpperCase{false};
+                    bool hasSymbol{false};
+
+                    for (size_t it{startIndex}; it < startIndex + runSize; ++it)
+                    {
+                        const char character{buffer[it]};
+
+                        isHex = isHex && HEX_DECODE_TABLE[static_cast<uint8_t>(character)] != INVALID_DIGIT;
+                        hasDigit = hasDigit || (character >= '0' && character <= '9');
+                        hasLowerCase = hasLowerCase || (character >= 'a' && character <= 'z');
+                        hasUpperCase = hasUpperCase || (character >= 'A' && character <= 'Z');
+                        hasSymbol = hasSymbol || character == '+' || character == '/';
+                    }
+
+                    EncodedRegion region;
+
+                    region.StartIndex = startIndex;
+
+                    // Hex needs both digits and letters of a single case, so that numbers and mixed case words are left alone.
+
+                    if (isHex && hasDigit && hasLowerCase != hasUpperCase && DecodeHex(buffer + startIndex, runSize, region.Decoded))
+                    {
+                        region.Size = runSize;
+                        region.Encoding = EncodingType::Hex;
+                        region.IsUpperCase = hasUpperCase;
+
+                        index.Regions.push_back(std::move(region));
+
+                        return;
+                    }
+
+                    // Base64 of arbitrary bytes mixes both letter cases with digits or symbols, and is padded to a multiple of four.
+
+                    if (!hasLowerCase || !hasUpperCase || !(hasDigit || hasSymbol))
+                        return;
+
+                    size_t paddedSize{runSize};
+
+                    while (paddedSize < runSize + 2u && startIndex + paddedSize < size && buffer[startIndex + paddedSize] == BASE64_PADDING)
+                        ++paddedSize;
+
+                    if (DecodeBase64(buffer + startIndex, paddedSize, region.Decoded))
+                    {
+                        region.Size = paddedSize;
+                        region.Encoding = EncodingType::Base64;
+
+                        index.Regions.push_back(std::move(region));
+                    }
+                });
+
+    return index;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::EncodingMutations::EncodedRegionIndex> vmf::radamsa::mutations::EncodingMutations::GetEncodedRegionIndex(
+                                                                                                                                                const char* const buffer,
+                                                                                                                                                const size_t size,
+                                                                                                                                                const unsigned long seedId)
+{
+    return encodedRegionIndexCache_.GetOrBuild(
+                                        seedId,
+                                        [&]() { return BuildEncodedRegionIndex(buffer, size); });
+}
+
+void vmf::radamsa::mutations::EncodingMutations::MutateEncodedRegion(
+                                                                StorageEntry* newEntry,
+                                                                const size_t originalSize,
+                                                                const char* originalBuffer,
+                                                                const unsigned long originalId,
+                                                                const size_t minimumSeedIndex,
+                                                                const int testCaseKey,
+                                                                const std::function<void(PieceTable&)>& mutateDecoded)
+{
+    // Consume the original buffer by replacing an encoded region with its mutated and re-encoded bytes and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const EncodedRegionIndex> index{GetEncodedRegionIndex(originalBuffer, originalSize, originalId)};
+
+    const auto firstRegion{
+                    std::partition_point(
+                                    index->Regions.begin(),
+                                    index->Regions.end(),
+                                    [&](const EncodedRegion& region) { return region.StartIndex < minimumSeedIndex; })};
+
+    if (firstRegion == index->Regions.end())
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const EncodedRegion& region{
+                            index->Regions[
+                                GetRandomValueWithinBounds(
+                                                    static_cast<size_t>(firstRegion - index->Regions.begin()),
+                                                    index->Regions.size() - 1u)]};
+
+    PieceTable decoded{region.Decoded.data(), region.Decoded.size()};
+
+    mutateDecoded(decoded);
+
+    const std::string encoded{
+                        (region.Encoding == EncodingType::Hex) ?
+                            EncodeHex(decoded.GetContent(), region.IsUpperCase) :
+                            EncodeBase64(decoded.GetContent())};
+    const size_t regionEndIndex{region.StartIndex + region.Size};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, region.StartIndex},
+             {encoded.data(), encoded.size()},
+             {originalBuffer + regionEndIndex, originalSize - regionEndIndex}});
+}
@@ -0,0 +1,129 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "pieceTable.hpp"
+#include "seedCache.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Mutates the decoded bytes of a hex or base64 run embedded in a text seed and re-encodes them in place.
+ *
+ * Character level edits of an encoded blob almost always make it undecodable, so they never reach the
+ * code that consumes the decoded bytes.  Runs of the base64 alphabet are found with a block classifier,
+ * and every run that decodes as hex or as padded base64 is recorded together with its decoded bytes,
+ * cached by storage entry ID.  A mutation edits a piece table over the decoded bytes of one run, encodes
+ * the result with the same encoding and letter case, and splices it over the original run.
+ */
+class EncodingMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    // Shorter runs are too likely to be ordinary words or numbers.
+
+    static constexpr size_t MINIMUM_ENCODED_SIZE{16u};
+
+    enum class EncodingType : uint8_t
+    {
+        Hex,
+        Base64
+    };
+
+    struct EncodedRegion
+    {
+        size_t StartIndex{0u};
+        size_t Size{0u};         // Encoded size, including any base64 padding.
+        EncodingType Encoding{EncodingType::Hex};
+        bool IsUpperCase{false}; // Whether hex digits above 9 are written as capital letters.
+        std::string Decoded;
+    };
+
+    struct EncodedRegionIndex
+    {
+        std::vector<EncodedRegion> Regions; // Non-overlapping, in buffer order.
+    };
+
+    EncodingMutations() = delete;
+    virtual ~EncodingMutations() = default;
+
+    EncodingMutations(const EncodingMutations&) = delete;
+    EncodingMutations(EncodingMutations&&) = delete;
+
+    EncodingMutations& operator=(const EncodingMutations&) = delete;
+    EncodingMutations& operator=(EncodingMutations&&) = delete;
+
+    /**
+     * @brief Applies mutateDecoded to the decoded bytes of a random encoded region and re-encodes them.
+     *
+     * When the seed holds no encoded region that starts at or after minimumSeedIndex, the buffer is passed through unchanged.
+     */
+    void MutateEncodedRegion(
+                        StorageEntry* newEntry,
+                        const size_t originalSize,
+                        const char* originalBuffer,
+                        const unsigned long originalId,
+                        const size_t minimumSeedIndex,
+                        const int testCaseKey,
+                        const std::function<void(PieceTable&)>& mutateDecoded);
+
+protected:
+    EncodingMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static EncodedRegionIndex BuildEncodedRegionIndex(
+                                                const char* const buffer,
+                                                const size_t size);
+
+    std::shared_ptr<const EncodedRegionIndex> GetEncodedRegionIndex(
+                                                                const char* const buffer,
+                                                                const size_t size,
+                                                                const unsigned long seedId);
+
+    static bool DecodeHex(
+                    const char* const encoded,
+                    const size_t size,
+                    std::string& decoded);
+
+    static bool DecodeBase64(
+                        const char* const encoded,
+                        const size_t size,
+                        std::string& decoded);
+
+    static std::string EncodeHex(
+                            const std::string& decoded,
+                            const bool isUpperCase);
+
+    static std::string EncodeBase64(const std::string& decoded);
+
+private:
+    SeedCache<EncodedRegionIndex> encodedRegionIndexCache_;
+};
+}
@@ -0,0 +1,96 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// VMF Includes
+#include "entropyMap.hpp"
+#include "RuntimeException.hpp"
+
+vmf::radamsa::mutations::EntropyMap::EntropyMap(const char* const buffer, const size_t size, const size_t blockSize) : blockSize_{blockSize}
+{
+    if (blockSize == 0u)
+        throw RuntimeException{"Entropy map block size must be positive", RuntimeException::USAGE_ERROR};
+
+    if (buffer == nullptr && size != 0u)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    constexpr size_t numberOfLanes{4u};
+    constexpr size_t numberOfSymbols{256u};
+
+    entropies_.reserve((size + blockSize - 1u) / blockSize);
+
+    std::array<std::array<uint32_t, numberOfSymbols>, numberOfLanes> laneCounts;
+    std::array<uint32_t, numberOfSymbols> counts;
+
+    for (size_t blockOffset{0u}; blockOffset < size; blockOffset += blockSize)
+    {
+        const uint8_t* const block{reinterpret_cast<const uint8_t*>(buffer) + blockOffset};
+        const size_t blockLength{std::min(blockSize, size - blockOffset)};
+
+        for (std::array<uint32_t, numberOfSymbols>& lane : laneCounts)
+            lane.fill(0u);
+
+        // Sixteen bytes are read per step as two words, and the bytes of each word are spread over the four lanes.
+
+        size_t it{0u};
+
+        for (; it + 16u <= blockLength; it += 16u)
+        {
+            uint64_t words[2];
+            memcpy(words, block + it, sizeof(words));
+
+            for (const uint64_t word : words)
+            {
+                ++laneCounts[0][static_cast<uint8_t>(word)];
+                ++laneCounts[1][static_cast<uint8_t>(word >> 8u)];
+                ++laneCounts[2][static_cast<uint8_t>(word >> 16u)];
+                ++laneCounts[3][static_cast<uint8_t>(word >> 24u)];
+                ++laneCounts[0][static_cast<uint8_t>(word >> 32u)];
+                ++laneCounts[1][static_cast<uint8_t>(word >> 40u)];
+                ++laneCounts[2][static_cast<uint8_t>(word >> 48u)];
+                ++laneCounts[3][static_cast<uint8_t>(word >> 56u)];
+            }
+        }
+
+        for (; it < blockLength; ++it)
+            ++laneCounts[it % numberOfLanes][block[it]];
+
+        for (size_t symbol{0u}; symbol < numberOfSymbols; ++symbol)
+            counts[symbol] = laneCounts[0][symbol] + laneCounts[1][symbol] + laneCounts[2][symbol] + laneCounts[3][symbol];
+
+        // H = log2(n) - sum(c * log2(c)) / n over the symbol counts c of the n bytes of the block.
+
+        double weightedLogSum{0.0};
+
+        for (const uint32_t count : counts)
+            if (count > 1u)
+                weightedLogSum += static_cast<double>(count) * std::log2(static_cast<double>(count));
+
+        const double length{static_cast<double>(blockLength)};
+
+        entropies_.push_back(static_cast<float>(std::max(std::log2(length) - weightedLogSum / length, 0.0)));
+    }
+}
@@ -0,0 +1,66 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <cstddef>
+#include <vector>
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Shannon entropy of every fixed-size block of a buffer, in bits per byte.
+ *
+ * Each block is counted into four interleaved byte histograms, so consecutive bytes do not wait on each other's
+ * counter updates, and the lanes are summed before the entropy is taken.  The final block may be shorter than the
+ * others, in which case its entropy is bounded by the logarithm of its own size.
+ */
+class EntropyMap
+{
+public:
+    EntropyMap() = default;
+    ~EntropyMap() = default;
+
+    EntropyMap(const EntropyMap&) = default;
+    EntropyMap(EntropyMap&&) = default;
+
+    EntropyMap& operator=(const EntropyMap&) = default;
+    EntropyMap& operator=(EntropyMap&&) = default;
+
+    /**
+     * @brief Measures the blocks [i * blockSize, (i + 1) * blockSize) of the buffer.  Throws a RuntimeException when
+     * the block size is zero.
+     */
+    EntropyMap(const char* const buffer, const size_t size, const size_t blockSize);
+
+    size_t GetBlockSize() const noexcept { return blockSize_; }
+
+    size_t GetNumberOfBlocks() const noexcept { return entropies_.size(); }
+
+    /**
+     * @brief Entropy of a block, between 0 and 8 bits per byte.  The block index must be less than GetNumberOfBlocks.
+     */
+    float GetEntropy(const size_t blockIndex) const noexcept { return entropies_[blockIndex]; }
+
+private:
+    std::vector<float> entropies_;
+    size_t blockSize_{1u};
+};
+}
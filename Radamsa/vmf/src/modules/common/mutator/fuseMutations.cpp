@@ -0,0 +1,372 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "fuseMutations.hpp"
+
+uint64_t vmf::radamsa::mutations::FuseMutations::GetKGramHash(const char* const kGram) noexcept
+{
+    // A k-gram is short enough to be packed into a single word, so the rolling window value is its own hash.
+
+    uint64_t hash{0u};
+
+    for (size_t it{0u}; it < KGramIndex::KGRAM_LENGTH; ++it)
+        hash = (hash << 8u) | static_cast<uint8_t>(kGram[it]);
+
+    return hash;
+}
+
+vmf::radamsa::mutations::FuseMutations::KGramIndex vmf::radamsa::mutations::FuseMutations::BuildKGramIndex(
+                                                                                                    const char* const buffer,
+                                                                                                    const size_t size)
+{
+    constexpr size_t kGramLength{KGramIndex::KGRAM_LENGTH};
+    constexpr uint64_t windowMask{(uint64_t{1u} << (8u * kGramLength)) - 1u};
+    constexpr size_t minimumBucketBits{4u};
+
+    KGramIndex index;
+
+    if (buffer == nullptr || size < kGramLength)
+        return index;
+
+    const size_t numberOfKGrams{size - kGramLength + 1u};
+
+    // Use roughly one bucket per k-gram so that the expected bucket length is constant.
+
+    size_t bucketBits{minimumBucketBits};
+
+    while ((size_t{1u} << bucketBits) < numberOfKGrams)
+        ++bucketBits;
+
+    const size_t numberOfBuckets{size_t{1u} << bucketBits};
+
+    index.BucketBits = bucketBits;
+    index.BucketOffsets.assign(numberOfBuckets + 1u, 0u);
+    index.Positions.resize(numberOfKGrams);
+
+    // First pass - count the k-grams in each bucket.
+
+    uint64_t window{GetKGramHash(buffer) >> 8u};
+
+    for (size_t it{kGramLength - 1u}; it < size; ++it)
+    {
+        window = ((window << 8u) | static_cast<uint8_t>(buffer[it])) & windowMask;
+
+        ++index.BucketOffsets[index.GetBucket(window) + 1u];
+    }
+
+    for (size_t bucket{0u}; bucket < numberOfBuckets; ++bucket)
+        index.BucketOffsets[bucket + 1u] += index.BucketOffsets[bucket];
+
+    // Second pass - scatter the k-gram start positions into their buckets.
+
+    std::vector<uint32_t> nextSlot(index.BucketOffsets.begin(), index.BucketOffsets.end() - 1);
+
+    window = GetKGramHash(buffer) >> 8u;
+
+    for (size_t it{kGramLength - 1u}; it < size; ++it)
+    {
+        window = ((window << 8u) | static_cast<uint8_t>(buffer[it])) & windowMask;
+
+        index.Positions[nextSlot[index.GetBucket(window)]++] = static_cast<uint32_t>(it + 1u - kGramLength);
+    }
+
+    return index;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::FuseMutations::KGramIndex> vmf::radamsa::mutations::FuseMutations::GetKGramIndex(
+                                                                                                                            const char* const buffer,
+                                                                                                                            const size_t size,
+                                                                                                                            const unsigned long seedId)
+{
+    return kGramIndexCache_.GetOrBuild(
+                                seedId,
+                                [&]() { return BuildKGramIndex(buffer, size); });
+}
+
+bool vmf::radamsa::mutations::FuseMutations::FindFusePoint(
+                                                        const char* const sourceBuffer,
+                                                        const size_t minimumSourceIndex,
+                                                        const size_t maximumSourceIndex,
+                                                        const char* const targetBuffer,
+                                                        const KGramIndex& targetKGramIndex,
+                                                        const bool isSameBuffer,
+                                                        size_t& sourceIndex,
+                                                        size_t& targetIndex)
+{
+    // Pick random k-grams in the source buffer and look each one up in the target index.
+    // Only a few candidates of a bucket are checked, so a highly repetitive buffer cannot make a lookup linear.
+
+    constexpr size_t numberOfSourceAttempts{8u};
+    constexpr size_t numberOfCandidateAttempts{4u};
+
+    if (targetKGramIndex.IsEmpty() || minimumSourceIndex > maximumSourceIndex)
+        return false;
+
+    for (size_t attempt{0u}; attempt < numberOfSourceAttempts; ++attempt)
+    {
+        const size_t randomSourceIndex{GetRandomValueWithinBounds(minimumSourceIndex, maximumSourceIndex)};
+        const uint64_t sourceHash{GetKGramHash(&sourceBuffer[randomSourceIndex])};
+        const size_t bucket{targetKGramIndex.GetBucket(sourceHash)};
+        const size_t bucketStart{targetKGramIndex.BucketOffsets[bucket]};
+        const size_t bucketEnd{targetKGramIndex.BucketOffsets[bucket + 1u]};
+
+        if (bucketStart == bucketEnd)
+            continue;
+
+        for (size_t candidate{0u}; candidate < numberOfCandidateAttempts; ++candidate)
+        {
+            const size_t position{targetKGramIndex.Positions[GetRandomValueWithinBounds(bucketStart, bucketEnd - 1u)]};
+
+            if (isSameBuffer && position == randomSourceIndex)
+                continue;
+
+            if (GetKGramHash(&targetBuffer[position]) == sourceHash)
+            {
+                sourceIndex = randomSourceIndex;
+                targetIndex = position;
+
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void vmf::radamsa::mutations::FuseMutations::FuseThis(
+                                                    StorageEntry* newEntry,
+                                                    const size_t originalSize,
+                                                    const char* originalBuffer,
+                                                    const unsigned long originalId,
+                                                    const size_t minimumSeedIndex,
+                                                    const int testCaseKey)
+{
+    // Consume the original buffer by jumping from one occurrence of a k-gram to another occurrence of it and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    constexpr size_t kGramLength{KGramIndex::KGRAM_LENGTH};
+
+    size_t jumpFromIndex{0u};
+    size_t jumpToIndex{0u};
+
+    const bool isFusePointFound{
+                            originalSize >= kGramLength &&
+                            FindFusePoint(
+                                    originalBuffer,
+                                    minimumSeedIndex,
+                                    originalSize - kGramLength,
+                                    originalBuffer,
+                                    *GetKGramIndex(originalBuffer, originalSize, originalId),
+                                    true,
+                                    jumpFromIndex,
+                                    jumpToIndex)};
+
+    if (!isFusePointFound)
+    {
+        // No repeated k-gram was found, so jump between two random positions instead.
+
+        jumpFromIndex = GetRandomValueWithinBounds(minimumSeedIndex, originalSize - 1u);
+        jumpToIndex = GetRandomValueWithinBounds(0u, originalSize - 1u);
+    }
+
+    // The new buffer holds the prefix before the jump and the suffix after it;
+    // additionally, it will contain one additional byte since a null-terminator will be appended to the end.
+
+    const size_t prefixSize{jumpFromIndex};
+    const size_t suffixSize{originalSize - jumpToIndex};
+    const size_t newBufferSize{prefixSize + suffixSize + 1u};
+
+    char* newBuffer{newEntry->allocateBuffer(testCaseKey, static_cast<int>(newBufferSize))};
+
+    memcpy(newBuffer, originalBuffer, prefixSize);
+    memcpy(newBuffer + prefixSize, originalBuffer + jumpToIndex, suffixSize);
+    newBuffer[newBufferSize - 1u] = '\0';
+}
+
+void vmf::radamsa::mutations::FuseMutations::FuseNext(
+                                                    StorageEntry* newEntry,
+                                                    const size_t originalSize,
+                                                    const char* originalBuffer,
+                                                    const unsigned long /*originalId*/,
+                                                    const size_t otherSize,
+                                                    const char* otherBuffer,
+                                                    const unsigned long otherId,
+                                                    const size_t minimumSeedIndex,
+                                                    const int testCaseKey)
+{
+    // Consume the original buffer up to a k-gram, continue with the other buffer from the same k-gram and append a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize || otherSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr || otherBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    constexpr size_t kGramLength{KGramIndex::KGRAM_LENGTH};
+
+    size_t jumpFromIndex{0u};
+    size_t jumpToIndex{0u};
+
+    const bool isFusePointFound{
+                            originalSize >= kGramLength &&
+                            otherSize >= kGramLength &&
+                            FindFusePoint(
+                                    originalBuffer,
+                                    minimumSeedIndex,
+                                    originalSize - kGramLength,
+                                    otherBuffer,
+                                    *GetKGramIndex(otherBuffer, otherSize, otherId),
+                                    originalBuffer == otherBuffer,
+                                    jumpFromIndex,
+                                    jumpToIndex)};
+
+    if (!isFusePointFound)
+    {
+        // The buffers share no k-gram, so splice them at random positions instead.
+
+        jumpFromIndex = GetRandomValueWithinBounds(minimumSeedIndex, originalSize - 1u);
+        jumpToIndex = GetRandomValueWithinBounds(0u, otherSize - 1u);
+    }
+
+    // The new buffer holds the original prefix and the other suffix;
+    // additionally, it will contain one additional byte since a null-terminator will be appended to the end.
+
+    const size_t prefixSize{jumpFromIndex};
+    const size_t suffixSize{otherSize - jumpToIndex};
+    const size_t newBufferSize{prefixSize + suffixSize + 1u};
+
+    char* newBuffer{newEntry->allocateBuffer(testCaseKey, static_cast<int>(newBufferSize))};
+
+    memcpy(newBuffer, originalBuffer, prefixSize);
+    memcpy(newBuffer + prefixSize, otherBuffer + jumpToIndex, suffixSize);
+    newBuffer[newBufferSize - 1u] = '\0';
+}
+
+void vmf::radamsa::mutations::FuseMutations::FuseOld(
+                                                    StorageEntry* newEntry,
+                                                    const size_t originalSize,
+                                                    const char* originalBuffer,
+                                                    const unsigned long originalId,
+                                                    const size_t otherSize,
+                                                    const char* otherBuffer,
+                                                    const unsigned long otherId,
+                                                    const size_t minimumSeedIndex,
+                                                    const int testCaseKey)
+{
+    // Consume the original buffer by fusing into the other buffer, fusing back into the original buffer further on
+    // and appending a null-terminator to the end. The result is a run of previously seen data embedded in the original buffer.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize || otherSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr || otherBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    constexpr size_t kGramLength{KGramIndex::KGRAM_LENGTH};
+
+    const bool hasKGrams{originalSize >= kGramLength && otherSize >= kGramLength};
+
+    // Jump into the other buffer.
+
+    size_t jumpOutIndex{0u};
+    size_t jumpInIndex{0u};
+
+    const bool isFirstFusePointFound{
+                                hasKGrams &&
+                                FindFusePoint(
+                                        originalBuffer,
+                                        minimumSeedIndex,
+                                        originalSize - kGramLength,
+                                        otherBuffer,
+                                        *GetKGramIndex(otherBuffer, otherSize, otherId),
+                                        originalBuffer == otherBuffer,
+                                        jumpOutIndex,
+                                        jumpInIndex)};
+
+    if (!isFirstFusePointFound)
+    {
+        jumpOutIndex = GetRandomValueWithinBounds(minimumSeedIndex, originalSize - 1u);
+        jumpInIndex = GetRandomValueWithinBounds(0u, otherSize - 1u);
+    }
+
+    // Jump back into the original buffer somewhere after the other buffer's shared k-gram.
+
+    size_t jumpBackIndex{otherSize};
+    size_t resumeIndex{jumpOutIndex};
+
+    const size_t minimumJumpBackIndex{jumpInIndex + 1u};
+
+    const bool isSecondFusePointFound{
+                                hasKGrams &&
+                                minimumJumpBackIndex + kGramLength <= otherSize &&
+                                FindFusePoint(
+                                        otherBuffer,
+                                        minimumJumpBackIndex,
+                                        otherSize - kGramLength,
+                                        originalBuffer,
+                                        *GetKGramIndex(originalBuffer, originalSize, originalId),
+                                        false,
+                                        jumpBackIndex,
+                                        resumeIndex)};
+
+    if (!isSecondFusePointFound)
+    {
+        // Insert the remainder of the other buffer and resume the original buffer where it was left.
+
+        jumpBackIndex = otherSize;
+        resumeIndex = jumpOutIndex;
+    }
+
+    // The new buffer holds the original prefix, the borrowed run and the original suffix;
+    // additionally, it will contain one additional byte since a null-terminator will be appended to the end.
+
+    const size_t prefixSize{jumpOutIndex};
+    const size_t borrowedSize{jumpBackIndex - jumpInIndex};
+    const size_t suffixSize{originalSize - resumeIndex};
+    const size_t newBufferSize{prefixSize + borrowedSize + suffixSize + 1u};
+
+    char* newBuffer{newEntry->allocateBuffer(testCaseKey, static_cast<int>(newBufferSize))};
+
+    memcpy(newBuffer, originalBuffer, prefixSize);
+    memcpy(newBuffer + prefixSize, otherBuffer + jumpInIndex, borrowedSize);
+    memcpy(newBuffer + prefixSize + borrowedSize, originalBuffer + resumeIndex, suffixSize);
+    newBuffer[newBufferSize - 1u] = '\0';
+}
@@ -0,0 +1,133 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <cstdint>
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "seedCache.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Implements the radamsa fuse mutations (ft, fn and fo).
+ *
+ * A fuse splices two buffers together at a point where they share a common substring,
+ * which keeps the output locally well formed around the splice.  Fuse points are found
+ * through a k-gram hash index of the buffer being jumped into.  The index is built the first
+ * time a seed is fused and is cached by storage entry ID, so each fuse point costs an expected
+ * constant number of lookups rather than a quadratic substring search.
+ */
+class FuseMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    /**
+     * @brief Hash index of every k-gram in a buffer.
+     *
+     * Positions are grouped by hash bucket in a single flat array; the positions of bucket b
+     * are Positions[BucketOffsets[b]] up to (but excluding) Positions[BucketOffsets[b + 1]].
+     */
+    struct KGramIndex
+    {
+        static constexpr size_t KGRAM_LENGTH{4u};
+
+        bool IsEmpty() const noexcept { return Positions.empty(); }
+
+        size_t GetBucket(const uint64_t hash) const noexcept { return static_cast<size_t>((hash * 0x9E3779B97F4A7C15u) >> (64u - BucketBits)); }
+
+        std::vector<uint32_t> BucketOffsets;
+        std::vector<uint32_t> Positions;
+        size_t BucketBits{0u};
+    };
+
+    FuseMutations() = delete;
+    virtual ~FuseMutations() = default;
+
+    FuseMutations(const FuseMutations&) = delete;
+    FuseMutations(FuseMutations&&) = delete;
+
+    FuseMutations& operator=(const FuseMutations&) = delete;
+    FuseMutations& operator=(FuseMutations&&) = delete;
+
+    void FuseThis(
+            StorageEntry* newEntry,
+            const size_t originalSize,
+            const char* originalBuffer,
+            const unsigned long originalId,
+            const size_t minimumSeedIndex,
+            const int testCaseKey);
+
+    void FuseNext(
+            StorageEntry* newEntry,
+            const size_t originalSize,
+            const char* originalBuffer,
+            const unsigned long originalId,
+            const size_t otherSize,
+            const char* otherBuffer,
+            const unsigned long otherId,
+            const size_t minimumSeedIndex,
+            const int testCaseKey);
+
+    void FuseOld(
+            StorageEntry* newEntry,
+            const size_t originalSize,
+            const char* originalBuffer,
+            const unsigned long originalId,
+            const size_t otherSize,
+            const char* otherBuffer,
+            const unsigned long otherId,
+            const size_t minimumSeedIndex,
+            const int testCaseKey);
+
+protected:
+    FuseMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static KGramIndex BuildKGramIndex(
+                                const char* const buffer,
+                                const size_t size);
+
+    static uint64_t GetKGramHash(const char* const kGram) noexcept;
+
+    std::shared_ptr<const KGramIndex> GetKGramIndex(
+                                                const char* const buffer,
+                                                const size_t size,
+                                                const unsigned long seedId);
+
+    bool FindFusePoint(
+                    const char* const sourceBuffer,
+                    const size_t minimumSourceIndex,
+                    const size_t maximumSourceIndex,
+                    const char* const targetBuffer,
+                    const KGramIndex& targetKGramIndex,
+                    const bool isSameBuffer,
+                    size_t& sourceIndex,
+                    size_t& targetIndex);
+
+private:
+    SeedCache<KGramIndex> kGramIndexCache_;
+};
+}
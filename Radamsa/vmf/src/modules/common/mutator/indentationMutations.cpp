@@ -0,0 +1,376 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <cstring>
+
+// VMF Includes
+#include "indentationMutations.hpp"
+#include "bufferSegments.hpp"
+#include "simdScan.hpp"
+
+namespace
+{
+using IndentationIndex = vmf::radamsa::mutations::IndentationMutations::IndentationIndex;
+
+size_t GetBlockEndIndex(const IndentationIndex& index, const size_t lineIndex) noexcept
+{
+    return index.Lines[index.Lines[lineIndex].BlockEndLine - 1u].EndIndex;
+}
+}
+
+vmf::radamsa::mutations::IndentationMutations::IndentationIndex vmf::radamsa::mutations::IndentationMutations::BuildIndentationIndex(
+                                                                                                                            const char* const buffer,
+                                                                                                                            const size_t size)
+{
+    IndentationIndex index;
+
+    if (buffer == nullptr)
+        return index;
+
+    // Lines whose blocks are still open, from the outermost to the innermost. A new line closes every open
+    // block at its own depth or deeper; the last one closed at exactly its depth is its preceding sibling.
+
+    std::vector<size_t> openLines;
+
+    auto addLine{
+            [&](const size_t startIndex, const size_t endIndex)
+            {
+                size_t depth{0u};
+
+                while (startIndex + depth < endIndex && (buffer[startIndex + depth] == ' ' || buffer[startIndex + depth] == '\t'))
+                    ++depth;
+
+                const size_t contentIndex{startIndex + depth};
+
+                if (contentIndex == endIndex || buffer[contentIndex] == '\n' || buffer[contentIndex] == '\r')
+                    return;
+
+                const size_t lineIndex{index.Lines.size()};
+
+                while (!openLines.empty() && index.Lines[openLines.back()].Depth >= depth)
+                {
+                    IndentedLine& openLine{index.Lines[openLines.back()]};
+
+                    openLine.BlockEndLine = lineIndex;
+
+                    if (openLine.Depth == depth)
+                        index.SiblingLines.push_back(openLines.back());
+
+                    openLines.pop_back();
+                }
+
+                index.Lines.push_back(IndentedLine{startIndex, endIndex, depth, 0u});
+                openLines.push_back(lineIndex);
+            }};
+
+    size_t lineStartIndex{0u};
+
+    simd::ForEachBlock(
+                buffer,
+                size,
+                [&](const char* const block, const size_t blockOffset, const uint64_t validMask)
+                {
+                    for (uint64_t mask{simd::EqualMask(block, '\n') & validMask}; mask != 0u; mask &= mask - 1u)
+                    {
+                        const size_t lineEndIndex{blockOffset + simd::CountTrailingZeros(mask) + 1u};
+
+                        addLine(lineStartIndex, lineEndIndex);
+
+                        lineStartIndex = lineEndIndex;
+                    }
+                });
+
+    if (lineStartIndex < size)
+        addLine(lineStartIndex, size);
+
+    for (const size_t openLine : openLines)
+        index.Lines[openLine].BlockEndLine = index.Lines.size();
+
+    // Siblings are found when the following block starts, which is not always in line order.
+
+    std::sort(index.SiblingLines.begin(), index.SiblingLines.end());
+
+    return index;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::IndentationMutations::IndentationIndex> vmf::radamsa::mutations::IndentationMutations::GetIndentationIndex(
+                                                                                                                                                    const char* const buffer,
+                                                                                                                                                    const size_t size,
+                                                                                                                                                    const unsigned long seedId)
+{
+    return indentationIndexCache_.GetOrBuild(
+                                        seedId,
+                                        [&]() { return BuildIndentationIndex(buffer, size); });
+}
+
+bool vmf::radamsa::mutations::IndentationMutations::GetRandomLineIndex(
+                                                                const IndentationIndex& index,
+                                                                const size_t minimumSeedIndex,
+                                                                size_t& lineIndex)
+{
+    // Lines are in document order, so the ones at or after the minimum seed index form a suffix of the list.
+
+    const auto firstLine{
+                    std::partition_point(
+                                    index.Lines.begin(),
+                                    index.Lines.end(),
+                                    [&](const IndentedLine& line) { return line.StartIndex < minimumSeedIndex; })};
+
+    if (firstLine == index.Lines.end())
+        return false;
+
+    lineIndex = GetRandomValueWithinBounds(
+                                    static_cast<size_t>(firstLine - index.Lines.begin()),
+                                    index.Lines.size() - 1u);
+
+    return true;
+}
+
+void vmf::radamsa::mutations::IndentationMutations::DeleteBlock(
+                                                            StorageEntry* newEntry,
+                                                            const size_t originalSize,
+                                                            const char* originalBuffer,
+                                                            const unsigned long originalId,
+                                                            const size_t minimumSeedIndex,
+                                                            const int testCaseKey)
+{
+    // Consume the original buffer by removing a random indentation block and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const IndentationIndex> index{GetIndentationIndex(originalBuffer, originalSize, originalId)};
+
+    size_t lineIndex{0u};
+
+    if (!GetRandomLineIndex(*index, minimumSeedIndex, lineIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const size_t blockStartIndex{index->Lines[lineIndex].StartIndex};
+    const size_t blockEndIndex{GetBlockEndIndex(*index, lineIndex)};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, blockStartIndex},
+             {originalBuffer + blockEndIndex, originalSize - blockEndIndex}});
+}
+
+void vmf::radamsa::mutations::IndentationMutations::DuplicateBlock(
+                                                                StorageEntry* newEntry,
+                                                                const size_t originalSize,
+                                                                const char* originalBuffer,
+                                                                const unsigned long originalId,
+                                                                const size_t minimumSeedIndex,
+                                                                const int testCaseKey)
+{
+    // Consume the original buffer by repeating a random indentation block right after itself and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const IndentationIndex> index{GetIndentationIndex(originalBuffer, originalSize, originalId)};
+
+    size_t lineIndex{0u};
+
+    if (!GetRandomLineIndex(*index, minimumSeedIndex, lineIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const size_t blockStartIndex{index->Lines[lineIndex].StartIndex};
+    const size_t blockEndIndex{GetBlockEndIndex(*index, lineIndex)};
+
+    // The last block of a buffer without a trailing newline needs one, or the copy would continue its last line.
+
+    const bool hasNewline{originalBuffer[blockEndIndex - 1u] == '\n'};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, blockEndIndex},
+             {"\n", hasNewline ? 0u : 1u},
+             {originalBuffer + blockStartIndex, blockEndIndex - blockStartIndex},
+             {originalBuffer + blockEndIndex, originalSize - blockEndIndex}});
+}
+
+void vmf::radamsa::mutations::IndentationMutations::SwapBlocks(
+                                                            StorageEntry* newEntry,
+                                                            const size_t originalSize,
+                                                            const char* originalBuffer,
+                                                            const unsigned long originalId,
+                                                            const size_t minimumSeedIndex,
+                                                            const int testCaseKey)
+{
+    // Consume the original buffer by swapping a random indentation block with the following block of the same depth and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const IndentationIndex> index{GetIndentationIndex(originalBuffer, originalSize, originalId)};
+
+    const auto firstSibling{
+                        std::partition_point(
+                                        index->SiblingLines.begin(),
+                                        index->SiblingLines.end(),
+                                        [&](const size_t line) { return index->Lines[line].StartIndex < minimumSeedIndex; })};
+
+    if (firstSibling == index->SiblingLines.end())
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const size_t firstLineIndex{
+                            index->SiblingLines[
+                                            GetRandomValueWithinBounds(
+                                                                static_cast<size_t>(firstSibling - index->SiblingLines.begin()),
+                                                                index->SiblingLines.size() - 1u)]};
+    const size_t secondLineIndex{index->Lines[firstLineIndex].BlockEndLine};
+
+    const size_t firstStartIndex{index->Lines[firstLineIndex].StartIndex};
+    const size_t firstEndIndex{GetBlockEndIndex(*index, firstLineIndex)};
+    const size_t secondStartIndex{index->Lines[secondLineIndex].StartIndex};
+    const size_t secondEndIndex{GetBlockEndIndex(*index, secondLineIndex)};
+
+    // The blank lines between the blocks stay between them. The first block always ends with a newline,
+    // but the second one does not when it ends the buffer, in which case the newline moves with the swap.
+
+    const bool hasNewline{originalBuffer[secondEndIndex - 1u] == '\n'};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, firstStartIndex},
+             {originalBuffer + secondStartIndex, secondEndIndex - secondStartIndex},
+             {"\n", hasNewline ? 0u : 1u},
+             {originalBuffer + firstEndIndex, secondStartIndex - firstEndIndex},
+             {originalBuffer + firstStartIndex, firstEndIndex - firstStartIndex - (hasNewline ? 0u : 1u)},
+             {originalBuffer + secondEndIndex, originalSize - secondEndIndex}});
+}
+
+void vmf::radamsa::mutations::IndentationMutations::ReindentBlock(
+                                                                StorageEntry* newEntry,
+                                                                const size_t originalSize,
+                                                                const char* originalBuffer,
+                                                                const unsigned long originalId,
+                                                                const size_t minimumSeedIndex,
+                                                                const int testCaseKey)
+{
+    // Consume the original buffer by shifting every line of a random indentation block left or right and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const IndentationIndex> index{GetIndentationIndex(originalBuffer, originalSize, originalId)};
+
+    size_t lineIndex{0u};
+
+    if (!GetRandomLineIndex(*index, minimumSeedIndex, lineIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const IndentedLine& blockLine{index->Lines[lineIndex]};
+
+    // Blocks at depth zero can only be indented. Indentation reuses the first whitespace byte of the block.
+
+    const size_t change{GetRandomValueWithinBounds(1u, MAXIMUM_INDENTATION_CHANGE)};
+    const bool isDedent{blockLine.Depth > 0u && GetRandomValueWithinBounds(0u, 1u) == 1u};
+    const char indentation{(blockLine.Depth > 0u) ? originalBuffer[blockLine.StartIndex] : ' '};
+
+    size_t newBufferSize{originalSize + 1u};
+
+    for (size_t it{lineIndex}; it < blockLine.BlockEndLine; ++it)
+        newBufferSize = isDedent ? newBufferSize - std::min(change, index->Lines[it].Depth) : newBufferSize + change;
+
+    char* newBuffer{newEntry->allocateBuffer(testCaseKey, static_cast<int>(newBufferSize))};
+    char* destination{newBuffer};
+
+    size_t sourceIndex{0u};
+
+    for (size_t it{lineIndex}; it < blockLine.BlockEndLine; ++it)
+    {
+        const IndentedLine& line{index->Lines[it]};
+
+        // Copy everything up to the line, including any blank lines in between, then the re-indented line.
+
+        memcpy(destination, originalBuffer + sourceIndex, line.StartIndex - sourceIndex);
+        destination += line.StartIndex - sourceIndex;
+
+        if (isDedent)
+        {
+            sourceIndex = line.StartIndex + std::min(change, line.Depth);
+        }
+        else
+        {
+            memset(destination, indentation, change);
+            destination += change;
+
+            sourceIndex = line.StartIndex;
+        }
+    }
+
+    memcpy(destination, originalBuffer + sourceIndex, originalSize - sourceIndex);
+    newBuffer[newBufferSize - 1u] = '\0';
+}
@@ -0,0 +1,130 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "seedCache.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Line mutations that work on whole indentation blocks of YAML, Python and similar inputs.
+ *
+ * A block is a line together with the lines below it that are indented deeper, so deleting,
+ * duplicating, swapping or re-indenting a block keeps the nesting of the lines around it intact.
+ * The lines of a seed and the leading whitespace depth of each are recorded in the same pass that
+ * finds its newlines, which also resolves where the block of every line ends.  Selecting a block is
+ * then a lookup, and the index is cached by storage entry ID.
+ */
+class IndentationMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    static constexpr size_t MAXIMUM_INDENTATION_CHANGE{8u};
+
+    struct IndentedLine
+    {
+        size_t StartIndex{0u};   // Offset of the first byte of the line.
+        size_t EndIndex{0u};     // Offset one past the newline that ends the line, or the buffer size for the last line.
+        size_t Depth{0u};        // Number of leading space and tab bytes.
+        size_t BlockEndLine{0u}; // Index of the first line after the block of this line.
+    };
+
+    /**
+     * @brief Non-blank lines of a buffer in document order.
+     *
+     * Blank lines do not open or close blocks, so they are left out; the ones inside a block are still
+     * covered by the byte range of the block.
+     */
+    struct IndentationIndex
+    {
+        std::vector<IndentedLine> Lines;
+        std::vector<size_t> SiblingLines; // Lines whose block is directly followed by a block of the same depth, in order.
+    };
+
+    IndentationMutations() = delete;
+    virtual ~IndentationMutations() = default;
+
+    IndentationMutations(const IndentationMutations&) = delete;
+    IndentationMutations(IndentationMutations&&) = delete;
+
+    IndentationMutations& operator=(const IndentationMutations&) = delete;
+    IndentationMutations& operator=(IndentationMutations&&) = delete;
+
+    void DeleteBlock(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+    void DuplicateBlock(
+                    StorageEntry* newEntry,
+                    const size_t originalSize,
+                    const char* originalBuffer,
+                    const unsigned long originalId,
+                    const size_t minimumSeedIndex,
+                    const int testCaseKey);
+
+    void SwapBlocks(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+    void ReindentBlock(
+                    StorageEntry* newEntry,
+                    const size_t originalSize,
+                    const char* originalBuffer,
+                    const unsigned long originalId,
+                    const size_t minimumSeedIndex,
+                    const int testCaseKey);
+
+protected:
+    IndentationMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static IndentationIndex BuildIndentationIndex(
+                                            const char* const buffer,
+                                            const size_t size);
+
+    std::shared_ptr<const IndentationIndex> GetIndentationIndex(
+                                                            const char* const buffer,
+                                                            const size_t size,
+                                                            const unsigned long seedId);
+
+    bool GetRandomLineIndex(
+                        const IndentationIndex& index,
+                        const size_t minimumSeedIndex,
+                        size_t& lineIndex);
+
+private:
+    SeedCache<IndentationIndex> indentationIndexCache_;
+};
+}
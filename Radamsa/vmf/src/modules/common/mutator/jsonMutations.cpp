@@ -0,0 +1,445 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <limits>
+
+// VMF Includes
+#include "jsonMutations.hpp"
+#include "bufferSegments.hpp"
+#include "simdScan.hpp"
+
+namespace
+{
+constexpr uint32_t NO_INDEX{std::numeric_limits<uint32_t>::max()};
+
+bool IsJsonWhitespace(const char character) noexcept
+{
+    return character == ' ' || character == '\t' || character == '\n' || character == '\r';
+}
+}
+
+vmf::radamsa::mutations::JsonMutations::JsonIndex vmf::radamsa::mutations::JsonMutations::BuildJsonIndex(
+                                                                                                    const char* const buffer,
+                                                                                                    const size_t size)
+{
+    JsonIndex jsonIndex;
+
+    if (buffer == nullptr || size > NO_INDEX)
+        return jsonIndex;
+
+    // First pass - locate the structural characters that are not inside strings.
+
+    std::vector<uint32_t> structurals;
+    simd::StringScanner stringScanner;
+
+    simd::ForEachBlock(
+                buffer,
+                size,
+                [&](const char* const block, const size_t blockOffset, const uint64_t validMask)
+                {
+                    uint64_t quoteMask{0u};
+
+                    const uint64_t inStringMask{stringScanner.Next(block, quoteMask)};
+                    const uint64_t structuralMask{
+                                            (simd::EqualMask(block, '{') | simd::EqualMask(block, '}') |
+                                             simd::EqualMask(block, '[') | simd::EqualMask(block, ']') |
+                                             simd::EqualMask(block, ':') | simd::EqualMask(block, ',')) & ~inStringMask & validMask};
+
+                    for (uint64_t mask{structuralMask}; mask != 0u; mask &= mask - 1u)
+                        structurals.push_back(static_cast<uint32_t>(blockOffset + simd::CountTrailingZeros(mask)));
+                });
+
+    // Second pass - walk the structural characters with a stack of open containers. Containers are recorded when they open,
+    // scalars when the delimiter after them is reached, so the values stay in document order.
+
+    struct Frame
+    {
+        ContainerType Type;
+        uint32_t ValueIndex;
+        uint32_t MemberStartIndex;
+        uint32_t ValueStartIndex; // NO_INDEX until the ':' of an object member is reached.
+        uint32_t ChildIndex;      // Value index of the container in the current member, if any.
+    };
+
+    std::vector<Frame> frames;
+    std::vector<JsonValue>& values{jsonIndex.Values};
+
+    auto closeMember{
+                [&](const Frame& frame, const uint32_t delimiterIndex)
+                {
+                    if (frame.ChildIndex != NO_INDEX)
+                    {
+                        values[frame.ChildIndex].MemberEndIndex = delimiterIndex;
+
+                        return;
+                    }
+
+                    if (frame.ValueStartIndex == NO_INDEX)
+                        return;
+
+                    uint32_t startIndex{frame.ValueStartIndex};
+                    uint32_t endIndex{delimiterIndex};
+
+                    while (startIndex < endIndex && IsJsonWhitespace(buffer[startIndex]))
+                        ++startIndex;
+
+                    while (endIndex > startIndex && IsJsonWhitespace(buffer[endIndex - 1u]))
+                        --endIndex;
+
+                    if (startIndex < endIndex)
+                        values.push_back(JsonValue{startIndex, endIndex, frame.MemberStartIndex, delimiterIndex, frame.Type});
+                }};
+
+    for (const uint32_t index : structurals)
+    {
+        const char character{buffer[index]};
+
+        if (character == '{' || character == '[')
+        {
+            const ContainerType type{(character == '{') ? ContainerType::Object : ContainerType::Array};
+            const uint32_t valueIndex{static_cast<uint32_t>(values.size())};
+
+            if (frames.empty())
+                values.push_back(JsonValue{index, 0u, index, 0u, ContainerType::None});
+            else
+            {
+                Frame& parent{frames.back()};
+
+                if (parent.ValueStartIndex == NO_INDEX || parent.ChildIndex != NO_INDEX)
+                    break;
+
+                values.push_back(JsonValue{index, 0u, parent.MemberStartIndex, 0u, parent.Type});
+                parent.ChildIndex = valueIndex;
+            }
+
+            frames.push_back(Frame{type, valueIndex, index + 1u, (type == ContainerType::Array) ? index + 1u : NO_INDEX, NO_INDEX});
+        }
+        else if (character == '}' || character == ']')
+        {
+            const ContainerType type{(character == '}') ? ContainerType::Object : ContainerType::Array};
+
+            if (frames.empty() || frames.back().Type != type)
+                break;
+
+            closeMember(frames.back(), index);
+
+            JsonValue& container{values[frames.back().ValueIndex]};
+
+            container.EndIndex = index + 1u;
+
+            if (container.Parent == ContainerType::None)
+                container.MemberEndIndex = container.EndIndex;
+
+            frames.pop_back();
+        }
+        else if (!frames.empty())
+        {
+            Frame& frame{frames.back()};
+
+            if (character == ',')
+            {
+                closeMember(frame, index);
+
+                frame.MemberStartIndex = index + 1u;
+                frame.ValueStartIndex = (frame.Type == ContainerType::Array) ? index + 1u : NO_INDEX;
+                frame.ChildIndex = NO_INDEX;
+            }
+            else if (frame.Type == ContainerType::Object && frame.ValueStartIndex == NO_INDEX)
+                frame.ValueStartIndex = index + 1u; // ':'
+        }
+    }
+
+    // Drop the values of a truncated or malformed tail, which were never closed.
+
+    values.erase(
+            std::remove_if(
+                    values.begin(),
+                    values.end(),
+                    [](const JsonValue& value) { return value.EndIndex == 0u || value.MemberEndIndex == 0u; }),
+            values.end());
+
+    for (size_t it{0u}; it < values.size(); ++it)
+    {
+        if (values[it].Parent == ContainerType::Array)
+            jsonIndex.ArrayMembers.push_back(static_cast<uint32_t>(it));
+        else if (values[it].Parent == ContainerType::Object)
+            jsonIndex.ObjectMembers.push_back(static_cast<uint32_t>(it));
+    }
+
+    return jsonIndex;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::JsonMutations::JsonIndex> vmf::radamsa::mutations::JsonMutations::GetJsonIndex(
+                                                                                                                        const char* const buffer,
+                                                                                                                        const size_t size,
+                                                                                                                        const unsigned long seedId)
+{
+    return jsonIndexCache_.GetOrBuild(
+                                seedId,
+                                [&]() { return BuildJsonIndex(buffer, size); });
+}
+
+bool vmf::radamsa::mutations::JsonMutations::GetRandomValueIndex(
+                                                            const JsonIndex& jsonIndex,
+                                                            const size_t minimumSeedIndex,
+                                                            size_t& valueIndex)
+{
+    // Values are in document order, so the ones at or after the minimum seed index form a suffix of the list.
+
+    const std::vector<JsonValue>& values{jsonIndex.Values};
+
+    const auto firstValue{
+                    std::partition_point(
+                                    values.begin(),
+                                    values.end(),
+                                    [&](const JsonValue& value) { return value.StartIndex < minimumSeedIndex; })};
+
+    if (firstValue == values.end())
+        return false;
+
+    valueIndex = GetRandomValueWithinBounds(static_cast<size_t>(firstValue - values.begin()), values.size() - 1u);
+
+    return true;
+}
+
+bool vmf::radamsa::mutations::JsonMutations::GetRandomMemberIndex(
+                                                            const JsonIndex& jsonIndex,
+                                                            const std::vector<uint32_t>& members,
+                                                            const size_t minimumSeedIndex,
+                                                            size_t& valueIndex)
+{
+    // Members are removed or repeated together with their delimiters, so their member range must lie after the minimum seed index.
+
+    const auto firstMember{
+                    std::partition_point(
+                                    members.begin(),
+                                    members.end(),
+                                    [&](const uint32_t member) { return jsonIndex.Values[member].MemberStartIndex < minimumSeedIndex; })};
+
+    if (firstMember == members.end())
+        return false;
+
+    valueIndex = members[GetRandomValueWithinBounds(static_cast<size_t>(firstMember - members.begin()), members.size() - 1u)];
+
+    return true;
+}
+
+void vmf::radamsa::mutations::JsonMutations::SwapValues(
+                                                    StorageEntry* newEntry,
+                                                    const size_t originalSize,
+                                                    const char* originalBuffer,
+                                                    const unsigned long originalId,
+                                                    const size_t minimumSeedIndex,
+                                                    const int testCaseKey)
+{
+    // Consume the original buffer by exchanging two random non-overlapping values and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const JsonIndex> jsonIndex{GetJsonIndex(originalBuffer, originalSize, originalId)};
+
+    // A value cannot be exchanged with one of its own descendants, so retry a few random pairs before giving up.
+
+    constexpr size_t numberOfAttempts{8u};
+
+    for (size_t attempt{0u}; attempt < numberOfAttempts; ++attempt)
+    {
+        size_t firstIndex{0u};
+        size_t secondIndex{0u};
+
+        if (!GetRandomValueIndex(*jsonIndex, minimumSeedIndex, firstIndex) ||
+            !GetRandomValueIndex(*jsonIndex, minimumSeedIndex, secondIndex))
+            break;
+
+        const JsonValue& first{jsonIndex->Values[std::min(firstIndex, secondIndex)]};
+        const JsonValue& second{jsonIndex->Values[std::max(firstIndex, secondIndex)]};
+
+        if (second.StartIndex < first.EndIndex)
+            continue;
+
+        WriteSegments(
+                newEntry,
+                testCaseKey,
+                {{originalBuffer, first.StartIndex},
+                 {originalBuffer + second.StartIndex, static_cast<size_t>(second.EndIndex - second.StartIndex)},
+                 {originalBuffer + first.EndIndex, static_cast<size_t>(second.StartIndex - first.EndIndex)},
+                 {originalBuffer + first.StartIndex, static_cast<size_t>(first.EndIndex - first.StartIndex)},
+                 {originalBuffer + second.EndIndex, originalSize - second.EndIndex}});
+
+        return;
+    }
+
+    WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+}
+
+void vmf::radamsa::mutations::JsonMutations::DuplicateArrayMember(
+                                                            StorageEntry* newEntry,
+                                                            const size_t originalSize,
+                                                            const char* originalBuffer,
+                                                            const unsigned long originalId,
+                                                            const size_t minimumSeedIndex,
+                                                            const int testCaseKey)
+{
+    // Consume the original buffer by repeating a random array member right after itself and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const JsonIndex> jsonIndex{GetJsonIndex(originalBuffer, originalSize, originalId)};
+
+    size_t valueIndex{0u};
+
+    if (!GetRandomMemberIndex(*jsonIndex, jsonIndex->ArrayMembers, minimumSeedIndex, valueIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const JsonValue& value{jsonIndex->Values[valueIndex]};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, value.EndIndex},
+             {",", 1u},
+             {originalBuffer + value.StartIndex, static_cast<size_t>(value.EndIndex - value.StartIndex)},
+             {originalBuffer + value.EndIndex, originalSize - value.EndIndex}});
+}
+
+void vmf::radamsa::mutations::JsonMutations::DeleteKey(
+                                                    StorageEntry* newEntry,
+                                                    const size_t originalSize,
+                                                    const char* originalBuffer,
+                                                    const unsigned long originalId,
+                                                    const size_t minimumSeedIndex,
+                                                    const int testCaseKey)
+{
+    // Consume the original buffer by removing a random object member, key included, and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const JsonIndex> jsonIndex{GetJsonIndex(originalBuffer, originalSize, originalId)};
+
+    size_t valueIndex{0u};
+
+    if (!GetRandomMemberIndex(*jsonIndex, jsonIndex->ObjectMembers, minimumSeedIndex, valueIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    // Remove one of the commas around the member as well, preferring the one that follows it, so that the object stays well formed.
+
+    const JsonValue& value{jsonIndex->Values[valueIndex]};
+
+    size_t deletionStartIndex{value.MemberStartIndex};
+    size_t deletionEndIndex{value.MemberEndIndex};
+
+    if (originalBuffer[value.MemberEndIndex] == ',')
+        ++deletionEndIndex;
+    else if (deletionStartIndex > minimumSeedIndex && originalBuffer[deletionStartIndex - 1u] == ',')
+        --deletionStartIndex;
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, deletionStartIndex},
+             {originalBuffer + deletionEndIndex, originalSize - deletionEndIndex}});
+}
+
+void vmf::radamsa::mutations::JsonMutations::SpliceValue(
+                                                    StorageEntry* newEntry,
+                                                    const size_t originalSize,
+                                                    const char* originalBuffer,
+                                                    const unsigned long originalId,
+                                                    const size_t otherSize,
+                                                    const char* otherBuffer,
+                                                    const unsigned long otherId,
+                                                    const size_t minimumSeedIndex,
+                                                    const int testCaseKey)
+{
+    // Consume the original buffer by replacing a random value with a random value (or subtree) of the other buffer
+    // and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize || otherSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr || otherBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const JsonIndex> jsonIndex{GetJsonIndex(originalBuffer, originalSize, originalId)};
+    const std::shared_ptr<const JsonIndex> otherJsonIndex{GetJsonIndex(otherBuffer, otherSize, otherId)};
+
+    size_t valueIndex{0u};
+    size_t otherValueIndex{0u};
+
+    if (!GetRandomValueIndex(*jsonIndex, minimumSeedIndex, valueIndex) ||
+        !GetRandomValueIndex(*otherJsonIndex, 0u, otherValueIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const JsonValue& value{jsonIndex->Values[valueIndex]};
+    const JsonValue& otherValue{otherJsonIndex->Values[otherValueIndex]};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, value.StartIndex},
+             {otherBuffer + otherValue.StartIndex, static_cast<size_t>(otherValue.EndIndex - otherValue.StartIndex)},
+             {originalBuffer + value.EndIndex, originalSize - value.EndIndex}});
+}
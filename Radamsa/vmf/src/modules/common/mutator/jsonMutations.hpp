@@ -0,0 +1,149 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "seedCache.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Implements structure-aware mutations of JSON inputs.
+ *
+ * Values are swapped, array members duplicated, object members deleted and values spliced in from
+ * another corpus entry, all as whole units so that the output still tokenizes as JSON.  The input is
+ * never parsed into a DOM: a simdjson style block scan finds the structural characters outside of
+ * strings, and a single stack pass over them produces a flat list of value offsets that is cached by
+ * storage entry ID.
+ */
+class JsonMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    enum class ContainerType : uint8_t
+    {
+        None = 0u,
+        Array,
+        Object
+    };
+
+    /**
+     * @brief Offsets of a JSON value.  Offsets are 32-bit since test case buffers are sized by an int.
+     *
+     * The member range covers everything between the delimiters around the value, so for an object
+     * member it also covers the key.  For top-level values the member range is the value range.
+     */
+    struct JsonValue
+    {
+        uint32_t StartIndex{0u};       // Offset of the first byte of the value.
+        uint32_t EndIndex{0u};         // Offset one past the last byte of the value.
+        uint32_t MemberStartIndex{0u}; // Offset one past the '[', '{' or ',' that precedes the member.
+        uint32_t MemberEndIndex{0u};   // Offset of the ']', '}' or ',' that follows the member.
+        ContainerType Parent{ContainerType::None};
+    };
+
+    /**
+     * @brief Values of a JSON buffer in document order, plus the indices of the array and object members among them.
+     */
+    struct JsonIndex
+    {
+        std::vector<JsonValue> Values;
+        std::vector<uint32_t> ArrayMembers;
+        std::vector<uint32_t> ObjectMembers;
+    };
+
+    JsonMutations() = delete;
+    virtual ~JsonMutations() = default;
+
+    JsonMutations(const JsonMutations&) = delete;
+    JsonMutations(JsonMutations&&) = delete;
+
+    JsonMutations& operator=(const JsonMutations&) = delete;
+    JsonMutations& operator=(JsonMutations&&) = delete;
+
+    void SwapValues(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+    void DuplicateArrayMember(
+                        StorageEntry* newEntry,
+                        const size_t originalSize,
+                        const char* originalBuffer,
+                        const unsigned long originalId,
+                        const size_t minimumSeedIndex,
+                        const int testCaseKey);
+
+    void DeleteKey(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+    void SpliceValue(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t otherSize,
+                const char* otherBuffer,
+                const unsigned long otherId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+protected:
+    JsonMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static JsonIndex BuildJsonIndex(
+                                const char* const buffer,
+                                const size_t size);
+
+    std::shared_ptr<const JsonIndex> GetJsonIndex(
+                                            const char* const buffer,
+                                            const size_t size,
+                                            const unsigned long seedId);
+
+    bool GetRandomValueIndex(
+                        const JsonIndex& jsonIndex,
+                        const size_t minimumSeedIndex,
+                        size_t& valueIndex);
+
+    bool GetRandomMemberIndex(
+                        const JsonIndex& jsonIndex,
+                        const std::vector<uint32_t>& members,
+                        const size_t minimumSeedIndex,
+                        size_t& valueIndex);
+
+private:
+    SeedCache<JsonIndex> jsonIndexCache_;
+};
+}
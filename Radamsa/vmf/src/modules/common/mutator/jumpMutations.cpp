@@ -0,0 +1,120 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <cstring>
+
+// VMF Includes
+#include "jumpMutations.hpp"
+#include "bufferSegments.hpp"
+
+size_t vmf::radamsa::mutations::JumpMutations::GetNextLineStart(
+                                                            const char* const buffer,
+                                                            const size_t size,
+                                                            const size_t index) noexcept
+{
+    // Return the index just past the first newline at or after the given index, or the size of the buffer when there is none.
+
+    if (index >= size)
+        return size;
+
+    const void* const newline{memchr(buffer + index, '\n', size - index)};
+
+    return (newline == nullptr) ? size : static_cast<size_t>(static_cast<const char*>(newline) - buffer) + 1u;
+}
+
+void vmf::radamsa::mutations::JumpMutations::SpliceAt(
+                                                StorageEntry* newEntry,
+                                                const size_t originalSize,
+                                                const char* originalBuffer,
+                                                const size_t otherSize,
+                                                const char* otherBuffer,
+                                                const size_t minimumSeedIndex,
+                                                const int testCaseKey,
+                                                const bool isLineAligned)
+{
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize || otherSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr || otherBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    // The prefix always keeps the bytes before the minimum seed index; the suffix may start anywhere in the other buffer.
+
+    size_t originalCutIndex{GetRandomValueWithinBounds(minimumSeedIndex, originalSize)};
+    size_t otherCutIndex{GetRandomValueWithinBounds(0u, otherSize - 1u)};
+
+    if (isLineAligned)
+    {
+        // Cut after a newline. A buffer without a newline after the cut keeps all of it (prefix) or starts at its first line (suffix).
+
+        if (originalCutIndex > 0u)
+            originalCutIndex = GetNextLineStart(originalBuffer, originalSize, originalCutIndex - 1u);
+
+        if (otherCutIndex > 0u)
+        {
+            otherCutIndex = GetNextLineStart(otherBuffer, otherSize, otherCutIndex - 1u);
+
+            if (otherCutIndex == otherSize)
+                otherCutIndex = 0u;
+        }
+    }
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, originalCutIndex},
+             {otherBuffer + otherCutIndex, otherSize - otherCutIndex}});
+}
+
+void vmf::radamsa::mutations::JumpMutations::Jump(
+                                            StorageEntry* newEntry,
+                                            const size_t originalSize,
+                                            const char* originalBuffer,
+                                            const size_t otherSize,
+                                            const char* otherBuffer,
+                                            const size_t minimumSeedIndex,
+                                            const int testCaseKey)
+{
+    // Consume the original buffer by continuing a random prefix of it with a random suffix of the other buffer
+    // and appending a null-terminator to the end.
+
+    SpliceAt(newEntry, originalSize, originalBuffer, otherSize, otherBuffer, minimumSeedIndex, testCaseKey, false);
+}
+
+void vmf::radamsa::mutations::JumpMutations::JumpLine(
+                                                StorageEntry* newEntry,
+                                                const size_t originalSize,
+                                                const char* originalBuffer,
+                                                const size_t otherSize,
+                                                const char* otherBuffer,
+                                                const size_t minimumSeedIndex,
+                                                const int testCaseKey)
+{
+    // Consume the original buffer by continuing its first lines with the last lines of the other buffer
+    // and appending a null-terminator to the end.
+
+    SpliceAt(newEntry, originalSize, originalBuffer, otherSize, otherBuffer, minimumSeedIndex, testCaseKey, true);
+}
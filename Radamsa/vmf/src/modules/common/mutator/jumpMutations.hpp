@@ -0,0 +1,85 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// Module Includes
+#include "mutationBase.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Implements the radamsa jump generator, which splices two corpus entries together.
+ *
+ * The output is a prefix of the original buffer followed by a suffix of another buffer, cut at random
+ * points, optionally at line starts.  It is written as two copies straight into the new entry.
+ */
+class JumpMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    JumpMutations() = delete;
+    virtual ~JumpMutations() = default;
+
+    JumpMutations(const JumpMutations&) = delete;
+    JumpMutations(JumpMutations&&) = delete;
+
+    JumpMutations& operator=(const JumpMutations&) = delete;
+    JumpMutations& operator=(JumpMutations&&) = delete;
+
+    void Jump(
+            StorageEntry* newEntry,
+            const size_t originalSize,
+            const char* originalBuffer,
+            const size_t otherSize,
+            const char* otherBuffer,
+            const size_t minimumSeedIndex,
+            const int testCaseKey);
+
+    void JumpLine(
+            StorageEntry* newEntry,
+            const size_t originalSize,
+            const char* originalBuffer,
+            const size_t otherSize,
+            const char* otherBuffer,
+            const size_t minimumSeedIndex,
+            const int testCaseKey);
+
+protected:
+    JumpMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static size_t GetNextLineStart(
+                            const char* const buffer,
+                            const size_t size,
+                            const size_t index) noexcept;
+
+    void SpliceAt(
+            StorageEntry* newEntry,
+            const size_t originalSize,
+            const char* originalBuffer,
+            const size_t otherSize,
+            const char* otherBuffer,
+            const size_t minimumSeedIndex,
+            const int testCaseKey,
+            const bool isLineAligned);
+};
+}
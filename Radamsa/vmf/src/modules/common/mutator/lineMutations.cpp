@@ -43,6 +43,7 @@
 
 // VMF Includes
 #include "lineMutations.hpp"
+#include "simdScan.hpp"
 #include "Logging.hpp"
 
 vmf::radamsa::mutations::LineMutations::Line vmf::radamsa::mutations::LineMutations::GetLineData(
@@ -83,6 +84,26 @@ vmf::radamsa::mutations::LineMutations::Line vmf::radamsa::mutations::LineMutati
 
     Line lineData;
 
+    const LineIndex* boundLineIndex{GetBoundLineIndex(buffer, size)};
+
+    if (boundLineIndex != nullptr)
+    {
+        // A line starts after the newline that ends the previous line and includes its own newline, if any.
+
+        const std::vector<size_t>& newlineIndices{boundLineIndex->NewlineIndices};
+
+        const size_t startIndex{maximumLineIndex == 0u ? 0u : newlineIndices[maximumLineIndex - 1u] + 1u};
+
+        if (startIndex < size)
+        {
+            lineData.StartIndex = startIndex;
+            lineData.Size = (maximumLineIndex < newlineIndices.size() ? newlineIndices[maximumLineIndex] + 1u : size) - startIndex;
+            lineData.IsValid = true;
+        }
+
+        return lineData;
+    }
+
     for(size_t it{0u}, reverseLineIndex{maximumLineIndex}; it < size; ++it)
     {
         if(reverseLineIndex == 0u)
@@ -124,6 +145,15 @@ size_t vmf::radamsa::mutations::LineMutations::GetNumberOfLinesAfterIndex(
     if (buffer == nullptr)
         throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
 
+    const LineIndex* boundLineIndex{GetBoundLineIndex(buffer, size)};
+
+    if (boundLineIndex != nullptr)
+    {
+        const std::vector<size_t>& newlineIndices{boundLineIndex->NewlineIndices};
+
+        return static_cast<size_t>(newlineIndices.end() - std::lower_bound(newlineIndices.begin(), newlineIndices.end(), index)) + 1u;
+    }
+
     size_t numberOfLines{0u};
 
     for(size_t it{index}; it < size; ++it)
@@ -133,6 +163,113 @@ size_t vmf::radamsa::mutations::LineMutations::GetNumberOfLinesAfterIndex(
     return ++numberOfLines;
 }
 
+vmf::radamsa::mutations::LineMutations::LineIndex vmf::radamsa::mutations::LineMutations::BuildLineIndex(
+                                                                                                    const char* const buffer,
+                                                                                                    const size_t size)
+{
+    LineIndex lineIndex;
+
+    if (buffer == nullptr)
+        return lineIndex;
+
+    simd::ForEachBlock(
+                    buffer,
+                    size,
+                    [&](const char* block, const size_t blockOffset, const uint64_t validMask)
+                    {
+                        for (uint64_t newlineMask{simd::EqualMask(block, '\n') & validMask}; newlineMask != 0u; newlineMask &= newlineMask - 1u)
+                            lineIndex.NewlineIndices.push_back(blockOffset + simd::CountTrailingZeros(newlineMask));
+                    });
+
+    return lineIndex;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::LineMutations::LineIndex> vmf::radamsa::mutations::LineMutations::GetLineIndex(
+                                                                                                                        const char* const buffer,
+                                                                                                                        const size_t size,
+                                                                                                                        const unsigned long seedId)
+{
+    return lineIndexCache_.GetOrBuild(
+                                seedId,
+                                [&]() { return BuildLineIndex(buffer, size); });
+}
+
+void vmf::radamsa::mutations::LineMutations::BindLineIndex(
+                                                        const char* const buffer,
+                                                        const size_t size,
+                                                        std::shared_ptr<const LineIndex> lineIndex) noexcept
+{
+    boundBuffer_ = buffer;
+    boundSize_ = size;
+    boundLineIndex_ = std::move(lineIndex);
+}
+
+void vmf::radamsa::mutations::LineMutations::UnbindLineIndex() noexcept
+{
+    boundBuffer_ = nullptr;
+    boundSize_ = 0u;
+    boundLineIndex_.reset();
+}
+
+void vmf::radamsa::mutations::LineMutations::BindPreferredOffsets(
+                                                                const char* const buffer,
+                                                                const size_t size,
+                                                                std::shared_ptr<const OffsetBitmap> preferredOffsets) noexcept
+{
+    preferredBuffer_ = buffer;
+    preferredSize_ = size;
+    preferredOffsets_ = std::move(preferredOffsets);
+}
+
+void vmf::radamsa::mutations::LineMutations::UnbindPreferredOffsets() noexcept
+{
+    preferredBuffer_ = nullptr;
+    preferredSize_ = 0u;
+    preferredOffsets_.reset();
+}
+
+size_t vmf::radamsa::mutations::LineMutations::GetRandomLineIndex(
+                                                            const char* const buffer,
+                                                            const size_t size,
+                                                            const size_t numberOfLinesAfterIndex,
+                                                            const size_t maximumLineIndex)
+{
+    constexpr size_t minimumRandomLineIndex{0u};
+
+    if (preferredOffsets_ == nullptr || buffer != preferredBuffer_ || size != preferredSize_ || size != preferredOffsets_->GetSize())
+        return GetRandomValueWithinBounds(minimumRandomLineIndex, maximumLineIndex);
+
+    // A preferred offset is drawn among those of the candidate lines, and the line holding it is returned.
+
+    const Line firstLine{GetLineData(buffer, size, minimumRandomLineIndex, numberOfLinesAfterIndex)};
+    const Line lastLine{GetLineData(buffer, size, maximumLineIndex, numberOfLinesAfterIndex)};
+
+    const size_t firstRank{preferredOffsets_->Rank(firstLine.StartIndex)};
+
+    // Only an empty final line is not valid, and it ends the buffer.
+
+    const size_t endRank{preferredOffsets_->Rank(lastLine.IsValid ? lastLine.StartIndex + lastLine.Size : size)};
+
+    if (firstRank == endRank)
+        return GetRandomValueWithinBounds(minimumRandomLineIndex, maximumLineIndex);
+
+    const size_t offset{preferredOffsets_->Select(GetRandomValueWithinBounds(firstRank, endRank - 1u))};
+
+    return numberOfLinesAfterIndex - GetNumberOfLinesAfterIndex(buffer, size, offset);
+}
+
+const vmf::radamsa::mutations::LineMutations::LineIndex* vmf::radamsa::mutations::LineMutations::GetBoundLineIndex(
+                                                                                                            const char* const buffer,
+                                                                                                            const size_t size) const noexcept
+{
+    // The bound index only describes the exact buffer it was built for.
+
+    if (boundLineIndex_ == nullptr || buffer != boundBuffer_ || size != boundSize_)
+        return nullptr;
+
+    return boundLineIndex_.get();
+}
+
 bool vmf::radamsa::mutations::LineMutations::IsBinarish(
                                                     const char* const buffer,
                                                     const size_t size)
@@ -206,13 +343,14 @@ void vmf::radamsa::mutations::LineMutations::DeleteLine(
 
         // Select a random line to delete.
 
-        constexpr size_t minimumRandomLineIndex{0u};
         const size_t maximumRandomLineIndex{numberOfLinesAfterIndex - 1u};
 
         const size_t randomLineIndex{
-                                GetRandomValueWithinBounds(
-                                                        minimumRandomLineIndex,
-                                                        maximumRandomLineIndex)};
+                                GetRandomLineIndex(
+                                                originalBuffer,
+                                                originalSize,
+                                                numberOfLinesAfterIndex,
+                                                maximumRandomLineIndex)};
 
         const Line lineData{
                         GetLineData(
@@ -293,9 +431,11 @@ void vmf::radamsa::mutations::LineMutations::DeleteSequentialLines(
         const size_t minimumRandomLineOffset{0u};
 
         const size_t randomLineIndexStart{
-                                    GetRandomValueWithinBounds(
-                                                            minimumRandomLineOffset,
-                                                            numberOfLinesAfterIndex - 1u)};
+                                    GetRandomLineIndex(
+                                                    originalBuffer,
+                                                    originalSize,
+                                                    numberOfLinesAfterIndex,
+                                                    numberOfLinesAfterIndex - 1u)};
 
         const size_t randomLineIndexEnd{
                                     GetRandomValueWithinBounds(
@@ -369,7 +509,7 @@ void vmf::radamsa::mutations::LineMutations::DuplicateLine(
                                                         originalSize,
                                                         characterIndex)};
 
-    if (!IsBinarish(originalBuffer, originalSize))
+    if (IsBinarish(originalBuffer, originalSize))
     {
         // The new buffer will contain one additional byte since a null-terminator will be appended to the end.
 
@@ -385,13 +525,14 @@ void vmf::radamsa::mutations::LineMutations::DuplicateLine(
     {
         // Select a random line to duplicate.
 
-        constexpr size_t minimumRandomLineIndex{0u};
         const size_t maximumRandomLineIndex{numberOfLinesAfterIndex - 1u};
 
         const size_t randomLineIndex{
-                                GetRandomValueWithinBounds(
-                                                        minimumRandomLineIndex,
-                                                        maximumRandomLineIndex)};
+                                GetRandomLineIndex(
+                                                originalBuffer,
+                                                originalSize,
+                                                numberOfLinesAfterIndex,
+                                                maximumRandomLineIndex)};
 
         const Line lineData{
                         GetLineData(
@@ -474,7 +615,7 @@ void vmf::radamsa::mutations::LineMutations::CopyLineCloseBy(
                                                         originalSize,
                                                         characterIndex)};
 
-    if (!IsBinarish(originalBuffer, originalSize))
+    if (IsBinarish(originalBuffer, originalSize))
     {
         // The new buffer will contain one additional byte since a null-terminator will be appended to the end.
 
@@ -493,9 +634,11 @@ void vmf::radamsa::mutations::LineMutations::CopyLineCloseBy(
         const size_t minimumRandomLineOffset{0u};
 
         const size_t randomLineIndexSource{
-                                    GetRandomValueWithinBounds(
-                                                        minimumRandomLineOffset,
-                                                        numberOfLinesAfterIndex - 1u)};
+                                    GetRandomLineIndex(
+                                                    originalBuffer,
+                                                    originalSize,
+                                                    numberOfLinesAfterIndex,
+                                                    numberOfLinesAfterIndex - 1u)};
 
         const size_t randomLineIndexDestination{
                                         GetRandomValueWithinBounds(
@@ -527,11 +670,14 @@ void vmf::radamsa::mutations::LineMutations::CopyLineCloseBy(
         memset(newBuffer, 0u, newBufferSize);
 
         // Copy data from the original buffer into the new buffer, but copy the random line.
+        // The empty line after a trailing newline has no start index, so a copy to it is appended to the end.
         // The last element in the new buffer is skipped since it was implicitly set to zero during allocation.
 
+        const size_t insertionIndex{lineDataDestination.IsValid ? lineDataDestination.StartIndex : originalSize};
+
         for(size_t sourceIndex{0u}, destinationIndex{0u}; sourceIndex < originalSize; ++sourceIndex)
         {
-            if(sourceIndex == lineDataDestination.StartIndex)
+            if(sourceIndex == insertionIndex)
             {
                 memcpy(&newBuffer[destinationIndex], &originalBuffer[lineDataSource.StartIndex], lineDataSource.Size);
 
@@ -542,6 +688,9 @@ void vmf::radamsa::mutations::LineMutations::CopyLineCloseBy(
 
             ++destinationIndex;
         }
+
+        if (insertionIndex == originalSize)
+            memcpy(&newBuffer[originalSize], &originalBuffer[lineDataSource.StartIndex], lineDataSource.Size);
     }
 }
 
@@ -571,7 +720,7 @@ void vmf::radamsa::mutations::LineMutations::RepeatLine(
                                                         originalSize,
                                                         characterIndex)};
 
-    if (!IsBinarish(originalBuffer, originalSize))
+    if (IsBinarish(originalBuffer, originalSize))
     {
         // The new buffer will contain one additional byte since a null-terminator will be appended to the end.
 
@@ -587,13 +736,14 @@ void vmf::radamsa::mutations::LineMutations::RepeatLine(
     {
         // Select a random line to duplicate.
 
-        constexpr size_t minimumRandomLineIndex{0u};
         const size_t maximumRandomLineIndex{numberOfLinesAfterIndex - 1u};
 
         const size_t randomLineIndex{
-                                GetRandomValueWithinBounds(
-                                                        minimumRandomLineIndex,
-                                                        maximumRandomLineIndex)};
+                                GetRandomLineIndex(
+                                                originalBuffer,
+                                                originalSize,
+                                                numberOfLinesAfterIndex,
+                                                maximumRandomLineIndex)};
 
         const Line lineData{
                         GetLineData(
@@ -629,6 +779,11 @@ void vmf::radamsa::mutations::LineMutations::RepeatLine(
                 }
 
                 sourceIndex += lineData.Size;
+
+                // The last line has no bytes after it, and the null-terminator is already in place.
+
+                if (sourceIndex == originalSize)
+                    break;
             }
 
             newBuffer[destinationIndex] = originalBuffer[sourceIndex];
@@ -680,12 +835,14 @@ void vmf::radamsa::mutations::LineMutations::SwapLine(
     {
         // Select random line to copy from/to.
 
-        const size_t minimumRandomLineOffset{0u};
+        // The first line is never the last one, so that it always has a following line to be swapped with.
 
         const size_t firstRandomLineIndex{
-                                    GetRandomValueWithinBounds(
-                                                        minimumRandomLineOffset,
-                                                        numberOfLinesAfterIndex - 1u)};
+                                    GetRandomLineIndex(
+                                                    originalBuffer,
+                                                    originalSize,
+                                                    numberOfLinesAfterIndex,
+                                                    (numberOfLinesAfterIndex > 1u) ? (numberOfLinesAfterIndex - 2u) : 0u)};
 
         const size_t totalNumberOfLines{
                                     GetNumberOfLinesAfterIndex(
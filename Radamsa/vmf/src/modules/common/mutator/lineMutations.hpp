@@ -26,6 +26,8 @@
 // Module Includes
 
 #include "mutationBase.hpp"
+#include "offsetBitmap.hpp"
+#include "seedCache.hpp"
 
 // Common Includes
 
@@ -319,6 +321,11 @@ public:
         size_t Capacity{0u};
     };
 
+    struct LineIndex
+    {
+        std::vector<size_t> NewlineIndices; // Ascending offsets of every '\n' in the buffer.
+    };
+
     LineMutations() = delete;
     virtual ~LineMutations() = default;
 
@@ -384,6 +391,47 @@ protected:
 
     size_t GetRandomLogValue(const size_t maximumValue);
 
+    static LineIndex BuildLineIndex(
+                                const char* const buffer,
+                                const size_t size);
+
+    std::shared_ptr<const LineIndex> GetLineIndex(
+                                            const char* const buffer,
+                                            const size_t size,
+                                            const unsigned long seedId);
+
+    /**
+     * @brief Makes GetNumberOfLinesAfterIndex and GetLineData answer from the line index of buffer instead of
+     * scanning it, until UnbindLineIndex is called. Other buffers are still scanned.
+     */
+    void BindLineIndex(
+                    const char* const buffer,
+                    const size_t size,
+                    std::shared_ptr<const LineIndex> lineIndex) noexcept;
+
+    void UnbindLineIndex() noexcept;
+
+    /**
+     * @brief Makes the line mutations draw lines of buffer in proportion to the number of preferred offsets they
+     * hold, until UnbindPreferredOffsets is called. Other buffers, and ranges of lines without a preferred offset,
+     * are still drawn uniformly.
+     */
+    void BindPreferredOffsets(
+                            const char* const buffer,
+                            const size_t size,
+                            std::shared_ptr<const OffsetBitmap> preferredOffsets) noexcept;
+
+    void UnbindPreferredOffsets() noexcept;
+
+    /**
+     * @brief Draws a line index in [0, maximumLineIndex], relative to the first of the numberOfLinesAfterIndex lines.
+     */
+    size_t GetRandomLineIndex(
+                        const char* const buffer,
+                        const size_t size,
+                        const size_t numberOfLinesAfterIndex,
+                        const size_t maximumLineIndex);
+
     size_t GetRandomN_Bit(const size_t n);
 
 private:
@@ -399,5 +447,19 @@ private:
     bool Rad_LineInsElsewhere(const size_t index);
 
     bool Rad_LineReplaceElsewhere(const size_t index);
+
+    const LineIndex* GetBoundLineIndex(
+                                const char* const buffer,
+                                const size_t size) const noexcept;
+
+    SeedCache<LineIndex> lineIndexCache_;
+
+    const char* boundBuffer_{nullptr};
+    size_t boundSize_{0u};
+    std::shared_ptr<const LineIndex> boundLineIndex_;
+
+    const char* preferredBuffer_{nullptr};
+    size_t preferredSize_{0u};
+    std::shared_ptr<const OffsetBitmap> preferredOffsets_;
 };
 }
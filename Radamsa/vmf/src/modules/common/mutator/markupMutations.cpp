@@ -0,0 +1,413 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+// VMF Includes
+#include "markupMutations.hpp"
+#include "bufferSegments.hpp"
+#include "simdScan.hpp"
+
+namespace
+{
+std::string_view GetTagName(
+                        const char* const buffer,
+                        const size_t nameStartIndex,
+                        const size_t tagEndIndex)
+{
+    size_t nameEndIndex{nameStartIndex};
+
+    while (nameEndIndex < tagEndIndex)
+    {
+        const char character{buffer[nameEndIndex]};
+
+        if (character == ' ' || character == '\t' || character == '\r' || character == '\n' || character == '/' || character == '>')
+            break;
+
+        ++nameEndIndex;
+    }
+
+    return std::string_view{buffer + nameStartIndex, nameEndIndex - nameStartIndex};
+}
+}
+
+vmf::radamsa::mutations::MarkupMutations::MarkupTree vmf::radamsa::mutations::MarkupMutations::BuildMarkupTree(
+                                                                                                        const char* const buffer,
+                                                                                                        const size_t size)
+{
+    MarkupTree tree;
+
+    if (buffer == nullptr)
+        return tree;
+
+    // First pass - locate every '<' and '>' from the block masks.
+
+    std::vector<size_t> openingBrackets;
+    std::vector<size_t> closingBrackets;
+
+    simd::ForEachBlock(
+                buffer,
+                size,
+                [&](const char* const block, const size_t blockOffset, const uint64_t validMask)
+                {
+                    for (uint64_t mask{simd::EqualMask(block, '<') & validMask}; mask != 0u; mask &= mask - 1u)
+                        openingBrackets.push_back(blockOffset + simd::CountTrailingZeros(mask));
+
+                    for (uint64_t mask{simd::EqualMask(block, '>') & validMask}; mask != 0u; mask &= mask - 1u)
+                        closingBrackets.push_back(blockOffset + simd::CountTrailingZeros(mask));
+                });
+
+    // Second pass - pair the brackets into tags and match opening and closing tags with a stack.
+    // Unmatched opening tags (HTML void elements such as <br>) become elements that end with their own tag.
+
+    struct OpenElement
+    {
+        size_t ElementIndex;
+        std::string_view Name;
+    };
+
+    std::vector<OpenElement> openElements;
+
+    constexpr std::string_view commentStart{"<!--"};
+    constexpr std::string_view commentEnd{"-->"};
+
+    const std::string_view input{buffer, size};
+
+    size_t nextClosingBracket{0u};
+    size_t consumedIndex{0u};
+
+    for (const size_t tagStartIndex : openingBrackets)
+    {
+        if (tagStartIndex < consumedIndex)
+            continue;
+
+        size_t tagEndIndex{0u};
+
+        if (input.compare(tagStartIndex, commentStart.size(), commentStart) == 0)
+        {
+            // Comments may contain brackets, so they end at the comment terminator rather than at the next '>'.
+
+            const size_t commentEndIndex{input.find(commentEnd, tagStartIndex + commentStart.size())};
+
+            if (commentEndIndex == std::string_view::npos)
+                break;
+
+            tagEndIndex = commentEndIndex + commentEnd.size();
+        }
+        else
+        {
+            while (nextClosingBracket < closingBrackets.size() && closingBrackets[nextClosingBracket] < tagStartIndex)
+                ++nextClosingBracket;
+
+            if (nextClosingBracket == closingBrackets.size())
+                break;
+
+            tagEndIndex = closingBrackets[nextClosingBracket] + 1u;
+        }
+
+        consumedIndex = tagEndIndex;
+
+        const char tagType{(tagStartIndex + 1u < size) ? buffer[tagStartIndex + 1u] : '\0'};
+
+        if (tagType == '/')
+        {
+            // Closing tag - close the innermost open element with the same name.
+
+            const std::string_view name{GetTagName(buffer, tagStartIndex + 2u, tagEndIndex)};
+
+            const auto match{
+                        std::find_if(
+                                openElements.rbegin(),
+                                openElements.rend(),
+                                [&](const OpenElement& openElement) { return openElement.Name == name; })};
+
+            if (match == openElements.rend())
+                continue;
+
+            // Elements opened after the match keep ending with their own tag.
+
+            const size_t matchIndex{static_cast<size_t>(openElements.rend() - match) - 1u};
+
+            tree.Elements[openElements[matchIndex].ElementIndex].EndIndex = tagEndIndex;
+            openElements.resize(matchIndex);
+
+            continue;
+        }
+
+        // Every other tag starts an element; initially it ends with its own tag.
+
+        tree.Elements.push_back(Element{tagStartIndex, tagEndIndex, openElements.size()});
+
+        const bool isSelfClosing{tagEndIndex >= 2u && buffer[tagEndIndex - 2u] == '/'};
+        const bool isStandalone{tagType == '!' || tagType == '?'};
+
+        if (!isSelfClosing && !isStandalone)
+            openElements.push_back(OpenElement{tree.Elements.size() - 1u, GetTagName(buffer, tagStartIndex + 1u, tagEndIndex)});
+    }
+
+    return tree;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::MarkupMutations::MarkupTree> vmf::radamsa::mutations::MarkupMutations::GetMarkupTree(
+                                                                                                                                const char* const buffer,
+                                                                                                                                const size_t size,
+                                                                                                                                const unsigned long seedId)
+{
+    return markupTreeCache_.GetOrBuild(
+                                seedId,
+                                [&]() { return BuildMarkupTree(buffer, size); });
+}
+
+bool vmf::radamsa::mutations::MarkupMutations::GetRandomElementIndex(
+                                                                const MarkupTree& tree,
+                                                                const size_t minimumSeedIndex,
+                                                                size_t& elementIndex)
+{
+    // Elements are in document order, so the ones at or after the minimum seed index form a suffix of the list.
+
+    const auto firstElement{
+                        std::partition_point(
+                                        tree.Elements.begin(),
+                                        tree.Elements.end(),
+                                        [&](const Element& element) { return element.StartIndex < minimumSeedIndex; })};
+
+    if (firstElement == tree.Elements.end())
+        return false;
+
+    elementIndex = GetRandomValueWithinBounds(
+                                        static_cast<size_t>(firstElement - tree.Elements.begin()),
+                                        tree.Elements.size() - 1u);
+
+    return true;
+}
+
+void vmf::radamsa::mutations::MarkupMutations::DuplicateElement(
+                                                            StorageEntry* newEntry,
+                                                            const size_t originalSize,
+                                                            const char* originalBuffer,
+                                                            const unsigned long originalId,
+                                                            const size_t minimumSeedIndex,
+                                                            const int testCaseKey)
+{
+    // Consume the original buffer by repeating a random element right after itself and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const MarkupTree> tree{GetMarkupTree(originalBuffer, originalSize, originalId)};
+
+    size_t elementIndex{0u};
+
+    if (!GetRandomElementIndex(*tree, minimumSeedIndex, elementIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const Element& element{tree->Elements[elementIndex]};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, element.EndIndex},
+             {originalBuffer + element.StartIndex, element.EndIndex - element.StartIndex},
+             {originalBuffer + element.EndIndex, originalSize - element.EndIndex}});
+}
+
+void vmf::radamsa::mutations::MarkupMutations::DeleteElement(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long originalId,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by removing a random element and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const MarkupTree> tree{GetMarkupTree(originalBuffer, originalSize, originalId)};
+
+    size_t elementIndex{0u};
+
+    if (!GetRandomElementIndex(*tree, minimumSeedIndex, elementIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const Element& element{tree->Elements[elementIndex]};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, element.StartIndex},
+             {originalBuffer + element.EndIndex, originalSize - element.EndIndex}});
+}
+
+void vmf::radamsa::mutations::MarkupMutations::SwapElements(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long originalId,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by exchanging two random non-overlapping elements and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const MarkupTree> tree{GetMarkupTree(originalBuffer, originalSize, originalId)};
+
+    // Nested elements cannot be exchanged, so retry a few random pairs before giving up.
+
+    constexpr size_t numberOfAttempts{8u};
+
+    for (size_t attempt{0u}; attempt < numberOfAttempts; ++attempt)
+    {
+        size_t firstIndex{0u};
+        size_t secondIndex{0u};
+
+        if (!GetRandomElementIndex(*tree, minimumSeedIndex, firstIndex) ||
+            !GetRandomElementIndex(*tree, minimumSeedIndex, secondIndex))
+            break;
+
+        const Element& first{tree->Elements[std::min(firstIndex, secondIndex)]};
+        const Element& second{tree->Elements[std::max(firstIndex, secondIndex)]};
+
+        if (second.StartIndex < first.EndIndex)
+            continue;
+
+        WriteSegments(
+                newEntry,
+                testCaseKey,
+                {{originalBuffer, first.StartIndex},
+                 {originalBuffer + second.StartIndex, second.EndIndex - second.StartIndex},
+                 {originalBuffer + first.EndIndex, second.StartIndex - first.EndIndex},
+                 {originalBuffer + first.StartIndex, first.EndIndex - first.StartIndex},
+                 {originalBuffer + second.EndIndex, originalSize - second.EndIndex}});
+
+        return;
+    }
+
+    WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+}
+
+void vmf::radamsa::mutations::MarkupMutations::NestElement(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long originalId,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by replacing a random descendant of a random element with a copy of the element itself
+    // and appending a null-terminator to the end. Elements without descendants are nested directly after their opening tag.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const MarkupTree> tree{GetMarkupTree(originalBuffer, originalSize, originalId)};
+    const std::vector<Element>& elements{tree->Elements};
+
+    size_t elementIndex{0u};
+
+    if (!GetRandomElementIndex(*tree, minimumSeedIndex, elementIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const Element& outer{elements[elementIndex]};
+    const size_t outerSize{outer.EndIndex - outer.StartIndex};
+
+    // Descendants directly follow the element in document order.
+
+    size_t lastDescendantIndex{elementIndex};
+
+    while (lastDescendantIndex + 1u < elements.size() && elements[lastDescendantIndex + 1u].StartIndex < outer.EndIndex)
+        ++lastDescendantIndex;
+
+    if (lastDescendantIndex == elementIndex)
+    {
+        // Find the end of the opening tag, which is the first '>' of the element.
+
+        const char* const openingTagEnd{static_cast<const char*>(memchr(originalBuffer + outer.StartIndex, '>', outerSize))};
+        const size_t insertionIndex{(openingTagEnd == nullptr) ? outer.EndIndex : static_cast<size_t>(openingTagEnd - originalBuffer) + 1u};
+
+        WriteSegments(
+                newEntry,
+                testCaseKey,
+                {{originalBuffer, insertionIndex},
+                 {originalBuffer + outer.StartIndex, outerSize},
+                 {originalBuffer + insertionIndex, originalSize - insertionIndex}});
+
+        return;
+    }
+
+    const Element& inner{elements[GetRandomValueWithinBounds(elementIndex + 1u, lastDescendantIndex)]};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, inner.StartIndex},
+             {originalBuffer + outer.StartIndex, outerSize},
+             {originalBuffer + inner.EndIndex, originalSize - inner.EndIndex}});
+}
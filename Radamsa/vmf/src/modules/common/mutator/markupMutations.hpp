@@ -0,0 +1,125 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "seedCache.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Implements radamsa xp style mutations of XML, SVG and HTML inputs.
+ *
+ * Elements are duplicated, deleted, swapped or nested inside themselves as whole units, so the
+ * output keeps the tag structure that the target's tokenizer expects.  The element tree of a seed
+ * is built from a block scan for '<' and '>' followed by a single stack pass, and is cached as a
+ * flat list of element offsets by storage entry ID.
+ */
+class MarkupMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    struct Element
+    {
+        size_t StartIndex{0u}; // Offset of the '<' that opens the element.
+        size_t EndIndex{0u};   // Offset one past the '>' that closes the element.
+        size_t Depth{0u};
+    };
+
+    /**
+     * @brief Elements of a markup buffer in document order.
+     *
+     * Because the list is in document order, the descendants of Elements[i] are the elements
+     * that directly follow it and start before Elements[i].EndIndex.
+     */
+    struct MarkupTree
+    {
+        std::vector<Element> Elements;
+    };
+
+    MarkupMutations() = delete;
+    virtual ~MarkupMutations() = default;
+
+    MarkupMutations(const MarkupMutations&) = delete;
+    MarkupMutations(MarkupMutations&&) = delete;
+
+    MarkupMutations& operator=(const MarkupMutations&) = delete;
+    MarkupMutations& operator=(MarkupMutations&&) = delete;
+
+    void DuplicateElement(
+                    StorageEntry* newEntry,
+                    const size_t originalSize,
+                    const char* originalBuffer,
+                    const unsigned long originalId,
+                    const size_t minimumSeedIndex,
+                    const int testCaseKey);
+
+    void DeleteElement(
+                    StorageEntry* newEntry,
+                    const size_t originalSize,
+                    const char* originalBuffer,
+                    const unsigned long originalId,
+                    const size_t minimumSeedIndex,
+                    const int testCaseKey);
+
+    void SwapElements(
+                    StorageEntry* newEntry,
+                    const size_t originalSize,
+                    const char* originalBuffer,
+                    const unsigned long originalId,
+                    const size_t minimumSeedIndex,
+                    const int testCaseKey);
+
+    void NestElement(
+                    StorageEntry* newEntry,
+                    const size_t originalSize,
+                    const char* originalBuffer,
+                    const unsigned long originalId,
+                    const size_t minimumSeedIndex,
+                    const int testCaseKey);
+
+protected:
+    MarkupMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static MarkupTree BuildMarkupTree(
+                                const char* const buffer,
+                                const size_t size);
+
+    std::shared_ptr<const MarkupTree> GetMarkupTree(
+                                                const char* const buffer,
+                                                const size_t size,
+                                                const unsigned long seedId);
+
+    bool GetRandomElementIndex(
+                            const MarkupTree& tree,
+                            const size_t minimumSeedIndex,
+                            size_t& elementIndex);
+
+private:
+    SeedCache<MarkupTree> markupTreeCache_;
+};
+}
@@ -0,0 +1,159 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// VMF Includes
+#include "mutationPrefetcher.hpp"
+#include "RuntimeException.hpp"
+
+vmf::radamsa::mutations::MutationPrefetcher::MutationPrefetcher(
+                                                            const size_t numberOfWorkers,
+                                                            const size_t queueCapacity,
+                                                            const std::function<Producer(const size_t workerIndex)>& createProducer)
+{
+    if (numberOfWorkers == 0u)
+        throw RuntimeException{"The number of prefetch workers must be greater than 0", RuntimeException::USAGE_ERROR};
+
+    // Every producer is created before the first thread starts, so that a failure leaves no thread to join.
+
+    for (size_t it{0u}; it < numberOfWorkers; ++it)
+    {
+        queues_.push_back(std::make_unique<SpscQueue<PrefetchedOutput>>(queueCapacity));
+        producers_.push_back(createProducer(it));
+    }
+
+    for (size_t it{0u}; it < numberOfWorkers; ++it)
+        workers_.emplace_back(&MutationPrefetcher::RunWorker, this, std::ref(*queues_[it]), std::cref(producers_[it]));
+}
+
+vmf::radamsa::mutations::MutationPrefetcher::~MutationPrefetcher()
+{
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+
+        isStopping_ = true;
+    }
+
+    condition_.notify_all();
+
+    for (std::thread& worker : workers_)
+        worker.join();
+}
+
+void vmf::radamsa::mutations::MutationPrefetcher::SetSeed(const unsigned long seedId, const char* buffer, const size_t size)
+{
+    const uint64_t generation{seed_ == nullptr ? 1u : seed_->Generation + 1u};
+
+    seed_ = std::make_shared<const Seed>(Seed{seedId, generation, std::string(buffer, size)});
+
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+
+        sharedSeed_ = seed_;
+    }
+
+    condition_.notify_all();
+}
+
+bool vmf::radamsa::mutations::MutationPrefetcher::TryPop(std::string& output)
+{
+    if (seed_ == nullptr)
+        return false;
+
+    PrefetchedOutput prefetchedOutput;
+
+    bool hasPopped{false};
+    bool isFound{false};
+
+    for (size_t it{0u}; it < queues_.size() && !isFound; ++it)
+    {
+        SpscQueue<PrefetchedOutput>& queue{*queues_[nextQueueIndex_]};
+
+        nextQueueIndex_ = (nextQueueIndex_ + 1u) % queues_.size();
+
+        // Outputs of an earlier seed sit ahead of those of the current one and are dropped.
+
+        while (queue.TryPop(prefetchedOutput))
+        {
+            hasPopped = true;
+
+            if (prefetchedOutput.Generation == seed_->Generation)
+            {
+                isFound = true;
+
+                break;
+            }
+        }
+    }
+
+    // A worker may be waiting for room in its queue. Taking the mutex orders this notification after its check.
+
+    if (hasPopped)
+    {
+        {
+            const std::lock_guard<std::mutex> lock{mutex_};
+        }
+
+        condition_.notify_all();
+    }
+
+    if (isFound)
+        output = std::move(prefetchedOutput.Buffer);
+
+    return isFound;
+}
+
+void vmf::radamsa::mutations::MutationPrefetcher::RunWorker(SpscQueue<PrefetchedOutput>& queue, const Producer& producer)
+{
+    std::shared_ptr<const Seed> seed;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+
+            condition_.wait(
+                        lock,
+                        [&]()
+                        {
+                            return isStopping_ || (sharedSeed_ != nullptr && !queue.IsFull());
+                        });
+
+            if (isStopping_)
+                return;
+
+            seed = sharedSeed_;
+        }
+
+        // Only this thread pushes, so the room seen above is still there.
+
+        PrefetchedOutput prefetchedOutput{seed->Generation, {}};
+
+        try
+        {
+            producer(seed->Id, seed->Buffer, prefetchedOutput.Buffer);
+        }
+        catch (...)
+        {
+            return;
+        }
+
+        queue.TryPush(std::move(prefetchedOutput));
+    }
+}
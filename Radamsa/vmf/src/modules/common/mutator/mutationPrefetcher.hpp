@@ -0,0 +1,118 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Module Includes
+#include "spscQueue.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Produces outputs of the current seed on worker threads ahead of the thread that consumes them.
+ *
+ * Every worker owns a producer, which turns a seed into one output, and fills its own single producer single
+ * consumer queue with outputs of the current seed until the queue is full.  The consumer pops ready outputs
+ * round robin from the queues.  Setting another seed makes the workers switch to it; outputs of earlier seeds
+ * that are still queued are dropped when they are popped.  A worker whose producer throws stops, and the
+ * consumer is expected to produce the outputs itself once the queues run dry.
+ */
+class MutationPrefetcher
+{
+public:
+    /**
+     * @brief Called on a worker thread with the ID and bytes of the current seed, writes one output of it.
+     */
+    using Producer = std::function<void(const unsigned long seedId, const std::string& seed, std::string& output)>;
+
+    MutationPrefetcher() = delete;
+    ~MutationPrefetcher();
+
+    /**
+     * @param numberOfWorkers number of worker threads, each calling createProducer once on the constructing thread
+     * @param queueCapacity number of outputs each worker produces ahead
+     */
+    MutationPrefetcher(
+                    const size_t numberOfWorkers,
+                    const size_t queueCapacity,
+                    const std::function<Producer(const size_t workerIndex)>& createProducer);
+
+    MutationPrefetcher(const MutationPrefetcher&) = delete;
+    MutationPrefetcher(MutationPrefetcher&&) = delete;
+
+    MutationPrefetcher& operator=(const MutationPrefetcher&) = delete;
+    MutationPrefetcher& operator=(MutationPrefetcher&&) = delete;
+
+    size_t GetNumberOfWorkers() const noexcept { return workers_.size(); }
+
+    bool HasSeed(const unsigned long seedId) const noexcept { return seed_ != nullptr && seed_->Id == seedId; }
+
+    /**
+     * @brief Makes the workers produce outputs of this seed from now on. The bytes are copied.
+     */
+    void SetSeed(const unsigned long seedId, const char* buffer, const size_t size);
+
+    /**
+     * @brief Pops a ready output of the current seed, returning false when none is ready.
+     */
+    bool TryPop(std::string& output);
+
+private:
+    struct Seed
+    {
+        unsigned long Id{0u};
+        uint64_t Generation{0u};
+        std::string Buffer;
+    };
+
+    struct PrefetchedOutput
+    {
+        uint64_t Generation{0u};
+        std::string Buffer;
+    };
+
+    void RunWorker(SpscQueue<PrefetchedOutput>& queue, const Producer& producer);
+
+    std::vector<std::unique_ptr<SpscQueue<PrefetchedOutput>>> queues_;
+    std::vector<Producer> producers_;
+    std::vector<std::thread> workers_;
+
+    // The workers wait on condition_ for a seed, for room in their queue, or to stop. sharedSeed_ and isStopping_ are guarded by mutex_.
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::shared_ptr<const Seed> sharedSeed_;
+    bool isStopping_{false};
+
+    // Consumer state.
+
+    std::shared_ptr<const Seed> seed_;
+    size_t nextQueueIndex_{0u};
+};
+}
@@ -0,0 +1,117 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <limits>
+#include <utility>
+
+// VMF Includes
+#include "offsetBitmap.hpp"
+#include "simdScan.hpp"
+#include "RuntimeException.hpp"
+
+vmf::radamsa::mutations::OffsetBitmap::OffsetBitmap(std::vector<uint64_t> words, const size_t size) : words_(std::move(words)),
+                                                                                                      size_{size}
+{
+    constexpr size_t bitsPerWord{std::numeric_limits<uint64_t>::digits};
+
+    if (size > std::numeric_limits<uint32_t>::max())
+        throw RuntimeException{"Offset bitmap size is out of range", RuntimeException::USAGE_ERROR};
+
+    const size_t numberOfWords{(size + bitsPerWord - 1u) / bitsPerWord};
+
+    words_.resize(numberOfWords, 0u);
+
+    if (size % bitsPerWord != 0u)
+        words_.back() &= (uint64_t{1u} << (size % bitsPerWord)) - 1u;
+
+    wordRanks_.reserve(numberOfWords + 1u);
+    wordRanks_.push_back(0u);
+
+    for (const uint64_t word : words_)
+        wordRanks_.push_back(wordRanks_.back() + static_cast<uint32_t>(simd::PopCount(word)));
+
+    const size_t numberOfOffsets{GetNumberOfOffsets()};
+
+    if (numberOfOffsets == 0u)
+        return;
+
+    // One slice per word, so a slice spans two words on average.
+
+    guideSliceSize_ = (numberOfOffsets + numberOfWords - 1u) / numberOfWords;
+
+    uint32_t wordIndex{0u};
+
+    for (size_t sliceStart{0u}; sliceStart < numberOfOffsets; sliceStart += guideSliceSize_)
+    {
+        while (wordRanks_[wordIndex + 1u] <= sliceStart)
+            ++wordIndex;
+
+        guideIndices_.push_back(wordIndex);
+    }
+}
+
+bool vmf::radamsa::mutations::OffsetBitmap::IsAllowed(const size_t offset) const noexcept
+{
+    constexpr size_t bitsPerWord{std::numeric_limits<uint64_t>::digits};
+
+    return offset < size_ && ((words_[offset / bitsPerWord] >> (offset % bitsPerWord)) & 0x01u) != 0u;
+}
+
+size_t vmf::radamsa::mutations::OffsetBitmap::Rank(const size_t offset) const noexcept
+{
+    constexpr size_t bitsPerWord{std::numeric_limits<uint64_t>::digits};
+
+    if (offset >= size_)
+        return GetNumberOfOffsets();
+
+    const uint64_t lowerBits{(uint64_t{1u} << (offset % bitsPerWord)) - 1u};
+
+    return wordRanks_[offset / bitsPerWord] + simd::PopCount(words_[offset / bitsPerWord] & lowerBits);
+}
+
+size_t vmf::radamsa::mutations::OffsetBitmap::Select(const size_t rank) const noexcept
+{
+    constexpr size_t bitsPerWord{std::numeric_limits<uint64_t>::digits};
+
+    size_t wordIndex{guideIndices_[rank / guideSliceSize_]};
+
+    while (wordRanks_[wordIndex + 1u] <= rank)
+        ++wordIndex;
+
+    // Clear the lower set bits of the word until the wanted bit is the lowest one.
+
+    uint64_t word{words_[wordIndex]};
+
+    for (size_t it{wordRanks_[wordIndex]}; it < rank; ++it)
+        word &= word - 1u;
+
+    return wordIndex * bitsPerWord + simd::CountTrailingZeros(word);
+}
+
+size_t vmf::radamsa::mutations::OffsetBitmap::Sample(std::default_random_engine& randomNumberGenerator) const
+{
+    if (IsEmpty())
+        throw RuntimeException{"Offset bitmap has no allowed offset", RuntimeException::UNEXPECTED_ERROR};
+
+    std::uniform_int_distribution<size_t> distribution{0u, GetNumberOfOffsets() - 1u};
+
+    return Select(distribution(randomNumberGenerator));
+}
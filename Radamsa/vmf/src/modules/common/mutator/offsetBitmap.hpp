@@ -0,0 +1,91 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Bitmap of the allowed offsets of a buffer, with constant time rank and select.
+ *
+ * One bit per offset is kept in 64-bit words, next to the number of allowed offsets before each word.  Rank is
+ * that count plus the population count of a word prefix.  Select starts from a guide table that maps equal slices
+ * of the ranks to their first word, so a uniformly random rank is found after an expected constant number of
+ * steps, and the bit is then located within its word.
+ */
+class OffsetBitmap
+{
+public:
+    OffsetBitmap() = default;
+    ~OffsetBitmap() = default;
+
+    OffsetBitmap(const OffsetBitmap&) = default;
+    OffsetBitmap(OffsetBitmap&&) = default;
+
+    OffsetBitmap& operator=(const OffsetBitmap&) = default;
+    OffsetBitmap& operator=(OffsetBitmap&&) = default;
+
+    /**
+     * @brief Builds the bitmap over the offsets [0, size); offset i is allowed when bit i % 64 of words[i / 64] is set.
+     *
+     * Bits past size are ignored, and missing words count as cleared.
+     */
+    OffsetBitmap(std::vector<uint64_t> words, const size_t size);
+
+    size_t GetSize() const noexcept { return size_; }
+
+    size_t GetNumberOfOffsets() const noexcept { return wordRanks_.empty() ? 0u : wordRanks_.back(); }
+
+    bool IsEmpty() const noexcept { return GetNumberOfOffsets() == 0u; }
+
+    /**
+     * @brief The lowest allowed offset; every offset below it is not allowed.  The bitmap must not be empty.
+     */
+    size_t GetFirstOffset() const noexcept { return Select(0u); }
+
+    bool IsAllowed(const size_t offset) const noexcept;
+
+    /**
+     * @brief Number of allowed offsets below offset.
+     */
+    size_t Rank(const size_t offset) const noexcept;
+
+    /**
+     * @brief The allowed offset with rank allowed offsets below it.  Rank must be less than GetNumberOfOffsets.
+     */
+    size_t Select(const size_t rank) const noexcept;
+
+    /**
+     * @brief Returns an allowed offset drawn uniformly at random.  Throws a RuntimeException when the bitmap is empty.
+     */
+    size_t Sample(std::default_random_engine& randomNumberGenerator) const;
+
+private:
+    std::vector<uint64_t> words_;
+    std::vector<uint32_t> wordRanks_;    // Number of allowed offsets before each word, then the total.
+    std::vector<uint32_t> guideIndices_; // Word holding the first rank of each slice of guideSliceSize_ ranks.
+    size_t guideSliceSize_{1u};
+    size_t size_{0u};
+};
+}
@@ -0,0 +1,112 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+
+// VMF Includes
+#include "offsetSampler.hpp"
+#include "RuntimeException.hpp"
+
+vmf::radamsa::mutations::OffsetSampler::OffsetSampler(const size_t size, std::vector<std::pair<size_t, size_t>> protectedRanges)
+{
+    std::sort(protectedRanges.begin(), protectedRanges.end());
+
+    // Every gap between the merged protected ranges, and the space after the last one, is an allowed range.
+
+    size_t allowedStartIndex{0u};
+    size_t numberOfOffsets{0u};
+
+    auto addAllowedRange{
+                    [&](const size_t endIndex)
+                    {
+                        if (endIndex <= allowedStartIndex)
+                            return;
+
+                        numberOfOffsets += endIndex - allowedStartIndex;
+
+                        rangeStartIndices_.push_back(allowedStartIndex);
+                        cumulativeSizes_.push_back(numberOfOffsets);
+                    }};
+
+    for (const std::pair<size_t, size_t>& protectedRange : protectedRanges)
+    {
+        if (protectedRange.first >= size)
+            break;
+
+        addAllowedRange(protectedRange.first);
+
+        allowedStartIndex = std::max(allowedStartIndex, std::min(protectedRange.second, size));
+    }
+
+    addAllowedRange(size);
+
+    if (cumulativeSizes_.empty())
+        return;
+
+    // One slice per range keeps the guide table as small as the ranges, and every slice then meets one range
+    // and the start of the next on average.
+
+    guideSliceSize_ = (numberOfOffsets + cumulativeSizes_.size() - 1u) / cumulativeSizes_.size();
+
+    size_t rangeIndex{0u};
+
+    for (size_t sliceStart{0u}; sliceStart < numberOfOffsets; sliceStart += guideSliceSize_)
+    {
+        while (cumulativeSizes_[rangeIndex] <= sliceStart)
+            ++rangeIndex;
+
+        guideIndices_.push_back(rangeIndex);
+    }
+}
+
+bool vmf::radamsa::mutations::OffsetSampler::IsAllowed(const size_t offset) const noexcept
+{
+    const auto nextRange{std::upper_bound(rangeStartIndices_.begin(), rangeStartIndices_.end(), offset)};
+
+    if (nextRange == rangeStartIndices_.begin())
+        return false;
+
+    const size_t rangeIndex{static_cast<size_t>(nextRange - rangeStartIndices_.begin()) - 1u};
+    const size_t rangeSize{cumulativeSizes_[rangeIndex] - ((rangeIndex == 0u) ? 0u : cumulativeSizes_[rangeIndex - 1u])};
+
+    return offset - rangeStartIndices_[rangeIndex] < rangeSize;
+}
+
+size_t vmf::radamsa::mutations::OffsetSampler::Sample(std::default_random_engine& randomNumberGenerator) const
+{
+    if (cumulativeSizes_.empty())
+        throw RuntimeException{"Offset sampler has no allowed offset", RuntimeException::UNEXPECTED_ERROR};
+
+    std::uniform_int_distribution<size_t> distribution{0u, cumulativeSizes_.back() - 1u};
+
+    // Rank of the drawn offset among the allowed offsets; the guide table starts the search at the right slice.
+
+    const size_t rank{distribution(randomNumberGenerator)};
+
+    size_t rangeIndex{guideIndices_[rank / guideSliceSize_]};
+
+    while (cumulativeSizes_[rangeIndex] <= rank)
+        ++rangeIndex;
+
+    const size_t rangeStartRank{(rangeIndex == 0u) ? 0u : cumulativeSizes_[rangeIndex - 1u]};
+
+    return rangeStartIndices_[rangeIndex] + (rank - rangeStartRank);
+}
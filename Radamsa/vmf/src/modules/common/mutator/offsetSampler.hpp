@@ -0,0 +1,92 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Draws uniformly random offsets of a buffer while skipping its protected byte ranges.
+ *
+ * The allowed ranges are kept in order together with the prefix sums of their sizes.  A guide table maps
+ * equal slices of the allowed offsets to the first range that reaches into each slice, so a draw costs one
+ * uniform index and an expected constant number of steps, however many ranges are protected.
+ */
+class OffsetSampler
+{
+public:
+    OffsetSampler() = default;
+    ~OffsetSampler() = default;
+
+    OffsetSampler(const OffsetSampler&) = default;
+    OffsetSampler(OffsetSampler&&) = default;
+
+    OffsetSampler& operator=(const OffsetSampler&) = default;
+    OffsetSampler& operator=(OffsetSampler&&) = default;
+
+    /**
+     * @brief Builds the sampler over the offsets [0, size) that lie in none of the protected ranges.
+     *
+     * Each protected range is a pair of start and end offsets, the end excluded.  The ranges may overlap,
+     * need not be sorted, and are clipped to the buffer.
+     */
+    OffsetSampler(const size_t size, std::vector<std::pair<size_t, size_t>> protectedRanges);
+
+    size_t GetNumberOfOffsets() const noexcept { return cumulativeSizes_.empty() ? 0u : cumulativeSizes_.back(); }
+
+    bool IsEmpty() const noexcept { return cumulativeSizes_.empty(); }
+
+    /**
+     * @brief The lowest allowed offset; every offset below it is protected.  The sampler must not be empty.
+     */
+    size_t GetFirstOffset() const noexcept { return rangeStartIndices_.front(); }
+
+    bool IsAllowed(const size_t offset) const noexcept;
+
+    /**
+     * @brief Calls visitor(startIndex, endIndex) for every allowed range in ascending order, the end excluded.
+     */
+    template<typename Visitor>
+    void ForEachRange(Visitor&& visitor) const
+    {
+        for (size_t it{0u}; it < rangeStartIndices_.size(); ++it)
+        {
+            const size_t rangeSize{cumulativeSizes_[it] - ((it == 0u) ? 0u : cumulativeSizes_[it - 1u])};
+
+            visitor(rangeStartIndices_[it], rangeStartIndices_[it] + rangeSize);
+        }
+    }
+
+    /**
+     * @brief Returns an allowed offset drawn uniformly at random.  Throws a RuntimeException when the sampler is empty.
+     */
+    size_t Sample(std::default_random_engine& randomNumberGenerator) const;
+
+private:
+    std::vector<size_t> rangeStartIndices_;
+    std::vector<size_t> cumulativeSizes_;  // Number of allowed offsets in each range and the ranges before it.
+    std::vector<size_t> guideIndices_;     // First range holding an offset of each slice of guideSliceSize_ offsets.
+    size_t guideSliceSize_{1u};
+};
+}
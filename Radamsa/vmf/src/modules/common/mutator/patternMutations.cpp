@@ -0,0 +1,169 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <limits>
+
+// VMF Includes
+#include "patternMutations.hpp"
+
+size_t vmf::radamsa::mutations::PatternMutations::GetRandomNumberOfEdits(const PatternType patternType)
+{
+    switch (patternType)
+    {
+    case PatternType::Once:
+        return 1u;
+    case PatternType::Many:
+    {
+        // After the n-th edit, another edit follows with probability 1 / (n + 1).
+
+        size_t numberOfEdits{1u};
+
+        while (numberOfEdits < MAXIMUM_NUMBER_OF_EDITS && GetRandomValueWithinBounds(0u, numberOfEdits) == 0u)
+            ++numberOfEdits;
+
+        return numberOfEdits;
+    }
+    case PatternType::Burst:
+    {
+        // A burst has at least two edits, and every further edit follows with probability 3 / 4.
+
+        size_t numberOfEdits{2u};
+
+        while (numberOfEdits < MAXIMUM_NUMBER_OF_EDITS && GetRandomValueWithinBounds(0u, 3u) != 0u)
+            ++numberOfEdits;
+
+        return numberOfEdits;
+    }
+    default:
+        throw RuntimeException{"Invalid mutation pattern type", RuntimeException::UNEXPECTED_ERROR};
+    }
+}
+
+void vmf::radamsa::mutations::PatternMutations::ApplyByteEdit(
+                                                        PieceTable& pieceTable,
+                                                        const size_t index,
+                                                        const ByteEditType byteEditType)
+{
+    constexpr size_t maximumByteValue{std::numeric_limits<uint8_t>::max()};
+
+    switch (byteEditType)
+    {
+    case ByteEditType::DropByte:
+        pieceTable.EraseBytes(index, 1u);
+
+        break;
+    case ByteEditType::FlipByte:
+    {
+        const size_t randomBitShift{GetRandomValueWithinBounds(0u, std::numeric_limits<uint8_t>::digits - 1u)};
+
+        pieceTable.ReplaceByte(index, static_cast<char>(pieceTable.GetByte(index) ^ (0x01u << randomBitShift)));
+
+        break;
+    }
+    case ByteEditType::InsertByte:
+    {
+        const char randomByte{static_cast<char>(GetRandomValueWithinBounds(0u, maximumByteValue))};
+
+        pieceTable.InsertBytes(index + 1u, &randomByte, 1u);
+
+        break;
+    }
+    case ByteEditType::RepeatByte:
+        pieceTable.InsertRepeatedByte(index + 1u, pieceTable.GetByte(index), GetRandomByteRepetitionLength());
+
+        break;
+    case ByteEditType::IncrementByte:
+        pieceTable.ReplaceByte(index, static_cast<char>(static_cast<uint8_t>(pieceTable.GetByte(index)) + 1u));
+
+        break;
+    case ByteEditType::DecrementByte:
+        pieceTable.ReplaceByte(index, static_cast<char>(static_cast<uint8_t>(pieceTable.GetByte(index)) - 1u));
+
+        break;
+    case ByteEditType::RandomizeByte:
+        pieceTable.ReplaceByte(index, static_cast<char>(GetRandomValueWithinBounds(0u, maximumByteValue)));
+
+        break;
+    default:
+        throw RuntimeException{"Invalid byte edit type", RuntimeException::UNEXPECTED_ERROR};
+    }
+}
+
+void vmf::radamsa::mutations::PatternMutations::ApplyPatternEdits(
+                                                            PieceTable& pieceTable,
+                                                            const size_t minimumSeedIndex,
+                                                            const PatternType patternType,
+                                                            const ByteEditType byteEditType)
+{
+    // There is no position to edit in content that ends before the minimum seed index, such as an empty payload.
+
+    if (pieceTable.GetSize() <= minimumSeedIndex)
+        return;
+
+    const size_t numberOfEdits{GetRandomNumberOfEdits(patternType)};
+    const size_t burstIndex{GetRandomValueWithinBounds(minimumSeedIndex, pieceTable.GetSize() - 1u)};
+
+    for (size_t it{0u}; it < numberOfEdits; ++it)
+    {
+        // Earlier edits may have shrunk the content below the minimum seed index.
+
+        if (pieceTable.GetSize() <= minimumSeedIndex)
+            break;
+
+        const size_t upper{pieceTable.GetSize() - 1u};
+        const size_t index{
+                        (patternType == PatternType::Burst) ?
+                            std::min(burstIndex + GetRandomValueWithinBounds(0u, BURST_WINDOW_SIZE - 1u), upper) :
+                            GetRandomValueWithinBounds(minimumSeedIndex, upper)};
+
+        ApplyByteEdit(pieceTable, index, byteEditType);
+    }
+}
+
+void vmf::radamsa::mutations::PatternMutations::ApplyPattern(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey,
+                                                        const PatternType patternType,
+                                                        const ByteEditType byteEditType)
+{
+    // Consume the original buffer by stacking byte edits in a piece table, writing the result once and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    PieceTable pieceTable{originalBuffer, originalSize};
+
+    ApplyPatternEdits(pieceTable, minimumSeedIndex, patternType, byteEditType);
+
+    pieceTable.Write(newEntry, testCaseKey);
+}
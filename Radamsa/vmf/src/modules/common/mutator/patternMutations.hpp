@@ -0,0 +1,168 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "offsetBitmap.hpp"
+#include "offsetSampler.hpp"
+#include "pieceTable.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Implements the radamsa mutation patterns, which decide how many mutations are stacked into one output.
+ *
+ * - Once (od) applies a single mutation.
+ * - Many (nd) applies one mutation, then keeps adding mutations at random positions with a decaying probability.
+ * - Burst (bu) applies several mutations close to a single random position.
+ *
+ * The stacked mutations are byte edits recorded in a piece table over the original buffer, so the output
+ * is written once no matter how many edits are stacked.
+ */
+class PatternMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    enum class PatternType : uint8_t
+    {
+        Once = 0u,
+        Many,
+        Burst
+    };
+
+    enum class ByteEditType : uint8_t
+    {
+        DropByte = 0u,
+        FlipByte,
+        InsertByte,
+        RepeatByte,
+        IncrementByte,
+        DecrementByte,
+        RandomizeByte
+    };
+
+    // Upper bound on the number of stacked edits, so that a single output stays cheap to produce.
+
+    static constexpr size_t MAXIMUM_NUMBER_OF_EDITS{64u};
+
+    // Burst edits land within this many bytes of the burst position.
+
+    static constexpr size_t BURST_WINDOW_SIZE{16u};
+
+    PatternMutations() = delete;
+    virtual ~PatternMutations() = default;
+
+    PatternMutations(const PatternMutations&) = delete;
+    PatternMutations(PatternMutations&&) = delete;
+
+    PatternMutations& operator=(const PatternMutations&) = delete;
+    PatternMutations& operator=(PatternMutations&&) = delete;
+
+    void ApplyPattern(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const size_t minimumSeedIndex,
+                const int testCaseKey,
+                const PatternType patternType,
+                const ByteEditType byteEditType);
+
+protected:
+    PatternMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    size_t GetRandomNumberOfEdits(const PatternType patternType);
+
+    /**
+     * @brief Stacks the byte edits of one pattern application into a piece table.
+     */
+    void ApplyPatternEdits(
+                    PieceTable& pieceTable,
+                    const size_t minimumSeedIndex,
+                    const PatternType patternType,
+                    const ByteEditType byteEditType);
+
+    /**
+     * @brief Stacks the byte edits of one pattern application at offsets drawn from allowedOffsets only.
+     *
+     * AllowedOffsets is an OffsetSampler or an OffsetBitmap. The offsets are those of the original content, which
+     * must not have been edited yet, and the edits are applied from the highest offset down so that no edit moves
+     * the offset of another.
+     */
+    template<typename AllowedOffsets>
+    void ApplyPatternEditsAtOffsets(
+                                PieceTable& pieceTable,
+                                const AllowedOffsets& allowedOffsets,
+                                const PatternType patternType,
+                                const ByteEditType byteEditType)
+    {
+        if (allowedOffsets.IsEmpty())
+            return;
+
+        const size_t numberOfEdits{GetRandomNumberOfEdits(patternType)};
+        const size_t burstIndex{allowedOffsets.Sample(RANDOM_NUMBER_GENERATOR_)};
+
+        std::vector<size_t> indices;
+        indices.reserve(numberOfEdits);
+
+        for (size_t it{0u}; it < numberOfEdits; ++it)
+        {
+            if (patternType != PatternType::Burst)
+            {
+                indices.push_back(allowedOffsets.Sample(RANDOM_NUMBER_GENERATOR_));
+
+                continue;
+            }
+
+            // Burst edits that would land on an offset that is not allowed, or past the end, are left out.
+
+            const size_t index{burstIndex + GetRandomValueWithinBounds(0u, BURST_WINDOW_SIZE - 1u)};
+
+            if (allowedOffsets.IsAllowed(index))
+                indices.push_back(index);
+        }
+
+        if (indices.empty())
+            indices.push_back(burstIndex);
+
+        // An edit only moves the bytes after its own offset, and a second edit of the same offset would reach the
+        // next byte, which may not be allowed.
+
+        std::sort(indices.begin(), indices.end(), std::greater<size_t>{});
+        indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+        for (const size_t index : indices)
+            ApplyByteEdit(pieceTable, index, byteEditType);
+    }
+
+    void ApplyByteEdit(
+                PieceTable& pieceTable,
+                const size_t index,
+                const ByteEditType byteEditType);
+};
+}
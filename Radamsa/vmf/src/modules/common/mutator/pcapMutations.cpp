@@ -0,0 +1,358 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <array>
+
+// VMF Includes
+#include "pcapMutations.hpp"
+#include "bufferSegments.hpp"
+
+namespace
+{
+constexpr size_t PCAP_FILE_HEADER_SIZE{24u};
+constexpr size_t PCAP_RECORD_HEADER_SIZE{16u};
+
+constexpr uint32_t PCAP_MAGIC_MICROSECONDS{0xa1b2c3d4u};
+constexpr uint32_t PCAP_MAGIC_NANOSECONDS{0xa1b23c4du};
+constexpr uint32_t PCAP_MAGIC_MICROSECONDS_SWAPPED{0xd4c3b2a1u};
+constexpr uint32_t PCAP_MAGIC_NANOSECONDS_SWAPPED{0x4d3cb2a1u};
+
+constexpr uint32_t PCAPNG_SECTION_HEADER_BLOCK{0x0a0d0d0au};
+constexpr uint32_t PCAPNG_SIMPLE_PACKET_BLOCK{0x00000003u};
+constexpr uint32_t PCAPNG_ENHANCED_PACKET_BLOCK{0x00000006u};
+constexpr uint32_t PCAPNG_BYTE_ORDER_MAGIC{0x1a2b3c4du};
+constexpr uint32_t PCAPNG_BYTE_ORDER_MAGIC_SWAPPED{0x4d3c2b1au};
+
+constexpr size_t PCAPNG_MINIMUM_BLOCK_SIZE{12u};
+
+constexpr std::array<uint8_t, 4u> INTERESTING_BYTES{0x00u, 0x7fu, 0x80u, 0xffu};
+constexpr char PADDING[4u]{};
+
+uint32_t ReadUInt32(const char* const buffer, const size_t index, const bool isBigEndian) noexcept
+{
+    uint32_t value{0u};
+
+    for (size_t it{0u}; it < sizeof(uint32_t); ++it)
+        value = (value << 8u) | static_cast<uint8_t>(buffer[index + (isBigEndian ? it : sizeof(uint32_t) - 1u - it)]);
+
+    return value;
+}
+
+void WriteUInt32(char* const buffer, const size_t index, const bool isBigEndian, const uint32_t value) noexcept
+{
+    for (size_t it{0u}; it < sizeof(uint32_t); ++it)
+        buffer[index + (isBigEndian ? sizeof(uint32_t) - 1u - it : it)] = static_cast<char>((value >> (8u * it)) & 0xffu);
+}
+
+size_t AlignToUInt32(const size_t size) noexcept
+{
+    return (size + sizeof(uint32_t) - 1u) & ~(sizeof(uint32_t) - 1u);
+}
+}
+
+vmf::radamsa::mutations::PcapMutations::PacketIndex vmf::radamsa::mutations::PcapMutations::BuildPacketIndex(
+                                                                                                        const char* const buffer,
+                                                                                                        const size_t size)
+{
+    PacketIndex index;
+
+    if (buffer == nullptr || size < PCAPNG_MINIMUM_BLOCK_SIZE)
+        return index;
+
+    const uint32_t magic{ReadUInt32(buffer, 0u, false)};
+
+    if (size >= PCAP_FILE_HEADER_SIZE &&
+        (magic == PCAP_MAGIC_MICROSECONDS || magic == PCAP_MAGIC_NANOSECONDS ||
+         magic == PCAP_MAGIC_MICROSECONDS_SWAPPED || magic == PCAP_MAGIC_NANOSECONDS_SWAPPED))
+    {
+        // Classic pcap: a file header followed by records of a 16 byte header and the captured bytes.
+        // A truncated final record ends the index.
+
+        const bool isBigEndian{magic == PCAP_MAGIC_MICROSECONDS_SWAPPED || magic == PCAP_MAGIC_NANOSECONDS_SWAPPED};
+
+        index.Format = CaptureFormat::Pcap;
+
+        for (size_t recordIndex{PCAP_FILE_HEADER_SIZE}; recordIndex + PCAP_RECORD_HEADER_SIZE <= size;)
+        {
+            const size_t dataSize{ReadUInt32(buffer, recordIndex + 8u, isBigEndian)};
+            const size_t dataStartIndex{recordIndex + PCAP_RECORD_HEADER_SIZE};
+
+            if (dataSize > size - dataStartIndex)
+                break;
+
+            index.Packets.push_back(Packet{dataStartIndex, dataSize, recordIndex + 8u, recordIndex + 12u, NO_FIELD, NO_FIELD, isBigEndian});
+
+            recordIndex = dataStartIndex + dataSize;
+        }
+    }
+    else if (magic == PCAPNG_SECTION_HEADER_BLOCK)
+    {
+        // pcapng: a sequence of blocks, each framed by two copies of its length. Every section header block
+        // sets the byte order of the blocks that follow it. A malformed block ends the index.
+
+        bool isBigEndian{false};
+
+        index.Format = CaptureFormat::PcapNg;
+
+        for (size_t blockIndex{0u}; blockIndex + PCAPNG_MINIMUM_BLOCK_SIZE <= size;)
+        {
+            const uint32_t blockType{ReadUInt32(buffer, blockIndex, isBigEndian)};
+
+            if (blockType == PCAPNG_SECTION_HEADER_BLOCK)
+            {
+                const uint32_t byteOrderMagic{ReadUInt32(buffer, blockIndex + 8u, false)};
+
+                if (byteOrderMagic == PCAPNG_BYTE_ORDER_MAGIC)
+                    isBigEndian = false;
+                else if (byteOrderMagic == PCAPNG_BYTE_ORDER_MAGIC_SWAPPED)
+                    isBigEndian = true;
+                else
+                    break;
+            }
+
+            const size_t blockSize{ReadUInt32(buffer, blockIndex + 4u, isBigEndian)};
+
+            if (blockSize < PCAPNG_MINIMUM_BLOCK_SIZE || blockSize % sizeof(uint32_t) != 0u || blockSize > size - blockIndex)
+                break;
+
+            const size_t trailingLengthIndex{blockIndex + blockSize - 4u};
+
+            if (blockType == PCAPNG_ENHANCED_PACKET_BLOCK && blockSize >= 32u)
+            {
+                const size_t dataSize{ReadUInt32(buffer, blockIndex + 20u, isBigEndian)};
+
+                if (dataSize <= blockSize - 32u && AlignToUInt32(dataSize) <= blockSize - 32u)
+                    index.Packets.push_back(
+                                    Packet{
+                                        blockIndex + 28u,
+                                        dataSize,
+                                        blockIndex + 20u,
+                                        blockIndex + 24u,
+                                        blockIndex + 4u,
+                                        trailingLengthIndex,
+                                        isBigEndian});
+            }
+            else if (blockType == PCAPNG_SIMPLE_PACKET_BLOCK && blockSize >= 16u)
+            {
+                // The captured size of a simple packet block is implied by the block size.
+
+                const size_t originalLength{ReadUInt32(buffer, blockIndex + 8u, isBigEndian)};
+
+                index.Packets.push_back(
+                                Packet{
+                                    blockIndex + 12u,
+                                    std::min(originalLength, blockSize - 16u),
+                                    NO_FIELD,
+                                    blockIndex + 8u,
+                                    blockIndex + 4u,
+                                    trailingLengthIndex,
+                                    isBigEndian});
+            }
+
+            blockIndex += blockSize;
+        }
+    }
+
+    return index;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::PcapMutations::PacketIndex> vmf::radamsa::mutations::PcapMutations::GetPacketIndex(
+                                                                                                                            const char* const buffer,
+                                                                                                                            const size_t size,
+                                                                                                                            const unsigned long seedId)
+{
+    return packetIndexCache_.GetOrBuild(
+                                    seedId,
+                                    [&]() { return BuildPacketIndex(buffer, size); });
+}
+
+bool vmf::radamsa::mutations::PcapMutations::GetRandomPacketIndex(
+                                                            const PacketIndex& index,
+                                                            const size_t minimumSeedIndex,
+                                                            size_t& packetIndex)
+{
+    // Packets are in file order, so the ones whose data starts at or after the minimum seed index form a suffix of the list.
+
+    const auto firstPacket{
+                    std::partition_point(
+                                    index.Packets.begin(),
+                                    index.Packets.end(),
+                                    [&](const Packet& packet) { return packet.DataStartIndex < minimumSeedIndex; })};
+
+    if (firstPacket == index.Packets.end())
+        return false;
+
+    packetIndex = GetRandomValueWithinBounds(
+                                        static_cast<size_t>(firstPacket - index.Packets.begin()),
+                                        index.Packets.size() - 1u);
+
+    return true;
+}
+
+void vmf::radamsa::mutations::PcapMutations::MutatePacket(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long originalId,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by changing one captured byte of a random packet and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const PacketIndex> index{GetPacketIndex(originalBuffer, originalSize, originalId)};
+
+    size_t packetIndex{0u};
+
+    WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+    if (!GetRandomPacketIndex(*index, minimumSeedIndex, packetIndex) || index->Packets[packetIndex].DataSize == 0u)
+        return;
+
+    const Packet& packet{index->Packets[packetIndex]};
+
+    char* byte{newEntry->getBufferPointer(testCaseKey) + GetRandomValueWithinBounds(packet.DataStartIndex, packet.DataStartIndex + packet.DataSize - 1u)};
+
+    // Flip a bit, replace the byte with a random value or with a boundary value.
+
+    switch (GetRandomValueWithinBounds(0u, 2u))
+    {
+    case 0u:
+        *byte = static_cast<char>(static_cast<uint8_t>(*byte) ^ (1u << GetRandomValueWithinBounds(0u, 7u)));
+
+        break;
+    case 1u:
+        *byte = static_cast<char>(GetRandomValueWithinBounds(0u, 0xffu));
+
+        break;
+    default:
+        *byte = static_cast<char>(INTERESTING_BYTES[GetRandomValueWithinBounds(0u, INTERESTING_BYTES.size() - 1u)]);
+
+        break;
+    }
+}
+
+void vmf::radamsa::mutations::PcapMutations::ResizePacket(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long originalId,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by inserting random bytes into or dropping bytes from a random packet,
+    // patching its length fields, and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const PacketIndex> index{GetPacketIndex(originalBuffer, originalSize, originalId)};
+
+    size_t packetIndex{0u};
+
+    if (!GetRandomPacketIndex(*index, minimumSeedIndex, packetIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const Packet& packet{index->Packets[packetIndex]};
+
+    // Empty packets can only grow.
+
+    const bool isInsertion{packet.DataSize == 0u || GetRandomValueWithinBounds(0u, 1u) == 1u};
+
+    const size_t editSize{GetRandomValueWithinBounds(1u, isInsertion ? MAXIMUM_RESIZE : std::min(MAXIMUM_RESIZE, packet.DataSize))};
+    const size_t editIndex{
+                        packet.DataStartIndex +
+                        GetRandomValueWithinBounds(0u, isInsertion ? packet.DataSize : packet.DataSize - editSize)};
+
+    std::array<char, MAXIMUM_RESIZE> insertedBytes;
+
+    if (isInsertion)
+        for (size_t it{0u}; it < editSize; ++it)
+            insertedBytes[it] = static_cast<char>(GetRandomValueWithinBounds(0u, 0xffu));
+
+    const size_t newDataSize{isInsertion ? packet.DataSize + editSize : packet.DataSize - editSize};
+
+    // pcapng packet data is padded to a multiple of four bytes; pcap records are not padded.
+
+    const bool isPadded{packet.BlockLengthIndex != NO_FIELD};
+
+    const size_t dataEndIndex{packet.DataStartIndex + packet.DataSize};
+    const size_t paddedEndIndex{packet.DataStartIndex + (isPadded ? AlignToUInt32(packet.DataSize) : packet.DataSize)};
+    const size_t newPaddingSize{isPadded ? AlignToUInt32(newDataSize) - newDataSize : 0u};
+
+    const size_t resumeIndex{isInsertion ? editIndex : editIndex + editSize};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, editIndex},
+             {insertedBytes.data(), isInsertion ? editSize : 0u},
+             {originalBuffer + resumeIndex, dataEndIndex - resumeIndex},
+             {PADDING, newPaddingSize},
+             {originalBuffer + paddedEndIndex, originalSize - paddedEndIndex}});
+
+    // Every length field before the packet data keeps its offset; the trailing pcapng block length moves with the data.
+
+    char* newBuffer{newEntry->getBufferPointer(testCaseKey)};
+
+    if (packet.CapturedLengthIndex != NO_FIELD)
+        WriteUInt32(newBuffer, packet.CapturedLengthIndex, packet.IsBigEndian, static_cast<uint32_t>(newDataSize));
+
+    // The original length keeps the number of bytes that were not captured.
+
+    const size_t originalLength{ReadUInt32(originalBuffer, packet.OriginalLengthIndex, packet.IsBigEndian)};
+    const size_t uncapturedSize{(originalLength > packet.DataSize) ? originalLength - packet.DataSize : 0u};
+
+    WriteUInt32(newBuffer, packet.OriginalLengthIndex, packet.IsBigEndian, static_cast<uint32_t>(newDataSize + uncapturedSize));
+
+    if (isPadded)
+    {
+        const size_t newPaddedEndIndex{packet.DataStartIndex + newDataSize + newPaddingSize};
+        const size_t blockSize{ReadUInt32(originalBuffer, packet.BlockLengthIndex, packet.IsBigEndian)};
+        const size_t newBlockSize{blockSize + newPaddedEndIndex - paddedEndIndex};
+
+        WriteUInt32(newBuffer, packet.BlockLengthIndex, packet.IsBigEndian, static_cast<uint32_t>(newBlockSize));
+        WriteUInt32(newBuffer, packet.TrailingLengthIndex + newPaddedEndIndex - paddedEndIndex, packet.IsBigEndian, static_cast<uint32_t>(newBlockSize));
+    }
+}
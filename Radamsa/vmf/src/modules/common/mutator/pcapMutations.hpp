@@ -0,0 +1,121 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "seedCache.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Mutations of packet capture files that stay inside a single packet.
+ *
+ * Classic pcap files (microsecond and nanosecond, either byte order) and pcapng files (enhanced and
+ * simple packet blocks, with the byte order of each section) are split into packet records, which are
+ * cached by storage entry ID.  A mutation edits the captured bytes of one packet only; when the packet
+ * grows or shrinks, its captured and original lengths are patched, and for pcapng the block padding and
+ * both copies of the block length are rewritten, so the rest of the capture still parses.
+ */
+class PcapMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    static constexpr size_t MAXIMUM_RESIZE{16u};
+    static constexpr size_t NO_FIELD{std::numeric_limits<size_t>::max()};
+
+    enum class CaptureFormat : uint8_t
+    {
+        None,
+        Pcap,
+        PcapNg
+    };
+
+    struct Packet
+    {
+        size_t DataStartIndex{0u};
+        size_t DataSize{0u};                   // Captured bytes, without any pcapng padding.
+        size_t CapturedLengthIndex{NO_FIELD};  // Offset of the captured length field; simple packet blocks have none.
+        size_t OriginalLengthIndex{0u};
+        size_t BlockLengthIndex{NO_FIELD};     // Offset of the leading pcapng block length field; pcap records have none.
+        size_t TrailingLengthIndex{NO_FIELD};  // Offset of the trailing pcapng block length field.
+        bool IsBigEndian{false};
+    };
+
+    struct PacketIndex
+    {
+        CaptureFormat Format{CaptureFormat::None};
+        std::vector<Packet> Packets;
+    };
+
+    PcapMutations() = delete;
+    virtual ~PcapMutations() = default;
+
+    PcapMutations(const PcapMutations&) = delete;
+    PcapMutations(PcapMutations&&) = delete;
+
+    PcapMutations& operator=(const PcapMutations&) = delete;
+    PcapMutations& operator=(PcapMutations&&) = delete;
+
+    void MutatePacket(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+    void ResizePacket(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+protected:
+    PcapMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static PacketIndex BuildPacketIndex(
+                                const char* const buffer,
+                                const size_t size);
+
+    std::shared_ptr<const PacketIndex> GetPacketIndex(
+                                                const char* const buffer,
+                                                const size_t size,
+                                                const unsigned long seedId);
+
+    bool GetRandomPacketIndex(
+                        const PacketIndex& index,
+                        const size_t minimumSeedIndex,
+                        size_t& packetIndex);
+
+private:
+    SeedCache<PacketIndex> packetIndexCache_;
+};
+}
@@ -0,0 +1,185 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <cstring>
+
+// VMF Includes
+#include "pieceTable.hpp"
+
+vmf::radamsa::mutations::PieceTable::PieceTable(
+                                            const char* originalBuffer,
+                                            const size_t originalSize) : originalBuffer_{originalBuffer},
+                                                                         size_{originalSize}
+{
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    if (originalSize > 0u)
+        pieces_.push_back(Piece{false, 0u, originalSize});
+}
+
+size_t vmf::radamsa::mutations::PieceTable::SplitAt(const size_t index)
+{
+    // Return the index of the piece that starts at the given content index, splitting the piece that contains it if needed.
+
+    if (index > size_)
+        throw RuntimeException{"Piece table index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    size_t pieceStartIndex{0u};
+
+    for (size_t it{0u}; it < pieces_.size(); ++it)
+    {
+        Piece& piece{pieces_[it]};
+
+        if (index == pieceStartIndex)
+            return it;
+
+        if (index < pieceStartIndex + piece.Size)
+        {
+            const size_t headSize{index - pieceStartIndex};
+            const Piece tail{piece.IsInserted, piece.Offset + headSize, piece.Size - headSize};
+
+            piece.Size = headSize;
+            pieces_.insert(pieces_.begin() + static_cast<std::ptrdiff_t>(it) + 1, tail);
+
+            return it + 1u;
+        }
+
+        pieceStartIndex += piece.Size;
+    }
+
+    return pieces_.size();
+}
+
+char vmf::radamsa::mutations::PieceTable::GetByte(const size_t index) const
+{
+    size_t pieceStartIndex{0u};
+
+    for (const Piece& piece : pieces_)
+    {
+        if (index < pieceStartIndex + piece.Size)
+            return GetPieceData(piece)[index - pieceStartIndex];
+
+        pieceStartIndex += piece.Size;
+    }
+
+    throw RuntimeException{"Piece table index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+}
+
+void vmf::radamsa::mutations::PieceTable::InsertBytes(
+                                                const size_t index,
+                                                const char* data,
+                                                const size_t size)
+{
+    if (size == 0u)
+        return;
+
+    const size_t pieceIndex{SplitAt(index)};
+
+    pieces_.insert(pieces_.begin() + static_cast<std::ptrdiff_t>(pieceIndex), Piece{true, insertedBytes_.size(), size});
+    insertedBytes_.append(data, size);
+
+    size_ += size;
+}
+
+void vmf::radamsa::mutations::PieceTable::InsertRepeatedByte(
+                                                        const size_t index,
+                                                        const char value,
+                                                        const size_t count)
+{
+    if (count == 0u)
+        return;
+
+    const size_t pieceIndex{SplitAt(index)};
+
+    pieces_.insert(pieces_.begin() + static_cast<std::ptrdiff_t>(pieceIndex), Piece{true, insertedBytes_.size(), count});
+    insertedBytes_.append(count, value);
+
+    size_ += count;
+}
+
+void vmf::radamsa::mutations::PieceTable::EraseBytes(
+                                                const size_t index,
+                                                const size_t size)
+{
+    if (size == 0u)
+        return;
+
+    if (index + size > size_)
+        throw RuntimeException{"Piece table index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    // Split at the end first; splitting at the start afterwards shifts the end piece by one when it adds a piece.
+
+    size_t lastPieceIndex{SplitAt(index + size)};
+
+    const size_t numberOfPieces{pieces_.size()};
+    const size_t firstPieceIndex{SplitAt(index)};
+
+    lastPieceIndex += pieces_.size() - numberOfPieces;
+
+    pieces_.erase(
+            pieces_.begin() + static_cast<std::ptrdiff_t>(firstPieceIndex),
+            pieces_.begin() + static_cast<std::ptrdiff_t>(lastPieceIndex));
+
+    size_ -= size;
+}
+
+void vmf::radamsa::mutations::PieceTable::ReplaceByte(
+                                                const size_t index,
+                                                const char value)
+{
+    EraseBytes(index, 1u);
+    InsertBytes(index, &value, 1u);
+}
+
+void vmf::radamsa::mutations::PieceTable::Write(
+                                            StorageEntry* newEntry,
+                                            const int testCaseKey) const
+{
+    // The new buffer holds the content of every piece;
+    // additionally, it will contain one additional byte since a null-terminator will be appended to the end.
+
+    const size_t newBufferSize{size_ + 1u};
+
+    char* newBuffer{newEntry->allocateBuffer(testCaseKey, static_cast<int>(newBufferSize))};
+    char* destination{newBuffer};
+
+    for (const Piece& piece : pieces_)
+    {
+        memcpy(destination, GetPieceData(piece), piece.Size);
+
+        destination += piece.Size;
+    }
+
+    newBuffer[newBufferSize - 1u] = '\0';
+}
+
+std::string vmf::radamsa::mutations::PieceTable::GetContent() const
+{
+    std::string content;
+
+    content.reserve(size_);
+
+    for (const Piece& piece : pieces_)
+        content.append(GetPieceData(piece), piece.Size);
+
+    return content;
+}
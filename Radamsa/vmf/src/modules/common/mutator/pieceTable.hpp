@@ -0,0 +1,105 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <string>
+#include <vector>
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Piece table over an original buffer, used to stack several edits into a single output.
+ *
+ * The content is a sequence of pieces, each referring either to a range of the original buffer or to
+ * a range of an append-only buffer that holds every inserted byte.  Edits only split and insert pieces,
+ * so the original buffer is never copied until the final content is written out once.  The cost of an
+ * edit is linear in the number of pieces, which stays small since it grows by at most two per edit.
+ */
+class PieceTable
+{
+public:
+    PieceTable() = delete;
+    ~PieceTable() = default;
+
+    PieceTable(const char* originalBuffer, const size_t originalSize);
+
+    PieceTable(const PieceTable&) = delete;
+    PieceTable(PieceTable&&) = delete;
+
+    PieceTable& operator=(const PieceTable&) = delete;
+    PieceTable& operator=(PieceTable&&) = delete;
+
+    size_t GetSize() const noexcept { return size_; }
+
+    size_t GetNumberOfPieces() const noexcept { return pieces_.size(); }
+
+    char GetByte(const size_t index) const;
+
+    void InsertBytes(const size_t index, const char* data, const size_t size);
+
+    void InsertRepeatedByte(const size_t index, const char value, const size_t count);
+
+    void EraseBytes(const size_t index, const size_t size);
+
+    void ReplaceByte(const size_t index, const char value);
+
+    /**
+     * @brief Allocates the test case buffer of newEntry, writes the content into it and appends a null-terminator.
+     */
+    void Write(StorageEntry* newEntry, const int testCaseKey) const;
+
+    /**
+     * @brief Returns the content as a string, for edits whose result is post-processed before it is written out.
+     */
+    std::string GetContent() const;
+
+    /**
+     * @brief Calls visitor with the data and size of every piece in content order, without copying the content.
+     */
+    template<typename Visitor>
+    void ForEachPiece(Visitor&& visitor) const
+    {
+        for (const Piece& piece : pieces_)
+            visitor(GetPieceData(piece), piece.Size);
+    }
+
+private:
+    struct Piece
+    {
+        bool IsInserted{false}; // Whether Offset refers to the inserted bytes rather than the original buffer.
+        size_t Offset{0u};
+        size_t Size{0u};
+    };
+
+    const char* GetPieceData(const Piece& piece) const noexcept { return (piece.IsInserted ? insertedBytes_.data() : originalBuffer_) + piece.Offset; }
+
+    size_t SplitAt(const size_t index);
+
+    const char* originalBuffer_;
+    std::string insertedBytes_;
+    std::vector<Piece> pieces_;
+    size_t size_;
+};
+}
@@ -38,9 +38,207 @@
  *  a lot of features that AFL++ already provides.
  */
 
+// C/C++ Includes
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <string_view>
+
 // VMF Includes
 #include "ModuleFactory.hpp"
+#include "Logging.hpp"
 #include "radamsaMutator.hpp"
+#include "bufferSegments.hpp"
+
+namespace
+{
+using AlgorithmType = vmf::modules::radamsa::RadamsaMutator::AlgorithmType;
+
+struct AlgorithmName
+{
+    std::string_view Name;
+    AlgorithmType Type;
+};
+
+// Sorted by name, so that stringToType is a binary search. The radamsa short names of the mutations that have a
+// single counterpart here are accepted as aliases.
+
+constexpr std::array<AlgorithmName, 66> ALGORITHM_NAMES{{
+    AlgorithmName{"AsciiBadMutations_InjectBadString",    AlgorithmType::AsciiBadMutations_InjectBadString},
+    AlgorithmName{"ByteMutations_DecrementByte",          AlgorithmType::ByteMutations_DecrementByte},
+    AlgorithmName{"ByteMutations_DropByte",               AlgorithmType::ByteMutations_DropByte},
+    AlgorithmName{"ByteMutations_FlipByte",               AlgorithmType::ByteMutations_FlipByte},
+    AlgorithmName{"ByteMutations_IncrementByte",          AlgorithmType::ByteMutations_IncrementByte},
+    AlgorithmName{"ByteMutations_InsertByte",             AlgorithmType::ByteMutations_InsertByte},
+    AlgorithmName{"ByteMutations_PermuteByte",            AlgorithmType::ByteMutations_PermuteByte},
+    AlgorithmName{"ByteMutations_RandomizeByte",          AlgorithmType::ByteMutations_RandomizeByte},
+    AlgorithmName{"ByteMutations_RepeatByte",             AlgorithmType::ByteMutations_RepeatByte},
+    AlgorithmName{"ChunkMutations_DeleteChunk",           AlgorithmType::ChunkMutations_DeleteChunk},
+    AlgorithmName{"ChunkMutations_DuplicateChunk",        AlgorithmType::ChunkMutations_DuplicateChunk},
+    AlgorithmName{"ChunkMutations_SwapChunks",            AlgorithmType::ChunkMutations_SwapChunks},
+    AlgorithmName{"DictionaryMutations_DuplicateToken",   AlgorithmType::DictionaryMutations_DuplicateToken},
+    AlgorithmName{"DictionaryMutations_ExtendToken",      AlgorithmType::DictionaryMutations_ExtendToken},
+    AlgorithmName{"DictionaryMutations_InsertToken",      AlgorithmType::DictionaryMutations_InsertToken},
+    AlgorithmName{"DictionaryMutations_ReplaceToken",     AlgorithmType::DictionaryMutations_ReplaceToken},
+    AlgorithmName{"FuseMutations_FuseNext",               AlgorithmType::FuseMutations_FuseNext},
+    AlgorithmName{"FuseMutations_FuseOld",                AlgorithmType::FuseMutations_FuseOld},
+    AlgorithmName{"FuseMutations_FuseThis",               AlgorithmType::FuseMutations_FuseThis},
+    AlgorithmName{"IndentationMutations_DeleteBlock",     AlgorithmType::IndentationMutations_DeleteBlock},
+    AlgorithmName{"IndentationMutations_DuplicateBlock",  AlgorithmType::IndentationMutations_DuplicateBlock},
+    AlgorithmName{"IndentationMutations_ReindentBlock",   AlgorithmType::IndentationMutations_ReindentBlock},
+    AlgorithmName{"IndentationMutations_SwapBlocks",      AlgorithmType::IndentationMutations_SwapBlocks},
+    AlgorithmName{"JsonMutations_DeleteKey",              AlgorithmType::JsonMutations_DeleteKey},
+    AlgorithmName{"JsonMutations_DuplicateArrayMember",   AlgorithmType::JsonMutations_DuplicateArrayMember},
+    AlgorithmName{"JsonMutations_SpliceValue",            AlgorithmType::JsonMutations_SpliceValue},
+    AlgorithmName{"JsonMutations_SwapValues",             AlgorithmType::JsonMutations_SwapValues},
+    AlgorithmName{"JumpMutations_Jump",                   AlgorithmType::JumpMutations_Jump},
+    AlgorithmName{"JumpMutations_JumpLine",               AlgorithmType::JumpMutations_JumpLine},
+    AlgorithmName{"LineMutations_CopyLineCloseBy",        AlgorithmType::LineMutations_CopyLineCloseBy},
+    AlgorithmName{"LineMutations_DeleteLine",             AlgorithmType::LineMutations_DeleteLine},
+    AlgorithmName{"LineMutations_DeleteSequentialLines",  AlgorithmType::LineMutations_DeleteSequentialLines},
+    AlgorithmName{"LineMutations_DuplicateLine",          AlgorithmType::LineMutations_DuplicateLine},
+    AlgorithmName{"LineMutations_RepeatLine",             AlgorithmType::LineMutations_RepeatLine},
+    AlgorithmName{"LineMutations_SwapLine",               AlgorithmType::LineMutations_SwapLine},
+    AlgorithmName{"MarkupMutations_DeleteElement",        AlgorithmType::MarkupMutations_DeleteElement},
+    AlgorithmName{"MarkupMutations_DuplicateElement",     AlgorithmType::MarkupMutations_DuplicateElement},
+    AlgorithmName{"MarkupMutations_NestElement",          AlgorithmType::MarkupMutations_NestElement},
+    AlgorithmName{"MarkupMutations_SwapElements",         AlgorithmType::MarkupMutations_SwapElements},
+    AlgorithmName{"PcapMutations_MutatePacket",           AlgorithmType::PcapMutations_MutatePacket},
+    AlgorithmName{"PcapMutations_ResizePacket",           AlgorithmType::PcapMutations_ResizePacket},
+    AlgorithmName{"StringMutations_InjectEscape",         AlgorithmType::StringMutations_InjectEscape},
+    AlgorithmName{"StringMutations_RepeatString",         AlgorithmType::StringMutations_RepeatString},
+    AlgorithmName{"StringMutations_TruncateString",       AlgorithmType::StringMutations_TruncateString},
+    AlgorithmName{"WordMutations_DeleteWord",             AlgorithmType::WordMutations_DeleteWord},
+    AlgorithmName{"WordMutations_DuplicateWord",          AlgorithmType::WordMutations_DuplicateWord},
+    AlgorithmName{"WordMutations_RepeatWord",             AlgorithmType::WordMutations_RepeatWord},
+    AlgorithmName{"WordMutations_SwapWords",              AlgorithmType::WordMutations_SwapWords},
+    AlgorithmName{"ab",                                   AlgorithmType::AsciiBadMutations_InjectBadString},
+    AlgorithmName{"bd",                                   AlgorithmType::ByteMutations_DropByte},
+    AlgorithmName{"bed",                                  AlgorithmType::ByteMutations_DecrementByte},
+    AlgorithmName{"bei",                                  AlgorithmType::ByteMutations_IncrementByte},
+    AlgorithmName{"ber",                                  AlgorithmType::ByteMutations_RandomizeByte},
+    AlgorithmName{"bf",                                   AlgorithmType::ByteMutations_FlipByte},
+    AlgorithmName{"bi",                                   AlgorithmType::ByteMutations_InsertByte},
+    AlgorithmName{"bp",                                   AlgorithmType::ByteMutations_PermuteByte},
+    AlgorithmName{"br",                                   AlgorithmType::ByteMutations_RepeatByte},
+    AlgorithmName{"fn",                                   AlgorithmType::FuseMutations_FuseNext},
+    AlgorithmName{"fo",                                   AlgorithmType::FuseMutations_FuseOld},
+    AlgorithmName{"ft",                                   AlgorithmType::FuseMutations_FuseThis},
+    AlgorithmName{"ld",                                   AlgorithmType::LineMutations_DeleteLine},
+    AlgorithmName{"lds",                                  AlgorithmType::LineMutations_DeleteSequentialLines},
+    AlgorithmName{"li",                                   AlgorithmType::LineMutations_CopyLineCloseBy},
+    AlgorithmName{"lr",                                   AlgorithmType::LineMutations_RepeatLine},
+    AlgorithmName{"lr2",                                  AlgorithmType::LineMutations_DuplicateLine},
+    AlgorithmName{"ls",                                   AlgorithmType::LineMutations_SwapLine}
+}};
+
+constexpr bool IsSortedByName(const std::array<AlgorithmName, ALGORITHM_NAMES.size()>& algorithmNames) noexcept
+{
+    for (size_t it{1u}; it < algorithmNames.size(); ++it)
+        if (!(algorithmNames[it - 1u].Name < algorithmNames[it].Name))
+            return false;
+
+    return true;
+}
+
+static_assert(IsSortedByName(ALGORITHM_NAMES), "ALGORITHM_NAMES must be sorted by name");
+
+std::string_view TrimWhitespace(std::string_view text) noexcept
+{
+    const size_t startIndex{text.find_first_not_of(" \t")};
+
+    if (startIndex == std::string_view::npos)
+        return {};
+
+    return text.substr(startIndex, text.find_last_not_of(" \t") - startIndex + 1u);
+}
+
+/**
+ * @brief Sets the bits of the offsets [startIndex, endIndex) in offset bitmap words, a whole word at a time where it can.
+ */
+void SetOffsetRange(std::vector<uint64_t>& words, size_t startIndex, const size_t endIndex) noexcept
+{
+    constexpr size_t bitsPerWord{std::numeric_limits<uint64_t>::digits};
+
+    for (; startIndex < endIndex && startIndex % bitsPerWord != 0u; ++startIndex)
+        words[startIndex / bitsPerWord] |= uint64_t{1u} << (startIndex % bitsPerWord);
+
+    for (; startIndex + bitsPerWord <= endIndex; startIndex += bitsPerWord)
+        words[startIndex / bitsPerWord] = ~uint64_t{0u};
+
+    for (; startIndex < endIndex; ++startIndex)
+        words[startIndex / bitsPerWord] |= uint64_t{1u} << (startIndex % bitsPerWord);
+}
+
+/**
+ * @brief Offset bitmap words of the offsets outside the protected regions, or of every offset when nothing is protected.
+ */
+std::vector<uint64_t> GetAllowedOffsetWords(const vmf::radamsa::mutations::OffsetSampler* allowedOffsets, const size_t size)
+{
+    std::vector<uint64_t> words((size + std::numeric_limits<uint64_t>::digits - 1u) / std::numeric_limits<uint64_t>::digits, 0u);
+
+    if (allowedOffsets == nullptr)
+        SetOffsetRange(words, 0u, size);
+    else
+        allowedOffsets->ForEachRange([&](const size_t startIndex, const size_t endIndex) { SetOffsetRange(words, startIndex, endIndex); });
+
+    return words;
+}
+
+/**
+ * @brief Offset bitmap words of the offsets in blocks with an entropy of at most threshold bits per byte.
+ */
+std::vector<uint64_t> GetLowEntropyOffsetWords(const vmf::radamsa::mutations::EntropyMap& entropyMap, const float threshold, const size_t size)
+{
+    std::vector<uint64_t> words((size + std::numeric_limits<uint64_t>::digits - 1u) / std::numeric_limits<uint64_t>::digits, 0u);
+
+    const size_t blockSize{entropyMap.GetBlockSize()};
+
+    for (size_t it{0u}; it < entropyMap.GetNumberOfBlocks(); ++it)
+        if (entropyMap.GetEntropy(it) <= threshold)
+            SetOffsetRange(words, it * blockSize, std::min((it + 1u) * blockSize, size));
+
+    return words;
+}
+
+/**
+ * @brief Byte edits of one prefetch worker, drawn from its own random number stream.
+ *
+ * The byte edit types are drawn with the weights they have in the algType list, so that together with the
+ * choice of a byte edit type on the consuming thread every type keeps its listed share.
+ */
+class PrefetchByteEditor : public vmf::radamsa::mutations::PatternMutations
+{
+public:
+    PrefetchByteEditor(
+                    const std::default_random_engine::result_type randomSeed,
+                    const PatternType patternType,
+                    const std::vector<ByteEditType>& byteEditTypes,
+                    const std::vector<double>& weights) : vmf::radamsa::mutations::PatternMutations{randomNumberGenerator_},
+                                                          randomNumberGenerator_{randomSeed},
+                                                          patternType_{patternType},
+                                                          byteEditTypes_{byteEditTypes},
+                                                          byteEditTable_{weights}
+    {}
+
+    void Produce(const std::string& seed, std::string& output)
+    {
+        vmf::radamsa::mutations::PieceTable pieceTable{seed.data(), seed.size()};
+
+        ApplyPatternEdits(pieceTable, 0u, patternType_, byteEditTypes_[byteEditTable_.Sample(randomNumberGenerator_)]);
+
+        output = pieceTable.GetContent();
+        output.push_back('\0');
+    }
+
+private:
+    std::default_random_engine randomNumberGenerator_;
+    const PatternType patternType_;
+    const std::vector<ByteEditType> byteEditTypes_;
+    const vmf::radamsa::mutations::AliasTable byteEditTable_;
+};
+}
 
 namespace vmf
 {
@@ -49,6 +247,266 @@ REGISTER_MODULE(vmf::modules::radamsa::RadamsaMutator);
 
 vmf::Module* vmf::modules::radamsa::RadamsaMutator::build(std::string name) { return new RadamsaMutator(name); }
 
+void vmf::modules::radamsa::RadamsaMutator::init(ConfigInterface& config)
+{
+    // Every listed algorithm type is validated; a single type keeps the module on that type, while a weighted
+    // list has a type drawn from the alias table for every mutation.
+
+    const std::vector<std::pair<AlgorithmType, double>> weightedTypes{stringToWeightedTypes(config.getStringParam(getModuleName(), "algType"))};
+
+    std::vector<double> weights;
+
+    algorithmTypes_.clear();
+
+    for (const std::pair<AlgorithmType, double>& weightedType : weightedTypes)
+    {
+        SetAlgorithmType(weightedType.first);
+
+        algorithmTypes_.push_back(weightedType.first);
+        weights.push_back(weightedType.second);
+    }
+
+    SetAlgorithmType(algorithmTypes_.front());
+
+    algorithmTable_ = vmf::radamsa::mutations::AliasTable{weights};
+
+    // The adaptive scheduler ignores the listed weights and learns them from the outputs that reach new coverage.
+
+    isAdaptiveSchedulingEnabled_ = config.getBoolParam(getModuleName(), "adaptiveScheduling", false);
+
+    if (isAdaptiveSchedulingEnabled_)
+    {
+        const int feedbackInterval{config.getIntParam(getModuleName(), "adaptiveFeedbackInterval", 100)};
+
+        if (feedbackInterval <= 0)
+            throw RuntimeException{
+                            "RadamsaMutator adaptiveFeedbackInterval must be positive",
+                            RuntimeException::USAGE_ERROR};
+
+        algorithmScheduler_ = vmf::radamsa::mutations::BanditScheduler{algorithmTypes_.size()};
+        coverageFeedbackInterval_ = static_cast<size_t>(feedbackInterval);
+        mutationsSinceFeedback_ = 0u;
+    }
+
+    patternType_ = stringToPatternType(config.getStringParam(getModuleName(), "pattern", "od"));
+
+    const std::string dictionaryPath{config.getStringParam(getModuleName(), "dictionary", "")};
+    const bool autoDictionary{config.getBoolParam(getModuleName(), "autoDictionary", false)};
+
+    if (!dictionaryPath.empty())
+    {
+        dictionaryFileTokens_ = LoadDictionaryFile(dictionaryPath);
+
+        SetDictionary(dictionaryFileTokens_);
+
+        LOG_INFO << "RadamsaMutator loaded " << GetDictionary()->Tokens.size() << " dictionary tokens from " << dictionaryPath;
+    }
+    else if (!autoDictionary && std::any_of(algorithmTypes_.begin(), algorithmTypes_.end(), IsDictionaryAlgorithmType))
+        throw RuntimeException{
+                        "RadamsaMutator dictionary algorithm types require the dictionary or autoDictionary parameter",
+                        RuntimeException::USAGE_ERROR};
+
+    if (autoDictionary)
+    {
+        const int autoDictionarySize{config.getIntParam(getModuleName(), "autoDictionarySize", 256)};
+        const int refreshInterval{config.getIntParam(getModuleName(), "autoDictionaryRefreshInterval", 1000)};
+
+        if (autoDictionarySize <= 0 || refreshInterval <= 0)
+            throw RuntimeException{
+                            "RadamsaMutator autoDictionarySize and autoDictionaryRefreshInterval must be positive",
+                            RuntimeException::USAGE_ERROR};
+
+        tokenExtractor_ = std::make_unique<vmf::radamsa::mutations::TokenExtractor>(static_cast<size_t>(autoDictionarySize));
+        autoDictionaryRefreshInterval_ = static_cast<size_t>(refreshInterval);
+
+        // Refresh on the first mutation, so that the initial corpus is mined before any token is needed.
+
+        mutationsSinceRefresh_ = autoDictionaryRefreshInterval_;
+    }
+
+    // Stacked patterns are built from byte edits, so they are only available for the byte mutations that edit a single position.
+
+    // With a weighted list, only the listed byte mutations are stacked or routed to the decoded regions; the others run once.
+
+    const bool hasByteEditType{
+                        std::any_of(
+                                algorithmTypes_.begin(),
+                                algorithmTypes_.end(),
+                                [](const AlgorithmType algorithmType)
+                                {
+                                    ByteEditType byteEditType{ByteEditType::DropByte};
+
+                                    return GetByteEditType(algorithmType, byteEditType);
+                                })};
+
+    if (patternType_ != PatternType::Once && !hasByteEditType)
+        throw RuntimeException{
+                        "RadamsaMutator pattern nd and bu require a single position byte mutation algorithm type",
+                        RuntimeException::USAGE_ERROR};
+
+    // Compressed payloads and encoded blobs are edited through the same piece table as the stacked patterns.
+
+    isCompressedRegionsEnabled_ = config.getBoolParam(getModuleName(), "compressedRegions", false);
+    isEncodedRegionsEnabled_ = config.getBoolParam(getModuleName(), "encodedRegions", false);
+
+    if ((isCompressedRegionsEnabled_ || isEncodedRegionsEnabled_) && !hasByteEditType)
+        throw RuntimeException{
+                        "RadamsaMutator compressedRegions and encodedRegions require a single position byte mutation algorithm type",
+                        RuntimeException::USAGE_ERROR};
+
+    // Protected regions keep the mutations off the bytes a target checks before parsing on, such as magic numbers,
+    // lengths and checksums.
+
+    const std::string protectedPatternsPath{config.getStringParam(getModuleName(), "protectedPatterns", "")};
+
+    protectedOffsets_ = stringToProtectedOffsets(config.getStringParam(getModuleName(), "protectedOffsets", ""));
+    protectedPatterns_ = protectedPatternsPath.empty() ? std::vector<std::string>{} : LoadDictionaryFile(protectedPatternsPath);
+    protectedPatternMatcher_ = vmf::radamsa::mutations::AhoCorasick{protectedPatterns_};
+    protectedOffsetSamplerCache_.Clear();
+    isProtectedRegionsEnabled_ = !protectedOffsets_.empty() || !protectedPatterns_.empty();
+
+    if (isProtectedRegionsEnabled_ && (isCompressedRegionsEnabled_ || isEncodedRegionsEnabled_))
+        throw RuntimeException{
+                        "RadamsaMutator protectedOffsets and protectedPatterns cannot be combined with compressedRegions or encodedRegions",
+                        RuntimeException::USAGE_ERROR};
+
+    // The other algorithm types edit whole structures rather than offsets, so they can only keep a leading region.
+
+    const bool hasStructuralAlgorithmType{
+                                    std::any_of(
+                                            algorithmTypes_.begin(),
+                                            algorithmTypes_.end(),
+                                            [](const AlgorithmType algorithmType)
+                                            {
+                                                ByteEditType byteEditType{ByteEditType::DropByte};
+
+                                                return !GetByteEditType(algorithmType, byteEditType) && algorithmType != AlgorithmType::ByteMutations_PermuteByte;
+                                            })};
+
+    if (hasStructuralAlgorithmType && (!protectedPatterns_.empty() || !IsLeadingRegion(protectedOffsets_)))
+        throw RuntimeException{
+                        "RadamsaMutator protectedPatterns and protectedOffsets other than a leading region are only supported by the byte mutation algorithm types",
+                        RuntimeException::USAGE_ERROR};
+
+    // The effector maps are written to the seeds by the calibration stage of RadamsaInputGenerator.
+
+    isEffectorMapEnabled_ = config.getBoolParam(getModuleName(), "effectorMap", false);
+    effectiveOffsetBitmapCache_.Clear();
+
+    if (isEffectorMapEnabled_ && (!hasByteEditType || isCompressedRegionsEnabled_ || isEncodedRegionsEnabled_))
+        throw RuntimeException{
+                        "RadamsaMutator effectorMap requires a single position byte mutation algorithm type, and cannot be combined with compressedRegions or encodedRegions",
+                        RuntimeException::USAGE_ERROR};
+
+    // Entropy maps steer the byte and line mutations away from compressed or encrypted blocks without running the target.
+
+    isEntropyMapEnabled_ = config.getBoolParam(getModuleName(), "entropyMap", false);
+    entropyMapCache_.Clear();
+    lowEntropyOffsetBitmapCache_.Clear();
+
+    if (isEntropyMapEnabled_)
+    {
+        const bool hasLineAlgorithmType{std::any_of(algorithmTypes_.begin(), algorithmTypes_.end(), IsLineAlgorithmType)};
+
+        if ((!hasByteEditType && !hasLineAlgorithmType) || isCompressedRegionsEnabled_ || isEncodedRegionsEnabled_)
+            throw RuntimeException{
+                            "RadamsaMutator entropyMap requires a single position byte mutation or line mutation algorithm type, and cannot be combined with compressedRegions or encodedRegions",
+                            RuntimeException::USAGE_ERROR};
+
+        const int entropyBlockSize{config.getIntParam(getModuleName(), "entropyBlockSize", 256)};
+
+        if (entropyBlockSize <= 0)
+            throw RuntimeException{
+                            "RadamsaMutator entropyBlockSize must be positive",
+                            RuntimeException::USAGE_ERROR};
+
+        entropyBlockSize_ = static_cast<size_t>(entropyBlockSize);
+        entropyThreshold_ = config.getFloatParam(getModuleName(), "entropyThreshold", 7.0f);
+
+        if (!(entropyThreshold_ > 0.0f && entropyThreshold_ <= 8.0f))
+            throw RuntimeException{
+                            "RadamsaMutator entropyThreshold must be greater than 0 and at most 8",
+                            RuntimeException::USAGE_ERROR};
+    }
+
+    isNoOpFallbackEnabled_ = config.getBoolParam(getModuleName(), "noOpFallback", true);
+
+    if (config.getBoolParam(getModuleName(), "duplicateSuppression", false))
+    {
+        const int duplicateFilterCapacity{config.getIntParam(getModuleName(), "duplicateFilterCapacity", 65536)};
+
+        if (duplicateFilterCapacity <= 0)
+            throw RuntimeException{
+                            "RadamsaMutator duplicateFilterCapacity must be positive",
+                            RuntimeException::USAGE_ERROR};
+
+        duplicateFilter_ = std::make_unique<vmf::radamsa::mutations::DuplicateFilter>(static_cast<size_t>(duplicateFilterCapacity));
+    }
+
+    // Prefetch workers produce the byte edit outputs of the current seed ahead of time; the other algorithm types
+    // still run on the calling thread.
+
+    const int prefetchWorkers{config.getIntParam(getModuleName(), "prefetchWorkers", 0)};
+
+    if (prefetchWorkers < 0)
+        throw RuntimeException{
+                        "RadamsaMutator prefetchWorkers must not be negative",
+                        RuntimeException::USAGE_ERROR};
+
+    if (isWorker_ && (isAdaptiveSchedulingEnabled_ || autoDictionary || prefetchWorkers > 0))
+        throw RuntimeException{
+                        "RadamsaMutator workers cannot use adaptiveScheduling, autoDictionary or prefetchWorkers",
+                        RuntimeException::USAGE_ERROR};
+
+    prefetcher_.reset();
+
+    if (prefetchWorkers > 0)
+    {
+        const int prefetchDepth{config.getIntParam(getModuleName(), "prefetchDepth", 16)};
+
+        if (prefetchDepth <= 0)
+            throw RuntimeException{
+                            "RadamsaMutator prefetchDepth must be positive",
+                            RuntimeException::USAGE_ERROR};
+
+        if (!hasByteEditType || isAdaptiveSchedulingEnabled_ || isCompressedRegionsEnabled_ || isEncodedRegionsEnabled_ || isProtectedRegionsEnabled_ || isEffectorMapEnabled_ || isEntropyMapEnabled_)
+            throw RuntimeException{
+                            "RadamsaMutator prefetchWorkers require a single position byte mutation algorithm type, and cannot be combined with adaptiveScheduling, compressedRegions, encodedRegions, protected regions, effectorMap or entropyMap",
+                            RuntimeException::USAGE_ERROR};
+
+        std::vector<ByteEditType> byteEditTypes;
+        std::vector<double> byteEditWeights;
+
+        for (size_t it{0u}; it < algorithmTypes_.size(); ++it)
+        {
+            ByteEditType byteEditType{ByteEditType::DropByte};
+
+            if (!GetByteEditType(algorithmTypes_[it], byteEditType))
+                continue;
+
+            byteEditTypes.push_back(byteEditType);
+            byteEditWeights.push_back(weights[it]);
+        }
+
+        // Every worker gets its own random number stream, seeded from this module's stream.
+
+        prefetcher_ = std::make_unique<vmf::radamsa::mutations::MutationPrefetcher>(
+                                                                                static_cast<size_t>(prefetchWorkers),
+                                                                                static_cast<size_t>(prefetchDepth),
+                                                                                [&](const size_t)
+                                                                                {
+                                                                                    auto byteEditor{
+                                                                                                std::make_shared<PrefetchByteEditor>(
+                                                                                                                                RANDOM_NUMBER_GENERATOR_(),
+                                                                                                                                patternType_,
+                                                                                                                                byteEditTypes,
+                                                                                                                                byteEditWeights)};
+
+                                                                                    return [byteEditor](const unsigned long, const std::string& seed, std::string& output) { byteEditor->Produce(seed, output); };
+                                                                                });
+    }
+}
+
 void vmf::modules::radamsa::RadamsaMutator::SetAlgorithmType(const AlgorithmType algorithmType)
 {
     switch(algorithmType)
@@ -66,7 +524,41 @@ void vmf::modules::radamsa::RadamsaMutator::SetAlgorithmType(const AlgorithmType
         case AlgorithmType::LineMutations_DuplicateLine:
         case AlgorithmType::LineMutations_CopyLineCloseBy:
         case AlgorithmType::LineMutations_RepeatLine:
-        case AlgorithmType::LineMutations_SwapLine: // Intentional Fallthrough
+        case AlgorithmType::LineMutations_SwapLine:
+        case AlgorithmType::FuseMutations_FuseThis:
+        case AlgorithmType::FuseMutations_FuseNext:
+        case AlgorithmType::FuseMutations_FuseOld:
+        case AlgorithmType::AsciiBadMutations_InjectBadString:
+        case AlgorithmType::MarkupMutations_DuplicateElement:
+        case AlgorithmType::MarkupMutations_DeleteElement:
+        case AlgorithmType::MarkupMutations_SwapElements:
+        case AlgorithmType::MarkupMutations_NestElement:
+        case AlgorithmType::JsonMutations_SwapValues:
+        case AlgorithmType::JsonMutations_DuplicateArrayMember:
+        case AlgorithmType::JsonMutations_DeleteKey:
+        case AlgorithmType::JsonMutations_SpliceValue:
+        case AlgorithmType::JumpMutations_Jump:
+        case AlgorithmType::JumpMutations_JumpLine:
+        case AlgorithmType::DictionaryMutations_InsertToken:
+        case AlgorithmType::DictionaryMutations_ReplaceToken:
+        case AlgorithmType::DictionaryMutations_DuplicateToken:
+        case AlgorithmType::DictionaryMutations_ExtendToken:
+        case AlgorithmType::IndentationMutations_DeleteBlock:
+        case AlgorithmType::IndentationMutations_DuplicateBlock:
+        case AlgorithmType::IndentationMutations_SwapBlocks:
+        case AlgorithmType::IndentationMutations_ReindentBlock:
+        case AlgorithmType::StringMutations_TruncateString:
+        case AlgorithmType::StringMutations_RepeatString:
+        case AlgorithmType::StringMutations_InjectEscape:
+        case AlgorithmType::WordMutations_DeleteWord:
+        case AlgorithmType::WordMutations_DuplicateWord:
+        case AlgorithmType::WordMutations_SwapWords:
+        case AlgorithmType::WordMutations_RepeatWord:
+        case AlgorithmType::ChunkMutations_DeleteChunk:
+        case AlgorithmType::ChunkMutations_DuplicateChunk:
+        case AlgorithmType::ChunkMutations_SwapChunks:
+        case AlgorithmType::PcapMutations_MutatePacket:
+        case AlgorithmType::PcapMutations_ResizePacket: // Intentional Fallthrough
             algorithmType_ = algorithmType;
 
             break;
@@ -86,117 +578,1230 @@ void vmf::modules::radamsa::RadamsaMutator::registerStorageNeeds(StorageRegistry
     normalTag_ = registry.registerTag(
                                 "RAN_SUCCESSFULLY",
                                 StorageRegistry::READ_ONLY);
+
+    if (isAdaptiveSchedulingEnabled_)
+        hasNewCoverageTag_ = registry.registerTag(
+                                            "HAS_NEW_COVERAGE",
+                                            StorageRegistry::READ_ONLY);
+
+    if (isEffectorMapEnabled_)
+        effectorMapKey_ = registry.registerKey(
+                                        "RADAMSA_EFFECTOR_MAP",
+                                        StorageRegistry::BUFFER,
+                                        StorageRegistry::READ_ONLY);
 }
 
 void vmf::modules::radamsa::RadamsaMutator::mutateTestCase(StorageModule& storage, StorageEntry* baseEntry, StorageEntry* newEntry, int testCaseKey)
+{
+    MutateChildren(storage, baseEntry, &newEntry, 1u, testCaseKey);
+}
+
+void vmf::modules::radamsa::RadamsaMutator::mutateTestCases(StorageModule& storage, StorageEntry* baseEntry, const std::vector<StorageEntry*>& newEntries, int testCaseKey)
+{
+    MutateChildren(storage, baseEntry, newEntries.data(), newEntries.size(), testCaseKey);
+}
+
+std::unique_ptr<vmf::modules::radamsa::RadamsaMutator> vmf::modules::radamsa::RadamsaMutator::CreateWorker(
+                                                                                                        ConfigInterface& config,
+                                                                                                        const std::default_random_engine::result_type randomSeed)
+{
+    auto worker{std::make_unique<RadamsaMutator>(getModuleName())};
+
+    worker->isWorker_ = true;
+    worker->RANDOM_NUMBER_GENERATOR_.seed(randomSeed);
+    worker->init(config);
+
+    return worker;
+}
+
+void vmf::modules::radamsa::RadamsaMutator::MutateWorkerTestCases(
+                                                                StorageModule& storage,
+                                                                StorageEntry* baseEntry,
+                                                                const std::vector<StorageEntry*>& newEntries,
+                                                                const std::vector<StorageEntry*>& otherEntries,
+                                                                int testCaseKey)
+{
+    struct OtherEntriesBinding
+    {
+        ~OtherEntriesBinding() { mutator.otherEntries_ = nullptr; }
+
+        RadamsaMutator& mutator;
+    };
+
+    const OtherEntriesBinding otherEntriesBinding{*this};
+
+    otherEntries_ = &otherEntries;
+
+    MutateChildren(storage, baseEntry, newEntries.data(), newEntries.size(), testCaseKey);
+}
+
+bool vmf::modules::radamsa::RadamsaMutator::IsRecombining() const noexcept
+{
+    return std::any_of(
+                    algorithmTypes_.begin(),
+                    algorithmTypes_.end(),
+                    [](const AlgorithmType algorithmType)
+                    {
+                        return algorithmType == AlgorithmType::FuseMutations_FuseNext ||
+                               algorithmType == AlgorithmType::FuseMutations_FuseOld ||
+                               algorithmType == AlgorithmType::JsonMutations_SpliceValue ||
+                               algorithmType == AlgorithmType::JumpMutations_Jump ||
+                               algorithmType == AlgorithmType::JumpMutations_JumpLine;
+                    });
+}
+
+void vmf::modules::radamsa::RadamsaMutator::MutateChildren(
+                                                        StorageModule& storage,
+                                                        StorageEntry* baseEntry,
+                                                        StorageEntry* const* newEntries,
+                                                        const size_t numberOfNewEntries,
+                                                        const int testCaseKey)
 {
     if (baseEntry == nullptr)
         throw RuntimeException("RadamsaMutator mutate called with null base entry", RuntimeException::OTHER);
-    if (newEntry == nullptr)
-	throw RuntimeException("RadamsaMutator mutate called with numm new entry", RuntimeException::OTHER);
 
-    const size_t minimumSeedIndex{0u};
+    for (size_t it{0u}; it < numberOfNewEntries; ++it)
+        if (newEntries[it] == nullptr)
+            throw RuntimeException("RadamsaMutator mutate called with null new entry", RuntimeException::OTHER);
+
     const int size{baseEntry->getBufferSize(testCaseKey)};
     const char* buffer{baseEntry->getBufferPointer(testCaseKey)};
 
     if(size <= 0)
         throw RuntimeException("RadamsaMutator mutate called with zero sized buffer", RuntimeException::USAGE_ERROR);
 
-    switch(algorithmType_)
+    if (prefetcher_ != nullptr && !prefetcher_->HasSeed(baseEntry->getID()))
+        prefetcher_->SetSeed(baseEntry->getID(), buffer, size);
+
+    // The line mutations answer line lookups on the base buffer from its cached line index rather than rescanning it
+    // for every child, and prefer the lines outside its high entropy blocks. The bindings are dropped on the way out,
+    // even when building them throws, since the buffer is not guaranteed to outlive the call.
+
+    struct LineIndexBinding
     {
-    case AlgorithmType::ByteMutations_DropByte:
-        DropByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::ByteMutations_FlipByte:
-        FlipByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::ByteMutations_InsertByte:
-        InsertByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::ByteMutations_RepeatByte:
-        RepeatByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::ByteMutations_PermuteByte:
-        PermuteByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::ByteMutations_IncrementByte:
-        IncrementByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::ByteMutations_DecrementByte:
-        DecrementByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::ByteMutations_RandomizeByte:
-        RandomizeByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::LineMutations_DeleteLine:
-        DeleteLine(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::LineMutations_DeleteSequentialLines:
-        DeleteSequentialLines(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::LineMutations_DuplicateLine:
-        DuplicateLine(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::LineMutations_CopyLineCloseBy:
-        CopyLineCloseBy(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::LineMutations_RepeatLine:
-        RepeatLine(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    case AlgorithmType::LineMutations_SwapLine:
-        SwapLine(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
-        
-        break;
-    default:
-        throw RuntimeException("Invalid RadamsaMutator algorithm type", RuntimeException::UNEXPECTED_ERROR);
+        ~LineIndexBinding() { mutator.UnbindLineIndex(); }
 
-        break;
-    }
+        RadamsaMutator& mutator;
+    };
+
+    struct PreferredOffsetsBinding
+    {
+        ~PreferredOffsetsBinding() { mutator.UnbindPreferredOffsets(); }
+
+        RadamsaMutator& mutator;
+    };
+
+    const LineIndexBinding lineIndexBinding{*this};
+
+    BindLineIndex(buffer, size, GetLineIndex(buffer, size, baseEntry->getID()));
+
+    const PreferredOffsetsBinding preferredOffsetsBinding{*this};
+
+    if (isEntropyMapEnabled_)
+        BindPreferredOffsets(
+                        buffer,
+                        size,
+                        GetLowEntropyOffsetBitmap(
+                                            buffer,
+                                            static_cast<size_t>(size),
+                                            baseEntry->getID(),
+                                            isProtectedRegionsEnabled_ ? GetProtectedOffsetSampler(buffer, size, baseEntry->getID()).get() : nullptr));
+
+    // The cached capabilities hold what the scan of the seed found, and the types given up on after repeated
+    // unchanged outputs are added to them, so they are kept for as long as the seed stays cached.
+
+    const std::shared_ptr<SeedCapabilities> seedCapabilities{isNoOpFallbackEnabled_ ? GetSeedCapabilities(buffer, size, baseEntry->getID()) : nullptr};
+
+    for (size_t it{0u}; it < numberOfNewEntries; ++it)
+        MutateChild(
+                storage,
+                baseEntry,
+                newEntries[it],
+                testCaseKey,
+                seedCapabilities.get());
 }
 
-vmf::modules::radamsa::RadamsaMutator::AlgorithmType vmf::modules::radamsa::RadamsaMutator::stringToType(std::string type)
+void vmf::modules::radamsa::RadamsaMutator::MutateChild(
+                                                    StorageModule& storage,
+                                                    StorageEntry* baseEntry,
+                                                    StorageEntry* newEntry,
+                                                    const int testCaseKey,
+                                                    SeedCapabilities* seedCapabilities)
 {
-    if(type.compare("ByteMutations_DropByte") == 0)
-        return AlgorithmType::ByteMutations_DropByte;
-    else if(type.compare("ByteMutations_FlipByte") == 0)
-        return AlgorithmType::ByteMutations_FlipByte;
-    else if(type.compare("ByteMutations_InsertByte") == 0)
-        return AlgorithmType::ByteMutations_InsertByte;
-    else if(type.compare("ByteMutations_RepeatByte") == 0)
-        return AlgorithmType::ByteMutations_RepeatByte;
-    else if(type.compare("ByteMutations_PermuteByte") == 0)
-        return AlgorithmType::ByteMutations_PermuteByte;
-    else if(type.compare("ByteMutations_IncrementByte") == 0)
-        return AlgorithmType::ByteMutations_IncrementByte;
-    else if(type.compare("ByteMutations_DecrementByte") == 0)
-        return  AlgorithmType::ByteMutations_DecrementByte;
-    else if(type.compare("ByteMutations_RandomizeByte") == 0)
-        return AlgorithmType::ByteMutations_RandomizeByte;
-    else if(type.compare("LineMutations_DeleteLine") == 0)
-        return AlgorithmType::LineMutations_DeleteLine;
-    else if(type.compare("LineMutations_DeleteSequentialLines") == 0)
-        return AlgorithmType::LineMutations_DeleteSequentialLines;
-    else if(type.compare("LineMutations_DuplicateLine") == 0)
-        return AlgorithmType::LineMutations_DuplicateLine;
-    else if(type.compare("LineMutations_CopyLineCloseBy") == 0)
-        return AlgorithmType::LineMutations_CopyLineCloseBy;
-    else if(type.compare("LineMutations_RepeatLine") == 0)
-        return AlgorithmType::LineMutations_RepeatLine;
-    else if(type.compare("LineMutations_SwapLine") == 0)
-        return AlgorithmType::LineMutations_SwapLine;
-    else
-        return AlgorithmType::Unknown;
+    const int size{baseEntry->getBufferSize(testCaseKey)};
+    const char* buffer{baseEntry->getBufferPointer(testCaseKey)};
+
+    size_t algorithmIndex{0u};
+
+    if (isAdaptiveSchedulingEnabled_)
+    {
+        if (++mutationsSinceFeedback_ >= coverageFeedbackInterval_)
+            RefreshCoverageFeedback(storage);
+
+        algorithmIndex = algorithmScheduler_.SelectArm(RANDOM_NUMBER_GENERATOR_);
+        algorithmType_ = algorithmTypes_[algorithmIndex];
+    }
+    else if (algorithmTypes_.size() > 1u)
+    {
+        algorithmIndex = algorithmTable_.Sample(RANDOM_NUMBER_GENERATOR_);
+        algorithmType_ = algorithmTypes_[algorithmIndex];
+    }
+
+    AlgorithmType algorithmType{algorithmType_};
+
+    // An algorithm type that is known to leave the seed unchanged is replaced before it costs an execution.
+
+    if (seedCapabilities != nullptr && !seedCapabilities->IsApplicable(algorithmType))
+        algorithmType = SelectFallbackAlgorithmType(*seedCapabilities, algorithmIndex);
+
+    if (isAdaptiveSchedulingEnabled_ && algorithmIndex < algorithmTypes_.size())
+        algorithmScheduler_.RecordOutput(newEntry->getID(), algorithmIndex);
+
+    if (tokenExtractor_ != nullptr && ++mutationsSinceRefresh_ >= autoDictionaryRefreshInterval_)
+        RefreshAutoDictionary(storage, testCaseKey);
+
+    ByteEditType byteEditType{ByteEditType::DropByte};
+
+    if (prefetcher_ != nullptr && GetByteEditType(algorithmType, byteEditType) && prefetcher_->TryPop(prefetchedOutput_))
+    {
+        // A ready output that repeats a recent output is replaced by the next ready one, if any.
+
+        for (size_t it{1u}; duplicateFilter_ != nullptr && it < MAXIMUM_NUMBER_OF_DUPLICATE_RETRIES_ && IsDuplicateOutput(prefetchedOutput_.data(), prefetchedOutput_.size() - 1u); ++it)
+        {
+            if (!prefetcher_->TryPop(prefetchedOutput_))
+                break;
+        }
+
+        char* newBuffer{newEntry->allocateBuffer(testCaseKey, static_cast<int>(prefetchedOutput_.size()))};
+
+        memcpy(newBuffer, prefetchedOutput_.data(), prefetchedOutput_.size());
+    }
+    else
+    {
+        MutateWithAlgorithmType(storage, baseEntry, newEntry, testCaseKey, algorithmType);
+    }
+
+    // The output is already written, so an unchanged output is only counted. A structural kernel that keeps leaving
+    // the seed unchanged lacks the structure it edits, and is not attempted on this seed again.
+
+    if (seedCapabilities != nullptr && IsStructuralAlgorithmType(algorithmType))
+    {
+        uint8_t& unchangedOutputCount{seedCapabilities->UnchangedOutputCounts[static_cast<uint8_t>(algorithmType)]};
+
+        if (!IsUnchanged(newEntry, testCaseKey, buffer, size))
+            unchangedOutputCount = 0u;
+        else if (++unchangedOutputCount >= MAXIMUM_NUMBER_OF_UNCHANGED_OUTPUTS_)
+            seedCapabilities->MarkUnproductive(algorithmType);
+    }
+
+    if (duplicateFilter_ != nullptr)
+        RecordOutput(newEntry, testCaseKey);
+}
+
+void vmf::modules::radamsa::RadamsaMutator::MutateWithAlgorithmType(
+                                                                StorageModule& storage,
+                                                                StorageEntry* baseEntry,
+                                                                StorageEntry* newEntry,
+                                                                const int testCaseKey,
+                                                                const AlgorithmType algorithmType)
+{
+    const int size{baseEntry->getBufferSize(testCaseKey)};
+    const char* buffer{baseEntry->getBufferPointer(testCaseKey)};
+
+    size_t minimumSeedIndex{0u};
+    ByteEditType byteEditType{ByteEditType::DropByte};
+
+    // Byte edits and permutations are only applied at allowed offsets. The other algorithm types edit whole structures
+    // rather than offsets, so they keep the protected bytes in front of the first allowed offset through the minimum
+    // seed index; init only accepts a leading region for them.
+
+    std::shared_ptr<const vmf::radamsa::mutations::OffsetSampler> allowedOffsets;
+
+    if (isProtectedRegionsEnabled_)
+    {
+        allowedOffsets = GetProtectedOffsetSampler(buffer, size, baseEntry->getID());
+
+        if (allowedOffsets->IsEmpty())
+        {
+            vmf::radamsa::mutations::WriteSegments(newEntry, testCaseKey, {{buffer, static_cast<size_t>(size)}});
+
+            return;
+        }
+    }
+
+    // On a calibrated seed, byte edits are further limited to the bytes that changed the coverage when probed; on
+    // other seeds, they are kept out of high entropy blocks.
+
+    const bool isByteEditType{GetByteEditType(algorithmType, byteEditType)};
+    std::shared_ptr<const vmf::radamsa::mutations::OffsetBitmap> effectiveOffsets{
+                                                                            (isByteEditType && isEffectorMapEnabled_) ?
+                                                                                GetEffectiveOffsetBitmap(baseEntry, testCaseKey, allowedOffsets.get()) :
+                                                                                nullptr};
+
+    if (effectiveOffsets == nullptr && isByteEditType && isEntropyMapEnabled_)
+        effectiveOffsets = GetLowEntropyOffsetBitmap(buffer, static_cast<size_t>(size), baseEntry->getID(), allowedOffsets.get());
+
+    // A byte edit that repeats a recent output is drawn again from the same offsets before it is written. Seeds that
+    // may hold compressed or encoded regions are left to the decoding path below.
+
+    const bool isRedrawingDuplicates{duplicateFilter_ != nullptr && !isCompressedRegionsEnabled_ && !isEncodedRegionsEnabled_};
+
+    if (effectiveOffsets != nullptr || (isByteEditType && (allowedOffsets != nullptr || isRedrawingDuplicates)))
+    {
+        for (size_t it{1u}; ; ++it)
+        {
+            vmf::radamsa::mutations::PieceTable pieceTable{buffer, static_cast<size_t>(size)};
+
+            if (effectiveOffsets != nullptr)
+                ApplyPatternEditsAtOffsets(pieceTable, *effectiveOffsets, patternType_, byteEditType);
+            else if (allowedOffsets != nullptr)
+                ApplyPatternEditsAtOffsets(pieceTable, *allowedOffsets, patternType_, byteEditType);
+            else
+                ApplyPatternEdits(pieceTable, 0u, patternType_, byteEditType);
+
+            // The pieces are hashed where they are, so a redrawn output costs no copy.
+
+            if (duplicateFilter_ != nullptr && it < MAXIMUM_NUMBER_OF_DUPLICATE_RETRIES_)
+            {
+                vmf::radamsa::mutations::DuplicateFilter::Hasher hasher;
+
+                pieceTable.ForEachPiece([&](const char* data, const size_t pieceSize) { hasher.Update(data, pieceSize); });
+
+                if (duplicateFilter_->Contains(hasher.Finish()))
+                    continue;
+            }
+
+            pieceTable.Write(newEntry, testCaseKey);
+
+            return;
+        }
+    }
+
+    if (allowedOffsets != nullptr && algorithmType == AlgorithmType::ByteMutations_PermuteByte)
+    {
+        PermuteAllowedBytes(newEntry, size, buffer, *allowedOffsets, testCaseKey);
+
+        return;
+    }
+
+    if (allowedOffsets != nullptr)
+    {
+        minimumSeedIndex = allowedOffsets->GetFirstOffset();
+
+        // The line mutations edit every line that reaches the character index, so they are started at the first line
+        // that begins after the protected bytes; with no such line the seed is left unchanged.
+
+        if (minimumSeedIndex > 0u && IsLineAlgorithmType(algorithmType))
+        {
+            const void* newline{memchr(buffer + minimumSeedIndex - 1u, '\n', static_cast<size_t>(size) - minimumSeedIndex + 1u)};
+
+            minimumSeedIndex = (newline == nullptr) ? static_cast<size_t>(size) : static_cast<size_t>(static_cast<const char*>(newline) - buffer) + 1u;
+
+            if (minimumSeedIndex == static_cast<size_t>(size))
+            {
+                vmf::radamsa::mutations::WriteSegments(newEntry, testCaseKey, {{buffer, static_cast<size_t>(size)}});
+
+                return;
+            }
+        }
+    }
+
+    // Seeds holding a compressed stream or an encoded blob have the byte edits applied to the decoded bytes; other seeds are mutated as usual.
+
+    if ((isCompressedRegionsEnabled_ || isEncodedRegionsEnabled_) && GetByteEditType(algorithmType, byteEditType))
+    {
+        auto applyPatternEdits{
+                        [&](vmf::radamsa::mutations::PieceTable& decoded) { ApplyPatternEdits(decoded, 0u, patternType_, byteEditType); }};
+
+        if (isCompressedRegionsEnabled_ && !GetCompressedRegionIndex(buffer, size, baseEntry->getID())->Regions.empty())
+        {
+            MutateCompressedRegion(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey, applyPatternEdits);
+
+            return;
+        }
+
+        if (isEncodedRegionsEnabled_ && !GetEncodedRegionIndex(buffer, size, baseEntry->getID())->Regions.empty())
+        {
+            MutateEncodedRegion(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey, applyPatternEdits);
+
+            return;
+        }
+    }
+
+    if (patternType_ != PatternType::Once && GetByteEditType(algorithmType, byteEditType))
+    {
+        ApplyPattern(newEntry, size, buffer, minimumSeedIndex, testCaseKey, patternType_, byteEditType);
+
+        return;
+    }
+
+    switch(algorithmType)
+    {
+    case AlgorithmType::ByteMutations_DropByte:
+        DropByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::ByteMutations_FlipByte:
+        FlipByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::ByteMutations_InsertByte:
+        InsertByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::ByteMutations_RepeatByte:
+        RepeatByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::ByteMutations_PermuteByte:
+        PermuteByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::ByteMutations_IncrementByte:
+        IncrementByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::ByteMutations_DecrementByte:
+        DecrementByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::ByteMutations_RandomizeByte:
+        RandomizeByte(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::LineMutations_DeleteLine:
+        DeleteLine(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::LineMutations_DeleteSequentialLines:
+        DeleteSequentialLines(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::LineMutations_DuplicateLine:
+        DuplicateLine(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::LineMutations_CopyLineCloseBy:
+        CopyLineCloseBy(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::LineMutations_RepeatLine:
+        RepeatLine(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::LineMutations_SwapLine:
+        SwapLine(newEntry, size, buffer, minimumSeedIndex, testCaseKey);
+        
+        break;
+    case AlgorithmType::FuseMutations_FuseThis:
+        FuseThis(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::FuseMutations_FuseNext:
+    {
+        StorageEntry* otherEntry{SelectOtherEntry(storage, baseEntry, testCaseKey)};
+
+        FuseNext(
+            newEntry,
+            size,
+            buffer,
+            baseEntry->getID(),
+            otherEntry->getBufferSize(testCaseKey),
+            otherEntry->getBufferPointer(testCaseKey),
+            otherEntry->getID(),
+            minimumSeedIndex,
+            testCaseKey);
+
+        break;
+    }
+    case AlgorithmType::FuseMutations_FuseOld:
+    {
+        StorageEntry* otherEntry{SelectOtherEntry(storage, baseEntry, testCaseKey)};
+
+        FuseOld(
+            newEntry,
+            size,
+            buffer,
+            baseEntry->getID(),
+            otherEntry->getBufferSize(testCaseKey),
+            otherEntry->getBufferPointer(testCaseKey),
+            otherEntry->getID(),
+            minimumSeedIndex,
+            testCaseKey);
+
+        break;
+    }
+    case AlgorithmType::AsciiBadMutations_InjectBadString:
+        InjectBadString(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::MarkupMutations_DuplicateElement:
+        DuplicateElement(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::MarkupMutations_DeleteElement:
+        DeleteElement(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::MarkupMutations_SwapElements:
+        SwapElements(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::MarkupMutations_NestElement:
+        NestElement(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::JsonMutations_SwapValues:
+        SwapValues(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::JsonMutations_DuplicateArrayMember:
+        DuplicateArrayMember(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::JsonMutations_DeleteKey:
+        DeleteKey(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::JsonMutations_SpliceValue:
+    {
+        StorageEntry* otherEntry{SelectOtherEntry(storage, baseEntry, testCaseKey)};
+
+        SpliceValue(
+            newEntry,
+            size,
+            buffer,
+            baseEntry->getID(),
+            otherEntry->getBufferSize(testCaseKey),
+            otherEntry->getBufferPointer(testCaseKey),
+            otherEntry->getID(),
+            minimumSeedIndex,
+            testCaseKey);
+
+        break;
+    }
+    case AlgorithmType::JumpMutations_Jump:
+    {
+        StorageEntry* otherEntry{SelectOtherEntry(storage, baseEntry, testCaseKey)};
+
+        Jump(
+            newEntry,
+            size,
+            buffer,
+            otherEntry->getBufferSize(testCaseKey),
+            otherEntry->getBufferPointer(testCaseKey),
+            minimumSeedIndex,
+            testCaseKey);
+
+        break;
+    }
+    case AlgorithmType::JumpMutations_JumpLine:
+    {
+        StorageEntry* otherEntry{SelectOtherEntry(storage, baseEntry, testCaseKey)};
+
+        JumpLine(
+            newEntry,
+            size,
+            buffer,
+            otherEntry->getBufferSize(testCaseKey),
+            otherEntry->getBufferPointer(testCaseKey),
+            minimumSeedIndex,
+            testCaseKey);
+
+        break;
+    }
+    case AlgorithmType::DictionaryMutations_InsertToken:
+        InsertToken(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::DictionaryMutations_ReplaceToken:
+        ReplaceToken(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::DictionaryMutations_DuplicateToken:
+        DuplicateToken(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::DictionaryMutations_ExtendToken:
+        ExtendToken(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::IndentationMutations_DeleteBlock:
+        DeleteBlock(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::IndentationMutations_DuplicateBlock:
+        DuplicateBlock(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::IndentationMutations_SwapBlocks:
+        SwapBlocks(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::IndentationMutations_ReindentBlock:
+        ReindentBlock(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::StringMutations_TruncateString:
+        TruncateString(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::StringMutations_RepeatString:
+        RepeatString(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::StringMutations_InjectEscape:
+        InjectEscape(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::WordMutations_DeleteWord:
+        DeleteWord(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::WordMutations_DuplicateWord:
+        DuplicateWord(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::WordMutations_SwapWords:
+        SwapWords(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::WordMutations_RepeatWord:
+        RepeatWord(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::ChunkMutations_DeleteChunk:
+        DeleteChunk(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::ChunkMutations_DuplicateChunk:
+        DuplicateChunk(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::ChunkMutations_SwapChunks:
+        SwapChunks(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::PcapMutations_MutatePacket:
+        MutatePacket(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    case AlgorithmType::PcapMutations_ResizePacket:
+        ResizePacket(newEntry, size, buffer, baseEntry->getID(), minimumSeedIndex, testCaseKey);
+
+        break;
+    default:
+        throw RuntimeException("Invalid RadamsaMutator algorithm type", RuntimeException::UNEXPECTED_ERROR);
+
+        break;
+    }
+}
+
+vmf::modules::radamsa::RadamsaMutator::AlgorithmType vmf::modules::radamsa::RadamsaMutator::stringToType(std::string type)
+{
+    const auto algorithmName{
+                        std::lower_bound(
+                                    ALGORITHM_NAMES.begin(),
+                                    ALGORITHM_NAMES.end(),
+                                    std::string_view{type},
+                                    [](const AlgorithmName& algorithmName, const std::string_view name) { return algorithmName.Name < name; })};
+
+    if (algorithmName == ALGORITHM_NAMES.end() || algorithmName->Name != type)
+        return AlgorithmType::Unknown;
+
+    return algorithmName->Type;
+}
+
+std::vector<std::pair<vmf::modules::radamsa::RadamsaMutator::AlgorithmType, double>> vmf::modules::radamsa::RadamsaMutator::stringToWeightedTypes(std::string types)
+{
+    // A comma separated list of algorithm types, each optionally followed by =weight; the default weight is 1.
+    // Weights of a repeated type add up.
+
+    std::vector<std::pair<AlgorithmType, double>> weightedTypes;
+
+    std::string_view remainingTypes{types};
+
+    while (true)
+    {
+        const size_t separatorIndex{remainingTypes.find(',')};
+        const std::string_view entry{TrimWhitespace(remainingTypes.substr(0u, separatorIndex))};
+        const size_t weightIndex{entry.find('=')};
+
+        const AlgorithmType type{stringToType(std::string{TrimWhitespace(entry.substr(0u, weightIndex))})};
+        double weight{1.0};
+
+        if (weightIndex != std::string_view::npos)
+        {
+            const std::string weightText{TrimWhitespace(entry.substr(weightIndex + 1u))};
+
+            size_t parsedSize{0u};
+
+            try
+            {
+                weight = std::stod(weightText, &parsedSize);
+            }
+            catch (const std::exception&)
+            {
+                parsedSize = 0u;
+            }
+
+            if (parsedSize == 0u || parsedSize != weightText.size() || !(weight >= 0.0))
+                throw RuntimeException{"Invalid RadamsaMutator algorithm weight in " + std::string{entry}, RuntimeException::USAGE_ERROR};
+        }
+
+        const auto weightedType{
+                            std::find_if(
+                                    weightedTypes.begin(),
+                                    weightedTypes.end(),
+                                    [&](const std::pair<AlgorithmType, double>& other) { return other.first == type; })};
+
+        if (weightedType != weightedTypes.end())
+            weightedType->second += weight;
+        else
+            weightedTypes.emplace_back(type, weight);
+
+        if (separatorIndex == std::string_view::npos)
+            break;
+
+        remainingTypes.remove_prefix(separatorIndex + 1u);
+    }
+
+    return weightedTypes;
+}
+
+vmf::modules::radamsa::RadamsaMutator::PatternType vmf::modules::radamsa::RadamsaMutator::stringToPatternType(std::string pattern)
+{
+    if(pattern.compare("od") == 0)
+        return PatternType::Once;
+    else if(pattern.compare("nd") == 0)
+        return PatternType::Many;
+    else if(pattern.compare("bu") == 0)
+        return PatternType::Burst;
+    else
+        throw RuntimeException{"Unknown RadamsaMutator pattern " + pattern, RuntimeException::USAGE_ERROR};
+}
+
+std::vector<std::pair<long long, size_t>> vmf::modules::radamsa::RadamsaMutator::stringToProtectedOffsets(std::string offsets)
+{
+    // A comma separated list of start:size pairs; a negative start counts from the end of the seed, so -4:4 is the
+    // last four bytes.
+
+    std::vector<std::pair<long long, size_t>> protectedOffsets;
+
+    std::string_view remainingOffsets{offsets};
+
+    while (!TrimWhitespace(remainingOffsets).empty())
+    {
+        const size_t separatorIndex{remainingOffsets.find(',')};
+        const std::string_view entry{TrimWhitespace(remainingOffsets.substr(0u, separatorIndex))};
+        const size_t sizeIndex{entry.find(':')};
+
+        long long startIndex{0};
+        long long size{0};
+        bool isValid{sizeIndex != std::string_view::npos};
+
+        if (isValid)
+        {
+            const std::string startText{TrimWhitespace(entry.substr(0u, sizeIndex))};
+            const std::string sizeText{TrimWhitespace(entry.substr(sizeIndex + 1u))};
+
+            size_t parsedStartSize{0u};
+            size_t parsedSizeSize{0u};
+
+            try
+            {
+                startIndex = std::stoll(startText, &parsedStartSize);
+                size = std::stoll(sizeText, &parsedSizeSize);
+            }
+            catch (const std::exception&)
+            {
+                parsedStartSize = 0u;
+            }
+
+            isValid = parsedStartSize != 0u && parsedStartSize == startText.size() && parsedSizeSize == sizeText.size() && size > 0;
+        }
+
+        if (!isValid)
+            throw RuntimeException{"Invalid RadamsaMutator protected offsets " + std::string{entry}, RuntimeException::USAGE_ERROR};
+
+        protectedOffsets.emplace_back(startIndex, static_cast<size_t>(size));
+
+        if (separatorIndex == std::string_view::npos)
+            break;
+
+        remainingOffsets.remove_prefix(separatorIndex + 1u);
+    }
+
+    return protectedOffsets;
+}
+
+bool vmf::modules::radamsa::RadamsaMutator::IsLeadingRegion(std::vector<std::pair<long long, size_t>> protectedOffsets)
+{
+    // The regions are leading when, sorted by start, each one starts within the ones before it, beginning at zero.
+    // A region counted from the end of the seed never is, since the seed size is not known here.
+
+    std::sort(protectedOffsets.begin(), protectedOffsets.end());
+
+    size_t endIndex{0u};
+
+    for (const auto& [startIndex, size] : protectedOffsets)
+    {
+        if (startIndex < 0 || static_cast<size_t>(startIndex) > endIndex)
+            return false;
+
+        endIndex = std::max(endIndex, static_cast<size_t>(startIndex) + size);
+    }
+
+    return true;
+}
+
+bool vmf::modules::radamsa::RadamsaMutator::IsDictionaryAlgorithmType(const AlgorithmType algorithmType) noexcept
+{
+    return algorithmType == AlgorithmType::DictionaryMutations_InsertToken ||
+           algorithmType == AlgorithmType::DictionaryMutations_ReplaceToken ||
+           algorithmType == AlgorithmType::DictionaryMutations_DuplicateToken ||
+           algorithmType == AlgorithmType::DictionaryMutations_ExtendToken;
+}
+
+bool vmf::modules::radamsa::RadamsaMutator::IsLineAlgorithmType(const AlgorithmType algorithmType) noexcept
+{
+    return algorithmType == AlgorithmType::LineMutations_DeleteLine ||
+           algorithmType == AlgorithmType::LineMutations_DeleteSequentialLines ||
+           algorithmType == AlgorithmType::LineMutations_DuplicateLine ||
+           algorithmType == AlgorithmType::LineMutations_CopyLineCloseBy ||
+           algorithmType == AlgorithmType::LineMutations_RepeatLine ||
+           algorithmType == AlgorithmType::LineMutations_SwapLine;
+}
+
+bool vmf::modules::radamsa::RadamsaMutator::GetByteEditType(const AlgorithmType algorithmType, ByteEditType& byteEditType) noexcept
+{
+    switch(algorithmType)
+    {
+    case AlgorithmType::ByteMutations_DropByte:
+        byteEditType = ByteEditType::DropByte;
+
+        return true;
+    case AlgorithmType::ByteMutations_FlipByte:
+        byteEditType = ByteEditType::FlipByte;
+
+        return true;
+    case AlgorithmType::ByteMutations_InsertByte:
+        byteEditType = ByteEditType::InsertByte;
+
+        return true;
+    case AlgorithmType::ByteMutations_RepeatByte:
+        byteEditType = ByteEditType::RepeatByte;
+
+        return true;
+    case AlgorithmType::ByteMutations_IncrementByte:
+        byteEditType = ByteEditType::IncrementByte;
+
+        return true;
+    case AlgorithmType::ByteMutations_DecrementByte:
+        byteEditType = ByteEditType::DecrementByte;
+
+        return true;
+    case AlgorithmType::ByteMutations_RandomizeByte:
+        byteEditType = ByteEditType::RandomizeByte;
+
+        return true;
+    default:
+        return false;
+    }
+}
+
+vmf::StorageEntry* vmf::modules::radamsa::RadamsaMutator::SelectOtherEntry(StorageModule& storage, StorageEntry* baseEntry, const int testCaseKey)
+{
+    // Pick a random saved entry to recombine with the base entry, falling back to the base entry itself
+    // when the corpus holds nothing else that is usable. A worker draws from the entries it was handed instead,
+    // since the storage module is not safe to read while other workers mutate.
+
+    if (isWorker_)
+    {
+        if (otherEntries_ == nullptr || otherEntries_->empty())
+            return baseEntry;
+
+        std::uniform_int_distribution<size_t> distribution(0u, otherEntries_->size() - 1u);
+
+        StorageEntry* otherEntry{(*otherEntries_)[distribution(RANDOM_NUMBER_GENERATOR_)]};
+
+        if (otherEntry == nullptr || otherEntry->getBufferSize(testCaseKey) <= 0)
+            return baseEntry;
+
+        return otherEntry;
+    }
+
+    std::unique_ptr<Iterator> savedEntries{storage.getSavedEntries()};
+
+    const int numberOfSavedEntries{savedEntries->getSize()};
+
+    if (numberOfSavedEntries <= 0)
+        return baseEntry;
+
+    std::uniform_int_distribution<int> distribution(0, numberOfSavedEntries - 1);
+
+    StorageEntry* otherEntry{savedEntries->setIndexTo(distribution(RANDOM_NUMBER_GENERATOR_))};
+
+    if (otherEntry == nullptr || otherEntry->getBufferSize(testCaseKey) <= 0)
+        return baseEntry;
+
+    return otherEntry;
+}
+
+void vmf::modules::radamsa::RadamsaMutator::RefreshAutoDictionary(StorageModule& storage, const int testCaseKey)
+{
+    // Only the entries saved since the last refresh are mined; entry IDs increase as entries are created. The saved
+    // entries are kept in fitness order rather than creation order, so a refresh still walks the whole corpus to find
+    // them, at the cost of one ID comparison per older entry. The token extraction is proportional to the corpus
+    // growth, but the walk is linear in the corpus size, and so the total over a campaign grows quadratically with it.
+
+    mutationsSinceRefresh_ = 0u;
+
+    std::unique_ptr<Iterator> savedEntries{storage.getSavedEntries()};
+
+    unsigned long maximumId{lastExtractedId_};
+
+    while (savedEntries->hasNext())
+    {
+        StorageEntry* entry{savedEntries->getNext()};
+
+        if (entry->getID() <= lastExtractedId_)
+            continue;
+
+        const int size{entry->getBufferSize(testCaseKey)};
+
+        if (size > 0)
+            tokenExtractor_->AddEntry(entry->getBufferPointer(testCaseKey), static_cast<size_t>(size));
+
+        maximumId = std::max(maximumId, entry->getID());
+    }
+
+    lastExtractedId_ = maximumId;
+
+    // Recompiling the dictionary clears the token occurrence cache, so only do it when the extracted tokens changed.
+
+    if (tokenExtractor_->GetVersion() == publishedTokenVersion_)
+        return;
+
+    publishedTokenVersion_ = tokenExtractor_->GetVersion();
+
+    std::vector<std::string> tokens{dictionaryFileTokens_};
+    std::vector<std::string> extractedTokens{tokenExtractor_->GetTokens()};
+
+    tokens.insert(
+            tokens.end(),
+            std::make_move_iterator(extractedTokens.begin()),
+            std::make_move_iterator(extractedTokens.end()));
+
+    SetDictionary(tokens);
+
+    LOG_INFO << "RadamsaMutator automatic dictionary holds " << extractedTokens.size() << " extracted tokens";
+}
+
+void vmf::modules::radamsa::RadamsaMutator::RefreshCoverageFeedback(StorageModule& storage)
+{
+    // Entries are only saved after they are executed, so the outputs of the previous refresh intervals that reached
+    // new coverage are found among the entries saved since the last refresh; entry IDs increase as entries are created.
+    // As in RefreshAutoDictionary, finding them walks the whole saved corpus, which is kept in fitness order.
+
+    mutationsSinceFeedback_ = 0u;
+
+    std::unique_ptr<Iterator> savedEntries{storage.getSavedEntries()};
+
+    unsigned long maximumId{lastRewardedId_};
+
+    while (savedEntries->hasNext())
+    {
+        StorageEntry* entry{savedEntries->getNext()};
+
+        if (entry->getID() <= lastRewardedId_)
+            continue;
+
+        if (entry->hasTag(hasNewCoverageTag_))
+            algorithmScheduler_.RecordReward(entry->getID());
+
+        maximumId = std::max(maximumId, entry->getID());
+    }
+
+    lastRewardedId_ = maximumId;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::OffsetSampler> vmf::modules::radamsa::RadamsaMutator::GetProtectedOffsetSampler(
+                                                                                                                        const char* buffer,
+                                                                                                                        const size_t size,
+                                                                                                                        const unsigned long seedId)
+{
+    return protectedOffsetSamplerCache_.GetOrBuild(
+                                            seedId,
+                                            [&]()
+                                            {
+                                                std::vector<std::pair<size_t, size_t>> protectedRanges;
+
+                                                for (const std::pair<long long, size_t>& protectedOffset : protectedOffsets_)
+                                                {
+                                                    // A region that starts before the beginning of a short seed keeps its end.
+
+                                                    const long long startIndex{
+                                                                            (protectedOffset.first < 0) ?
+                                                                                static_cast<long long>(size) + protectedOffset.first :
+                                                                                protectedOffset.first};
+                                                    const long long endIndex{startIndex + static_cast<long long>(protectedOffset.second)};
+
+                                                    if (endIndex > 0)
+                                                        protectedRanges.emplace_back(static_cast<size_t>(std::max(startIndex, 0ll)), static_cast<size_t>(endIndex));
+                                                }
+
+                                                protectedPatternMatcher_.ForEachMatch(
+                                                                                buffer,
+                                                                                size,
+                                                                                [&](const size_t startIndex, const size_t patternIndex)
+                                                                                {
+                                                                                    protectedRanges.emplace_back(startIndex, startIndex + protectedPatterns_[patternIndex].size());
+                                                                                });
+
+                                                return vmf::radamsa::mutations::OffsetSampler{size, std::move(protectedRanges)};
+                                            });
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::OffsetBitmap> vmf::modules::radamsa::RadamsaMutator::GetEffectiveOffsetBitmap(
+                                                                                                                    StorageEntry* baseEntry,
+                                                                                                                    const int testCaseKey,
+                                                                                                                    const vmf::radamsa::mutations::OffsetSampler* allowedOffsets)
+{
+    // A seed has no effector map until its calibration probes have run, and the map never changes once it is written,
+    // so only seeds with a map are cached.
+
+    const int size{baseEntry->getBufferSize(testCaseKey)};
+    const int effectorMapSize{baseEntry->getBufferSize(effectorMapKey_)};
+
+    if (size <= 0 || effectorMapSize <= 0 || static_cast<size_t>(effectorMapSize) != (static_cast<size_t>(size) + 7u) / 8u)
+        return nullptr;
+
+    const std::shared_ptr<const vmf::radamsa::mutations::OffsetBitmap> effectiveOffsets{
+        effectiveOffsetBitmapCache_.GetOrBuild(
+                                        baseEntry->getID(),
+                                        [&]()
+                                        {
+                                            // Bit i % 8 of byte i / 8 of the effector map is set for every effective byte i.
+
+                                            const uint8_t* effectorMap{reinterpret_cast<const uint8_t*>(baseEntry->getBufferPointer(effectorMapKey_))};
+
+                                            std::vector<uint64_t> words((static_cast<size_t>(effectorMapSize) + 7u) / 8u, 0u);
+
+                                            for (size_t it{0u}; it < static_cast<size_t>(effectorMapSize); ++it)
+                                                words[it / 8u] |= static_cast<uint64_t>(effectorMap[it]) << (8u * (it % 8u));
+
+                                            const std::vector<uint64_t> allowedWords{GetAllowedOffsetWords(allowedOffsets, static_cast<size_t>(size))};
+
+                                            for (size_t it{0u}; it < words.size(); ++it)
+                                                words[it] &= allowedWords[it];
+
+                                            // The effective bytes in high entropy blocks are only kept when there are no others.
+
+                                            if (isEntropyMapEnabled_)
+                                            {
+                                                std::vector<uint64_t> lowEntropyWords{
+                                                                                GetLowEntropyOffsetWords(
+                                                                                                    *GetEntropyMap(baseEntry->getBufferPointer(testCaseKey), static_cast<size_t>(size), baseEntry->getID()),
+                                                                                                    entropyThreshold_,
+                                                                                                    static_cast<size_t>(size))};
+
+                                                bool isAnyLowEntropyOffset{false};
+
+                                                for (size_t it{0u}; it < words.size(); ++it)
+                                                    isAnyLowEntropyOffset |= (lowEntropyWords[it] &= words[it]) != 0u;
+
+                                                if (isAnyLowEntropyOffset)
+                                                    words = std::move(lowEntropyWords);
+                                            }
+
+                                            return vmf::radamsa::mutations::OffsetBitmap{std::move(words), static_cast<size_t>(size)};
+                                        })};
+
+    // A seed whose probes found no effective byte outside the protected regions is mutated as if it was not calibrated.
+
+    return effectiveOffsets->IsEmpty() ? nullptr : effectiveOffsets;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::EntropyMap> vmf::modules::radamsa::RadamsaMutator::GetEntropyMap(
+                                                                                                        const char* buffer,
+                                                                                                        const size_t size,
+                                                                                                        const unsigned long seedId)
+{
+    return entropyMapCache_.GetOrBuild(
+                                    seedId,
+                                    [&]() { return vmf::radamsa::mutations::EntropyMap{buffer, size, entropyBlockSize_}; });
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::OffsetBitmap> vmf::modules::radamsa::RadamsaMutator::GetLowEntropyOffsetBitmap(
+                                                                                                                    const char* buffer,
+                                                                                                                    const size_t size,
+                                                                                                                    const unsigned long seedId,
+                                                                                                                    const vmf::radamsa::mutations::OffsetSampler* allowedOffsets)
+{
+    const std::shared_ptr<const vmf::radamsa::mutations::OffsetBitmap> lowEntropyOffsets{
+        lowEntropyOffsetBitmapCache_.GetOrBuild(
+                                            seedId,
+                                            [&]()
+                                            {
+                                                std::vector<uint64_t> words{GetLowEntropyOffsetWords(*GetEntropyMap(buffer, size, seedId), entropyThreshold_, size)};
+
+                                                const std::vector<uint64_t> allowedWords{GetAllowedOffsetWords(allowedOffsets, size)};
+
+                                                for (size_t it{0u}; it < words.size(); ++it)
+                                                    words[it] &= allowedWords[it];
+
+                                                return vmf::radamsa::mutations::OffsetBitmap{std::move(words), size};
+                                            })};
+
+    // A seed without high entropy blocks is mutated as usual, and so is a seed that is all high entropy, since there is
+    // nothing better to steer the mutations to.
+
+    const size_t numberOfAllowedOffsets{allowedOffsets == nullptr ? size : allowedOffsets->GetNumberOfOffsets()};
+
+    if (lowEntropyOffsets->IsEmpty() || lowEntropyOffsets->GetNumberOfOffsets() == numberOfAllowedOffsets)
+        return nullptr;
+
+    return lowEntropyOffsets;
+}
+
+std::shared_ptr<vmf::modules::radamsa::RadamsaMutator::SeedCapabilities> vmf::modules::radamsa::RadamsaMutator::GetSeedCapabilities(
+                                                                                                                              const char* buffer,
+                                                                                                                              const size_t size,
+                                                                                                                              const unsigned long seedId)
+{
+    return seedCapabilitiesCache_.GetOrBuildMutable(
+                                        seedId,
+                                        [&]()
+                                        {
+                                            SeedCapabilities seedCapabilities;
+
+                                            // The line mutations leave binary seeds unchanged, and a swap needs two lines.
+
+                                            if (IsBinarish(buffer, size))
+                                            {
+                                                for (const AlgorithmType algorithmType : {
+                                                                                    AlgorithmType::LineMutations_DeleteLine,
+                                                                                    AlgorithmType::LineMutations_DeleteSequentialLines,
+                                                                                    AlgorithmType::LineMutations_DuplicateLine,
+                                                                                    AlgorithmType::LineMutations_CopyLineCloseBy,
+                                                                                    AlgorithmType::LineMutations_RepeatLine,
+                                                                                    AlgorithmType::LineMutations_SwapLine})
+                                                    seedCapabilities.MarkUnproductive(algorithmType);
+                                            }
+                                            else if (GetNumberOfLinesAfterIndex(buffer, size, 0u) < 2u)
+                                                seedCapabilities.MarkUnproductive(AlgorithmType::LineMutations_SwapLine);
+
+                                            return seedCapabilities;
+                                        });
+}
+
+vmf::modules::radamsa::RadamsaMutator::AlgorithmType vmf::modules::radamsa::RadamsaMutator::SelectFallbackAlgorithmType(
+                                                                                                                    const SeedCapabilities& seedCapabilities,
+                                                                                                                    size_t& algorithmIndex)
+{
+    // Another listed algorithm type that applies to the seed is picked uniformly; when none applies, a bit flip is used
+    // since it changes any seed.
+
+    size_t numberOfApplicableTypes{0u};
+
+    for (const AlgorithmType algorithmType : algorithmTypes_)
+        if (seedCapabilities.IsApplicable(algorithmType))
+            ++numberOfApplicableTypes;
+
+    if (numberOfApplicableTypes == 0u)
+    {
+        algorithmIndex = algorithmTypes_.size();
+
+        return AlgorithmType::ByteMutations_FlipByte;
+    }
+
+    std::uniform_int_distribution<size_t> distribution(0u, numberOfApplicableTypes - 1u);
+
+    size_t randomApplicableType{distribution(RANDOM_NUMBER_GENERATOR_)};
+
+    for (algorithmIndex = 0u; algorithmIndex < algorithmTypes_.size(); ++algorithmIndex)
+    {
+        if (!seedCapabilities.IsApplicable(algorithmTypes_[algorithmIndex]))
+            continue;
+
+        if (randomApplicableType == 0u)
+            break;
+
+        --randomApplicableType;
+    }
+
+    return algorithmTypes_[algorithmIndex];
+}
+
+bool vmf::modules::radamsa::RadamsaMutator::IsStructuralAlgorithmType(const AlgorithmType algorithmType) noexcept
+{
+    // These kernels only leave a seed unchanged when the seed lacks the lines, elements or records they edit.
+    // Byte edits change a seed unless they happen to write the same value, the dictionary changes as tokens
+    // are extracted, and the fuse and jump mutations depend on the other entry that is drawn.
+
+    switch(algorithmType)
+    {
+        case AlgorithmType::LineMutations_DeleteLine:
+        case AlgorithmType::LineMutations_DeleteSequentialLines:
+        case AlgorithmType::LineMutations_DuplicateLine:
+        case AlgorithmType::LineMutations_CopyLineCloseBy:
+        case AlgorithmType::LineMutations_RepeatLine:
+        case AlgorithmType::LineMutations_SwapLine:
+        case AlgorithmType::MarkupMutations_DuplicateElement:
+        case AlgorithmType::MarkupMutations_DeleteElement:
+        case AlgorithmType::MarkupMutations_SwapElements:
+        case AlgorithmType::MarkupMutations_NestElement:
+        case AlgorithmType::JsonMutations_SwapValues:
+        case AlgorithmType::JsonMutations_DuplicateArrayMember:
+        case AlgorithmType::JsonMutations_DeleteKey:
+        case AlgorithmType::IndentationMutations_DeleteBlock:
+        case AlgorithmType::IndentationMutations_DuplicateBlock:
+        case AlgorithmType::IndentationMutations_SwapBlocks:
+        case AlgorithmType::IndentationMutations_ReindentBlock:
+        case AlgorithmType::StringMutations_TruncateString:
+        case AlgorithmType::StringMutations_RepeatString:
+        case AlgorithmType::StringMutations_InjectEscape:
+        case AlgorithmType::WordMutations_DeleteWord:
+        case AlgorithmType::WordMutations_DuplicateWord:
+        case AlgorithmType::WordMutations_SwapWords:
+        case AlgorithmType::WordMutations_RepeatWord:
+        case AlgorithmType::ChunkMutations_DeleteChunk:
+        case AlgorithmType::ChunkMutations_DuplicateChunk:
+        case AlgorithmType::ChunkMutations_SwapChunks:
+        case AlgorithmType::PcapMutations_MutatePacket:
+        case AlgorithmType::PcapMutations_ResizePacket: // Intentional Fallthrough
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool vmf::modules::radamsa::RadamsaMutator::IsUnchanged(
+                                                    StorageEntry* newEntry,
+                                                    const int testCaseKey,
+                                                    const char* originalBuffer,
+                                                    const size_t originalSize)
+{
+    // An unchanged output is the original buffer followed by the null-terminator.
+
+    const int newSize{newEntry->getBufferSize(testCaseKey)};
+
+    return newSize == static_cast<int>(originalSize + 1u) && memcmp(newEntry->getBufferPointer(testCaseKey), originalBuffer, originalSize) == 0;
+}
+
+bool vmf::modules::radamsa::RadamsaMutator::IsDuplicateOutput(const char* data, const size_t size) const
+{
+    return duplicateFilter_->Contains(vmf::radamsa::mutations::DuplicateFilter::HashBytes(data, size));
+}
+
+void vmf::modules::radamsa::RadamsaMutator::RecordOutput(StorageEntry* newEntry, const int testCaseKey)
+{
+    // Only byte edits are redrawn on a duplicate; the other algorithm types write the new entry directly, so their
+    // duplicates are let through and only remembered. The null-terminator is not hashed.
+
+    const char* buffer{newEntry->getBufferPointer(testCaseKey)};
+    const size_t size{static_cast<size_t>(newEntry->getBufferSize(testCaseKey)) - 1u};
+
+    duplicateFilter_->Insert(vmf::radamsa::mutations::DuplicateFilter::HashBytes(buffer, size));
 }
@@ -19,12 +19,39 @@
  * ===========================================================================*/
 #pragma once
 
+// C/C++ Includes
+#include <array>
+
 // VMF Includes
 #include "MutatorModule.hpp"
 #include "StorageEntry.hpp"
 #include "RuntimeException.hpp"
 #include "byteMutations.hpp"
 #include "lineMutations.hpp"
+#include "fuseMutations.hpp"
+#include "asciiBadMutations.hpp"
+#include "markupMutations.hpp"
+#include "jsonMutations.hpp"
+#include "patternMutations.hpp"
+#include "jumpMutations.hpp"
+#include "dictionaryMutations.hpp"
+#include "indentationMutations.hpp"
+#include "stringMutations.hpp"
+#include "wordMutations.hpp"
+#include "chunkMutations.hpp"
+#include "pcapMutations.hpp"
+#include "compressionMutations.hpp"
+#include "encodingMutations.hpp"
+#include "tokenExtractor.hpp"
+#include "aliasTable.hpp"
+#include "ahoCorasick.hpp"
+#include "entropyMap.hpp"
+#include "offsetBitmap.hpp"
+#include "offsetSampler.hpp"
+#include "banditScheduler.hpp"
+#include "seedCache.hpp"
+#include "duplicateFilter.hpp"
+#include "mutationPrefetcher.hpp"
 
 
 namespace vmf::modules::radamsa
@@ -58,7 +85,21 @@ namespace vmf::modules::radamsa
  */
 class RadamsaMutator: public MutatorModule,
                       public vmf::radamsa::mutations::ByteMutations,
-                      public vmf::radamsa::mutations::LineMutations
+                      public vmf::radamsa::mutations::LineMutations,
+                      public vmf::radamsa::mutations::FuseMutations,
+                      public vmf::radamsa::mutations::AsciiBadMutations,
+                      public vmf::radamsa::mutations::MarkupMutations,
+                      public vmf::radamsa::mutations::JsonMutations,
+                      public vmf::radamsa::mutations::PatternMutations,
+                      public vmf::radamsa::mutations::JumpMutations,
+                      public vmf::radamsa::mutations::DictionaryMutations,
+                      public vmf::radamsa::mutations::IndentationMutations,
+                      public vmf::radamsa::mutations::StringMutations,
+                      public vmf::radamsa::mutations::WordMutations,
+                      public vmf::radamsa::mutations::ChunkMutations,
+                      public vmf::radamsa::mutations::PcapMutations,
+                      public vmf::radamsa::mutations::CompressionMutations,
+                      public vmf::radamsa::mutations::EncodingMutations
 {
 public:
     enum class AlgorithmType : uint8_t
@@ -77,6 +118,40 @@ public:
         LineMutations_CopyLineCloseBy,
         LineMutations_RepeatLine,
         LineMutations_SwapLine,
+        FuseMutations_FuseThis,
+        FuseMutations_FuseNext,
+        FuseMutations_FuseOld,
+        AsciiBadMutations_InjectBadString,
+        MarkupMutations_DuplicateElement,
+        MarkupMutations_DeleteElement,
+        MarkupMutations_SwapElements,
+        MarkupMutations_NestElement,
+        JsonMutations_SwapValues,
+        JsonMutations_DuplicateArrayMember,
+        JsonMutations_DeleteKey,
+        JsonMutations_SpliceValue,
+        JumpMutations_Jump,
+        JumpMutations_JumpLine,
+        DictionaryMutations_InsertToken,
+        DictionaryMutations_ReplaceToken,
+        DictionaryMutations_DuplicateToken,
+        DictionaryMutations_ExtendToken,
+        IndentationMutations_DeleteBlock,
+        IndentationMutations_DuplicateBlock,
+        IndentationMutations_SwapBlocks,
+        IndentationMutations_ReindentBlock,
+        StringMutations_TruncateString,
+        StringMutations_RepeatString,
+        StringMutations_InjectEscape,
+        WordMutations_DeleteWord,
+        WordMutations_DuplicateWord,
+        WordMutations_SwapWords,
+        WordMutations_RepeatWord,
+        ChunkMutations_DeleteChunk,
+        ChunkMutations_DuplicateChunk,
+        ChunkMutations_SwapChunks,
+        PcapMutations_MutatePacket,
+        PcapMutations_ResizePacket,
         Unknown
     };
 
@@ -85,19 +160,66 @@ public:
 
     RadamsaMutator(std::string name) noexcept : MutatorModule{name},
                                                 vmf::radamsa::mutations::ByteMutations{RANDOM_NUMBER_GENERATOR_},
-                                                vmf::radamsa::mutations::LineMutations{RANDOM_NUMBER_GENERATOR_}
+                                                vmf::radamsa::mutations::LineMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::FuseMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::AsciiBadMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::MarkupMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::JsonMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::PatternMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::JumpMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::DictionaryMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::IndentationMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::StringMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::WordMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::ChunkMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::PcapMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::CompressionMutations{RANDOM_NUMBER_GENERATOR_},
+                                                vmf::radamsa::mutations::EncodingMutations{RANDOM_NUMBER_GENERATOR_}
                                                 
     {}
 
     /////////////////////////////
     // MutatorModule Interface //
     /////////////////////////////
-    virtual void init(ConfigInterface& config) { SetAlgorithmType(stringToType(config.getStringParam(getModuleName(), "algType"))); }
+    virtual void init(ConfigInterface& config);
 
     virtual void registerStorageNeeds(StorageRegistry& registry);
     
     virtual void mutateTestCase(StorageModule& storage, StorageEntry* baseEntry, StorageEntry* newEntry, int testCaseKey);
 
+    /**
+     * @brief Mutates baseEntry once into each of newEntries, analysing the base buffer once for all of them.
+     *
+     * Each new entry is produced exactly as mutateTestCase would produce it, but the seed capabilities
+     * and the line index of the base entry are looked up once per call instead of once per child.
+     */
+    void mutateTestCases(StorageModule& storage, StorageEntry* baseEntry, const std::vector<StorageEntry*>& newEntries, int testCaseKey);
+
+    /**
+     * @brief Creates a mutator configured like this one that draws from its own random number stream, for a worker thread.
+     *
+     * The worker shares no state with this mutator and never reads the storage module, since other workers mutate
+     * at the same time: features that rescan it between mutations, and prefetch workers, are rejected for workers,
+     * and the saved entries to recombine with are handed to MutateWorkerTestCases instead.
+     */
+    std::unique_ptr<RadamsaMutator> CreateWorker(ConfigInterface& config, const std::default_random_engine::result_type randomSeed);
+
+    /**
+     * @brief Like mutateTestCases on a worker created by CreateWorker, with the saved entries that the recombining
+     * algorithm types draw from picked beforehand by the caller.
+     */
+    void MutateWorkerTestCases(
+                            StorageModule& storage,
+                            StorageEntry* baseEntry,
+                            const std::vector<StorageEntry*>& newEntries,
+                            const std::vector<StorageEntry*>& otherEntries,
+                            int testCaseKey);
+
+    /**
+     * @brief Whether any listed algorithm type recombines the base entry with another saved entry.
+     */
+    bool IsRecombining() const noexcept;
+
     static Module* build(std::string name);
 
 protected:
@@ -110,12 +232,184 @@ protected:
 
     static AlgorithmType stringToType(std::string type);
 
+    static std::vector<std::pair<AlgorithmType, double>> stringToWeightedTypes(std::string types);
+
+    static PatternType stringToPatternType(std::string pattern);
+
+    static std::vector<std::pair<long long, size_t>> stringToProtectedOffsets(std::string offsets);
+
+    static bool IsLeadingRegion(std::vector<std::pair<long long, size_t>> protectedOffsets);
+
+    static bool GetByteEditType(const AlgorithmType algorithmType, ByteEditType& byteEditType) noexcept;
+
+    static bool IsDictionaryAlgorithmType(const AlgorithmType algorithmType) noexcept;
+
+    static bool IsLineAlgorithmType(const AlgorithmType algorithmType) noexcept;
+
+    StorageEntry* SelectOtherEntry(StorageModule& storage, StorageEntry* baseEntry, const int testCaseKey);
+
+    /**
+     * @brief The algorithm types that are expected to change a seed, found from a scan of the seed and from the
+     * outputs it produced, along with the number of consecutive unchanged outputs of each structural algorithm type.
+     */
+    struct SeedCapabilities
+    {
+        static uint64_t GetAlgorithmTypeBit(const AlgorithmType algorithmType) noexcept { return uint64_t{1u} << static_cast<uint8_t>(algorithmType); }
+
+        bool IsApplicable(const AlgorithmType algorithmType) const noexcept { return (UnproductiveTypes & GetAlgorithmTypeBit(algorithmType)) == 0u; }
+
+        void MarkUnproductive(const AlgorithmType algorithmType) noexcept { UnproductiveTypes |= GetAlgorithmTypeBit(algorithmType); }
+
+        uint64_t UnproductiveTypes{0u};
+        std::array<uint8_t, 64u> UnchangedOutputCounts{};
+    };
+
+    static_assert(static_cast<uint8_t>(AlgorithmType::Unknown) <= 64u, "SeedCapabilities holds one bit per algorithm type");
+
+    void MutateChildren(
+                    StorageModule& storage,
+                    StorageEntry* baseEntry,
+                    StorageEntry* const* newEntries,
+                    const size_t numberOfNewEntries,
+                    const int testCaseKey);
+
+    void MutateChild(
+                StorageModule& storage,
+                StorageEntry* baseEntry,
+                StorageEntry* newEntry,
+                const int testCaseKey,
+                SeedCapabilities* seedCapabilities);
+
+    void MutateWithAlgorithmType(
+                            StorageModule& storage,
+                            StorageEntry* baseEntry,
+                            StorageEntry* newEntry,
+                            const int testCaseKey,
+                            const AlgorithmType algorithmType);
+
+    std::shared_ptr<SeedCapabilities> GetSeedCapabilities(const char* buffer, const size_t size, const unsigned long seedId);
+
+    /**
+     * @brief The offsets of the seed outside every protected region, found from the protected offsets and patterns.
+     */
+    std::shared_ptr<const vmf::radamsa::mutations::OffsetSampler> GetProtectedOffsetSampler(const char* buffer, const size_t size, const unsigned long seedId);
+
+    /**
+     * @brief The effective offsets of a calibrated seed that are not protected, or null when the seed has no effector map.
+     */
+    std::shared_ptr<const vmf::radamsa::mutations::OffsetBitmap> GetEffectiveOffsetBitmap(
+                                                                                    StorageEntry* baseEntry,
+                                                                                    const int testCaseKey,
+                                                                                    const vmf::radamsa::mutations::OffsetSampler* allowedOffsets);
+
+    std::shared_ptr<const vmf::radamsa::mutations::EntropyMap> GetEntropyMap(const char* buffer, const size_t size, const unsigned long seedId);
+
+    /**
+     * @brief The offsets of the seed outside its high entropy blocks that are not protected, or null when that leaves
+     * out no offset or every offset.
+     */
+    std::shared_ptr<const vmf::radamsa::mutations::OffsetBitmap> GetLowEntropyOffsetBitmap(
+                                                                                    const char* buffer,
+                                                                                    const size_t size,
+                                                                                    const unsigned long seedId,
+                                                                                    const vmf::radamsa::mutations::OffsetSampler* allowedOffsets);
+
+    AlgorithmType SelectFallbackAlgorithmType(const SeedCapabilities& seedCapabilities, size_t& algorithmIndex);
+
+    static bool IsStructuralAlgorithmType(const AlgorithmType algorithmType) noexcept;
+
+    static bool IsUnchanged(StorageEntry* newEntry, const int testCaseKey, const char* originalBuffer, const size_t originalSize);
+
+    bool IsDuplicateOutput(const char* data, const size_t size) const;
+    void RecordOutput(StorageEntry* newEntry, const int testCaseKey);
+
+    void RefreshAutoDictionary(StorageModule& storage, const int testCaseKey);
+
+    void RefreshCoverageFeedback(StorageModule& storage);
+
     static constexpr int INVALID_TEST_CASE_KEY_{std::numeric_limits<int>::min()};
     static constexpr int INVALID_NORMAL_TAG_{INVALID_TEST_CASE_KEY_};
 
     int normalTag_{INVALID_NORMAL_TAG_};
+    int hasNewCoverageTag_{INVALID_NORMAL_TAG_};
     AlgorithmType algorithmType_{AlgorithmType::ByteMutations_DropByte};
 
+    // Weighted algorithm types of the algType list; algorithmType_ is drawn from them when there is more than one.
+
+    std::vector<AlgorithmType> algorithmTypes_;
+    vmf::radamsa::mutations::AliasTable algorithmTable_;
+    PatternType patternType_{PatternType::Once};
+    bool isCompressedRegionsEnabled_{false};
+    bool isEncodedRegionsEnabled_{false};
+    bool isNoOpFallbackEnabled_{true};
+
+    // A structural algorithm type is only given up on a seed after this many unchanged outputs in a row, since a
+    // single one may be a coincidence, such as a swap of two equal lines. The capabilities of this many seeds are
+    // kept, and those of the least recently mutated seed are dropped first.
+
+    static constexpr uint8_t MAXIMUM_NUMBER_OF_UNCHANGED_OUTPUTS_{8u};
+    static constexpr size_t MAXIMUM_NUMBER_OF_COUNTED_SEEDS_{256u};
+
+    vmf::radamsa::mutations::SeedCache<SeedCapabilities, MAXIMUM_NUMBER_OF_COUNTED_SEEDS_> seedCapabilitiesCache_;
+
+    // A byte edit output is drawn this many times at most before a duplicate is let through.
+
+    static constexpr size_t MAXIMUM_NUMBER_OF_DUPLICATE_RETRIES_{8u};
+
+    // Automatic dictionary state; tokenExtractor_ is only allocated when the autoDictionary parameter is set.
+
+    std::unique_ptr<vmf::radamsa::mutations::TokenExtractor> tokenExtractor_;
+    std::vector<std::string> dictionaryFileTokens_;
+    size_t autoDictionaryRefreshInterval_{0u};
+    size_t mutationsSinceRefresh_{0u};
+    unsigned long lastExtractedId_{0u};
+    uint64_t publishedTokenVersion_{0u};
+
+    // Hashes of the recent outputs; only allocated when the duplicateSuppression parameter is set.
+
+    std::unique_ptr<vmf::radamsa::mutations::DuplicateFilter> duplicateFilter_;
+
+    // Set on the mutators created by CreateWorker; the other entries are only bound during MutateWorkerTestCases.
+
+    bool isWorker_{false};
+    const std::vector<StorageEntry*>* otherEntries_{nullptr};
+
+    // Byte edit outputs produced ahead on worker threads; only allocated when the prefetchWorkers parameter is set.
+
+    std::unique_ptr<vmf::radamsa::mutations::MutationPrefetcher> prefetcher_;
+    std::string prefetchedOutput_;
+
+    // Protected regions, given as start and size pairs, where a negative start counts from the end of the seed, and as
+    // byte patterns matched by one automaton; isProtectedRegionsEnabled_ is set when either is given.
+
+    bool isProtectedRegionsEnabled_{false};
+    std::vector<std::pair<long long, size_t>> protectedOffsets_;
+    std::vector<std::string> protectedPatterns_;
+    vmf::radamsa::mutations::AhoCorasick protectedPatternMatcher_;
+    vmf::radamsa::mutations::SeedCache<vmf::radamsa::mutations::OffsetSampler> protectedOffsetSamplerCache_;
+
+    // Effector maps of the calibrated seeds; effectorMapKey_ is only registered when the effectorMap parameter is set.
+
+    bool isEffectorMapEnabled_{false};
+    int effectorMapKey_{INVALID_TEST_CASE_KEY_};
+    vmf::radamsa::mutations::SeedCache<vmf::radamsa::mutations::OffsetBitmap> effectiveOffsetBitmapCache_;
+
+    // Entropy maps of the seeds, and their offsets outside the blocks above entropyThreshold_ bits per byte.
+
+    bool isEntropyMapEnabled_{false};
+    size_t entropyBlockSize_{256u};
+    float entropyThreshold_{7.0f};
+    vmf::radamsa::mutations::SeedCache<vmf::radamsa::mutations::EntropyMap> entropyMapCache_;
+    vmf::radamsa::mutations::SeedCache<vmf::radamsa::mutations::OffsetBitmap> lowEntropyOffsetBitmapCache_;
+
+    // Adaptive scheduling state; the scheduler replaces the alias table when the adaptiveScheduling parameter is set.
+
+    bool isAdaptiveSchedulingEnabled_{false};
+    vmf::radamsa::mutations::BanditScheduler algorithmScheduler_;
+    size_t coverageFeedbackInterval_{0u};
+    size_t mutationsSinceFeedback_{0u};
+    unsigned long lastRewardedId_{0u};
+
     std::default_random_engine RANDOM_NUMBER_GENERATOR_;
 
 private:
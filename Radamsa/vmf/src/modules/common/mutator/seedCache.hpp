@@ -0,0 +1,107 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Bounded cache of per-seed analysis results keyed by storage entry ID.
+ *
+ * The test case buffer of a storage entry does not change once the entry has been executed,
+ * so an analysis computed for an entry ID stays valid for the lifetime of that entry.
+ * The cache holds at most Capacity results and evicts the least recently used result when it is full.
+ * Results are handed out as shared pointers so that an evicted result stays alive while it is in use.
+ */
+template<typename T, size_t Capacity = 16u>
+class SeedCache
+{
+public:
+    SeedCache() = default;
+    ~SeedCache() = default;
+
+    SeedCache(const SeedCache&) = delete;
+    SeedCache(SeedCache&&) = delete;
+
+    SeedCache& operator=(const SeedCache&) = delete;
+    SeedCache& operator=(SeedCache&&) = delete;
+
+    /**
+     * @brief Returns the cached result for the seed, building and caching it first if it is not present.
+     *
+     * @param seedId the storage entry ID of the seed
+     * @param builder callable returning a T for the seed, only invoked on a cache miss
+     */
+    template<typename Builder>
+    std::shared_ptr<const T> GetOrBuild(const unsigned long seedId, Builder&& builder)
+    {
+        return GetOrBuildMutable(seedId, std::forward<Builder>(builder));
+    }
+
+    /**
+     * @brief Returns the cached result for the seed like GetOrBuild, for results that are refined after they are
+     * built, such as what is learned from the outputs of the seed.
+     *
+     * @param seedId the storage entry ID of the seed
+     * @param builder callable returning a T for the seed, only invoked on a cache miss
+     */
+    template<typename Builder>
+    std::shared_ptr<T> GetOrBuildMutable(const unsigned long seedId, Builder&& builder)
+    {
+        const auto cachedResult{results_.find(seedId)};
+
+        if (cachedResult != results_.end())
+        {
+            usageOrder_.splice(usageOrder_.end(), usageOrder_, cachedResult->second.second);
+
+            return cachedResult->second.first;
+        }
+
+        auto result{std::make_shared<T>(builder())};
+
+        if (results_.size() == Capacity)
+        {
+            results_.erase(usageOrder_.front());
+            usageOrder_.pop_front();
+        }
+
+        results_.emplace(seedId, std::make_pair(result, usageOrder_.insert(usageOrder_.end(), seedId)));
+
+        return result;
+    }
+
+    void Clear() noexcept
+    {
+        results_.clear();
+        usageOrder_.clear();
+    }
+
+    size_t Size() const noexcept { return results_.size(); }
+
+private:
+    std::unordered_map<unsigned long, std::pair<std::shared_ptr<T>, std::list<unsigned long>::iterator>> results_;
+    std::list<unsigned long> usageOrder_; // Seed IDs from the least to the most recently used.
+};
+}
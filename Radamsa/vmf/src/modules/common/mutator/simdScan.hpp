@@ -0,0 +1,262 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VMF_RADAMSA_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace vmf::radamsa::mutations::simd
+{
+/**
+ * @brief Byte classification over 64-byte blocks.
+ *
+ * Each classifier returns a 64-bit mask with bit i set when byte i of the block belongs to the class,
+ * following the simdjson approach of turning a block of input into bitmasks and then working on the
+ * masks with scalar bit operations.  SSE2 is used when the target supports it (every x86-64 target does);
+ * other targets fall back to a scalar loop that produces the same masks.
+ */
+constexpr size_t BLOCK_SIZE{64u};
+
+inline size_t CountTrailingZeros(const uint64_t mask) noexcept
+{
+#if defined(_MSC_VER)
+    unsigned long index{0u};
+    _BitScanForward64(&index, mask);
+    return static_cast<size_t>(index);
+#else
+    return static_cast<size_t>(__builtin_ctzll(mask));
+#endif
+}
+
+inline size_t PopCount(const uint64_t mask) noexcept
+{
+#if defined(_MSC_VER)
+    return static_cast<size_t>(__popcnt64(mask));
+#else
+    return static_cast<size_t>(__builtin_popcountll(mask));
+#endif
+}
+
+/**
+ * @brief Mask of the bytes equal to value.
+ */
+inline uint64_t EqualMask(const char* const block, const char value) noexcept
+{
+#if defined(VMF_RADAMSA_SSE2)
+    const __m128i target{_mm_set1_epi8(value)};
+
+    uint64_t mask{0u};
+
+    for (size_t it{0u}; it < BLOCK_SIZE; it += 16u)
+    {
+        const __m128i bytes{_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + it))};
+
+        mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, target)))) << it;
+    }
+
+    return mask;
+#else
+    uint64_t mask{0u};
+
+    for (size_t it{0u}; it < BLOCK_SIZE; ++it)
+        mask |= static_cast<uint64_t>(block[it] == value) << it;
+
+    return mask;
+#endif
+}
+
+/**
+ * @brief Mask of the bytes within [lower, upper], compared as unsigned values.
+ */
+inline uint64_t RangeMask(const char* const block, const uint8_t lower, const uint8_t upper) noexcept
+{
+#if defined(VMF_RADAMSA_SSE2)
+    // SSE2 only has signed byte comparisons, so both sides are biased by 0x80 to compare as unsigned.
+
+    const __m128i bias{_mm_set1_epi8(static_cast<char>(0x80u))};
+    const __m128i biasedLower{_mm_set1_epi8(static_cast<char>(lower ^ 0x80u))};
+    const __m128i biasedUpper{_mm_set1_epi8(static_cast<char>(upper ^ 0x80u))};
+
+    uint64_t mask{0u};
+
+    for (size_t it{0u}; it < BLOCK_SIZE; it += 16u)
+    {
+        const __m128i bytes{_mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + it)), bias)};
+        const __m128i isBelow{_mm_cmplt_epi8(bytes, biasedLower)};
+        const __m128i isAbove{_mm_cmpgt_epi8(bytes, biasedUpper)};
+
+        mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(isBelow, isAbove)) ^ 0xFFFF)) << it;
+    }
+
+    return mask;
+#else
+    uint64_t mask{0u};
+
+    for (size_t it{0u}; it < BLOCK_SIZE; ++it)
+    {
+        const uint8_t byte{static_cast<uint8_t>(block[it])};
+
+        mask |= static_cast<uint64_t>(byte >= lower && byte <= upper) << it;
+    }
+
+    return mask;
+#endif
+}
+
+/**
+ * @brief Computes a prefix XOR of the mask, so that bit i is the XOR of bits 0 up to i.
+ *
+ * Applied to a mask of quote characters, this yields the bytes between each opening quote and its closing quote.
+ */
+inline uint64_t PrefixXor(uint64_t mask) noexcept
+{
+    mask ^= mask << 1u;
+    mask ^= mask << 2u;
+    mask ^= mask << 4u;
+    mask ^= mask << 8u;
+    mask ^= mask << 16u;
+    mask ^= mask << 32u;
+
+    return mask;
+}
+
+/**
+ * @brief Tracks double-quoted strings with backslash escapes across consecutive blocks.
+ *
+ * Implements the simdjson string scan: escaped characters are found from the odd-length backslash sequences,
+ * the unescaped quotes are then turned into an in-string mask with a prefix XOR.  Blocks must be passed in order.
+ */
+class StringScanner
+{
+public:
+    /**
+     * @brief Returns the mask of bytes inside strings (the opening quote is included, the closing quote is not)
+     * and stores the mask of unescaped quotes in quoteMask.
+     */
+    uint64_t Next(const char* const block, uint64_t& quoteMask) noexcept
+    {
+        constexpr uint64_t evenBits{0x5555555555555555u};
+
+        uint64_t backslashMask{EqualMask(block, '\\') & ~previousEscaped_};
+
+        const uint64_t followsEscape{(backslashMask << 1u) | previousEscaped_};
+        const uint64_t oddSequenceStarts{backslashMask & ~evenBits & ~followsEscape};
+        const uint64_t sequencesStartingOnEvenBits{oddSequenceStarts + backslashMask};
+
+        previousEscaped_ = static_cast<uint64_t>(sequencesStartingOnEvenBits < oddSequenceStarts);
+
+        const uint64_t escapedMask{(evenBits ^ (sequencesStartingOnEvenBits << 1u)) & followsEscape};
+
+        quoteMask = EqualMask(block, '"') & ~escapedMask;
+
+        const uint64_t inStringMask{PrefixXor(quoteMask) ^ previousInString_};
+
+        previousInString_ = static_cast<uint64_t>(static_cast<int64_t>(inStringMask) >> 63u);
+
+        return inStringMask;
+    }
+
+    bool IsInString() const noexcept { return previousInString_ != 0u; }
+
+private:
+    uint64_t previousEscaped_{0u};
+    uint64_t previousInString_{0u};
+};
+
+/**
+ * @brief Calls visitor(block, blockOffset, validMask) for every 64-byte block of the buffer.
+ *
+ * The final partial block is copied into a zero-padded local block, and validMask marks which
+ * of its bytes belong to the buffer; for full blocks validMask has every bit set.
+ */
+template<typename Visitor>
+void ForEachBlock(const char* const buffer, const size_t size, Visitor&& visitor)
+{
+    size_t offset{0u};
+
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE)
+        visitor(buffer + offset, offset, ~uint64_t{0u});
+
+    if (offset < size)
+    {
+        char paddedBlock[BLOCK_SIZE]{};
+
+        const size_t remainingSize{size - offset};
+
+        memcpy(paddedBlock, buffer + offset, remainingSize);
+
+        visitor(static_cast<const char*>(paddedBlock), offset, (uint64_t{1u} << remainingSize) - 1u);
+    }
+}
+
+/**
+ * @brief Calls visitor(startIndex, size) for every maximal run of bytes selected by classifier(block).
+ *
+ * Run boundaries are extracted from the transitions of the class masks, so the cost of the scan is
+ * one classification per block plus a constant per run.
+ */
+template<typename Classifier, typename Visitor>
+void ForEachRun(const char* const buffer, const size_t size, Classifier&& classifier, Visitor&& visitor)
+{
+    bool isInRun{false};
+    size_t runStartIndex{0u};
+
+    ForEachBlock(
+            buffer,
+            size,
+            [&](const char* const block, const size_t blockOffset, const uint64_t validMask)
+            {
+                const uint64_t mask{classifier(block) & validMask};
+                const uint64_t previousBits{(mask << 1u) | static_cast<uint64_t>(isInRun)};
+
+                uint64_t transitions{mask ^ previousBits};
+
+                // A run that is still open at the end of the final block is closed below.
+
+                while (transitions != 0u)
+                {
+                    const size_t index{blockOffset + CountTrailingZeros(transitions)};
+
+                    if (isInRun)
+                        visitor(runStartIndex, index - runStartIndex);
+                    else
+                        runStartIndex = index;
+
+                    isInRun = !isInRun;
+                    transitions &= transitions - 1u;
+                }
+
+                isInRun = (mask >> (BLOCK_SIZE - 1u)) != 0u;
+            });
+
+    if (isInRun)
+        visitor(runStartIndex, size - runStartIndex);
+}
+}
@@ -0,0 +1,130 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <atomic>
+#include <utility>
+#include <vector>
+
+// VMF Includes
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Bounded lock-free queue between exactly one producer thread and one consumer thread.
+ *
+ * The slots form a ring whose size is the capacity rounded up to a power of two.  The producer only writes the tail
+ * index and the consumer only writes the head index, each on its own cache line, and each side keeps a cached copy
+ * of the other index so that it only reads the shared one when the queue looks full or empty.
+ */
+template<typename T>
+class SpscQueue
+{
+public:
+    SpscQueue() = delete;
+    ~SpscQueue() = default;
+
+    explicit SpscQueue(const size_t capacity) : slots_(GetRingSize(capacity)), mask_(slots_.size() - 1u) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue(SpscQueue&&) = delete;
+
+    SpscQueue& operator=(const SpscQueue&) = delete;
+    SpscQueue& operator=(SpscQueue&&) = delete;
+
+    size_t GetCapacity() const noexcept { return slots_.size(); }
+
+    /**
+     * @brief Producer side; returns false and leaves value untouched when the queue is full.
+     */
+    bool TryPush(T&& value)
+    {
+        const size_t tail{tail_.load(std::memory_order_relaxed)};
+
+        if (tail - cachedHead_ == slots_.size())
+        {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+
+            if (tail - cachedHead_ == slots_.size())
+                return false;
+        }
+
+        slots_[tail & mask_] = std::move(value);
+
+        tail_.store(tail + 1u, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief Producer side; a full queue only stops being full once the consumer pops.
+     */
+    bool IsFull() const noexcept { return tail_.load(std::memory_order_relaxed) - head_.load(std::memory_order_acquire) == slots_.size(); }
+
+    /**
+     * @brief Consumer side; returns false when the queue is empty.
+     */
+    bool TryPop(T& value)
+    {
+        const size_t head{head_.load(std::memory_order_relaxed)};
+
+        if (head == cachedTail_)
+        {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+
+            if (head == cachedTail_)
+                return false;
+        }
+
+        value = std::move(slots_[head & mask_]);
+
+        head_.store(head + 1u, std::memory_order_release);
+
+        return true;
+    }
+
+private:
+    static size_t GetRingSize(const size_t capacity)
+    {
+        if (capacity == 0u)
+            throw RuntimeException{"The queue capacity must be greater than 0", RuntimeException::USAGE_ERROR};
+
+        size_t ringSize{1u};
+
+        while (ringSize < capacity)
+            ringSize <<= 1u;
+
+        return ringSize;
+    }
+
+    std::vector<T> slots_;
+    const size_t mask_;
+
+    // The indices only ever increase; a slot is addressed by its index modulo the ring size.
+
+    alignas(64) std::atomic<size_t> head_{0u};
+    size_t cachedTail_{0u};
+
+    alignas(64) std::atomic<size_t> tail_{0u};
+    size_t cachedHead_{0u};
+};
+}
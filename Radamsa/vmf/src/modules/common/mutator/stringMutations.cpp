@@ -0,0 +1,327 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string_view>
+
+// VMF Includes
+#include "stringMutations.hpp"
+#include "bufferSegments.hpp"
+#include "simdScan.hpp"
+
+namespace
+{
+// Escape sequences and characters that string handling code tends to get wrong: invalid and surrogate
+// escapes, format specifiers, overlong and truncated UTF-8, bidirectional overrides and quote characters.
+
+constexpr std::array<std::string_view, 20u> STRING_INJECTIONS{
+                                                        "\\\"",
+                                                        "\\\\",
+                                                        "\\n",
+                                                        "\\u0000",
+                                                        "\\ud800",
+                                                        "\\udfff\\ud800",
+                                                        "\\uffff",
+                                                        "\\x00",
+                                                        "\\a",
+                                                        "\\u",
+                                                        "%n",
+                                                        "%s%s%s%s",
+                                                        "${",
+                                                        "'",
+                                                        std::string_view{"\0", 1u},
+                                                        "\xc0\x80",
+                                                        "\xe2\x80\xae",
+                                                        "\xf0\x9f",
+                                                        "\xff\xfe",
+                                                        "\r\n"};
+
+// Returns true when the byte at index follows an odd number of backslashes that start at or after startIndex,
+// which means an edit at index would split an escape sequence.
+
+bool IsEscaped(const char* const buffer, const size_t startIndex, const size_t index) noexcept
+{
+    size_t numberOfBackslashes{0u};
+
+    while (index - numberOfBackslashes > startIndex && buffer[index - numberOfBackslashes - 1u] == '\\')
+        ++numberOfBackslashes;
+
+    return (numberOfBackslashes % 2u) == 1u;
+}
+}
+
+vmf::radamsa::mutations::StringMutations::StringLiteralIndex vmf::radamsa::mutations::StringMutations::BuildStringLiteralIndex(
+                                                                                                                        const char* const buffer,
+                                                                                                                        const size_t size)
+{
+    StringLiteralIndex index;
+
+    if (buffer == nullptr)
+        return index;
+
+    // Unescaped quotes alternate between opening and closing a literal.
+
+    simd::StringScanner stringScanner;
+
+    bool isInString{false};
+    size_t openingQuoteIndex{0u};
+
+    simd::ForEachBlock(
+                buffer,
+                size,
+                [&](const char* const block, const size_t blockOffset, const uint64_t validMask)
+                {
+                    uint64_t quoteMask{0u};
+
+                    stringScanner.Next(block, quoteMask);
+
+                    for (quoteMask &= validMask; quoteMask != 0u; quoteMask &= quoteMask - 1u)
+                    {
+                        const size_t quoteIndex{blockOffset + simd::CountTrailingZeros(quoteMask)};
+
+                        if (isInString)
+                        {
+                            if (quoteIndex > openingQuoteIndex + 1u)
+                                index.NonEmptyLiterals.push_back(index.Literals.size());
+
+                            index.Literals.push_back(StringLiteral{openingQuoteIndex + 1u, quoteIndex - openingQuoteIndex - 1u});
+                        }
+                        else
+                            openingQuoteIndex = quoteIndex;
+
+                        isInString = !isInString;
+                    }
+                });
+
+    return index;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::StringMutations::StringLiteralIndex> vmf::radamsa::mutations::StringMutations::GetStringLiteralIndex(
+                                                                                                                                            const char* const buffer,
+                                                                                                                                            const size_t size,
+                                                                                                                                            const unsigned long seedId)
+{
+    return stringLiteralIndexCache_.GetOrBuild(
+                                            seedId,
+                                            [&]() { return BuildStringLiteralIndex(buffer, size); });
+}
+
+bool vmf::radamsa::mutations::StringMutations::GetRandomLiteralIndex(
+                                                                const StringLiteralIndex& index,
+                                                                const size_t minimumSeedIndex,
+                                                                const bool isNonEmpty,
+                                                                size_t& literalIndex)
+{
+    // Literals are in document order, so the ones at or after the minimum seed index form a suffix of the list.
+
+    if (isNonEmpty)
+    {
+        const auto firstLiteral{
+                            std::partition_point(
+                                            index.NonEmptyLiterals.begin(),
+                                            index.NonEmptyLiterals.end(),
+                                            [&](const size_t literal) { return index.Literals[literal].StartIndex < minimumSeedIndex; })};
+
+        if (firstLiteral == index.NonEmptyLiterals.end())
+            return false;
+
+        literalIndex = index.NonEmptyLiterals[
+                                        GetRandomValueWithinBounds(
+                                                            static_cast<size_t>(firstLiteral - index.NonEmptyLiterals.begin()),
+                                                            index.NonEmptyLiterals.size() - 1u)];
+
+        return true;
+    }
+
+    const auto firstLiteral{
+                        std::partition_point(
+                                        index.Literals.begin(),
+                                        index.Literals.end(),
+                                        [&](const StringLiteral& literal) { return literal.StartIndex < minimumSeedIndex; })};
+
+    if (firstLiteral == index.Literals.end())
+        return false;
+
+    literalIndex = GetRandomValueWithinBounds(
+                                        static_cast<size_t>(firstLiteral - index.Literals.begin()),
+                                        index.Literals.size() - 1u);
+
+    return true;
+}
+
+void vmf::radamsa::mutations::StringMutations::TruncateString(
+                                                            StorageEntry* newEntry,
+                                                            const size_t originalSize,
+                                                            const char* originalBuffer,
+                                                            const unsigned long originalId,
+                                                            const size_t minimumSeedIndex,
+                                                            const int testCaseKey)
+{
+    // Consume the original buffer by cutting the end off a random string literal and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const StringLiteralIndex> index{GetStringLiteralIndex(originalBuffer, originalSize, originalId)};
+
+    size_t literalIndex{0u};
+
+    if (!GetRandomLiteralIndex(*index, minimumSeedIndex, true, literalIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const StringLiteral& literal{index->Literals[literalIndex]};
+
+    // A backslash left at the end would escape the closing quote, so the cut never splits an escape sequence.
+
+    size_t truncatedSize{GetRandomValueWithinBounds(0u, literal.Size - 1u)};
+
+    if (IsEscaped(originalBuffer, literal.StartIndex, literal.StartIndex + truncatedSize))
+        --truncatedSize;
+
+    const size_t literalEndIndex{literal.StartIndex + literal.Size};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, literal.StartIndex + truncatedSize},
+             {originalBuffer + literalEndIndex, originalSize - literalEndIndex}});
+}
+
+void vmf::radamsa::mutations::StringMutations::RepeatString(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long originalId,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by repeating the contents of a random string literal and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const StringLiteralIndex> index{GetStringLiteralIndex(originalBuffer, originalSize, originalId)};
+
+    size_t literalIndex{0u};
+
+    if (!GetRandomLiteralIndex(*index, minimumSeedIndex, true, literalIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const StringLiteral& literal{index->Literals[literalIndex]};
+    const size_t literalEndIndex{literal.StartIndex + literal.Size};
+
+    const size_t numberOfRepetitions{GetRandomValueWithinBounds(2u, MAXIMUM_STRING_REPETITIONS)};
+
+    // The new buffer will be larger than the original buffer by the extra copies of the literal;
+    // additionally, it will contain one additional byte since a null-terminator will be appended to the end.
+
+    const size_t newBufferSize{originalSize + literal.Size * (numberOfRepetitions - 1u) + 1u};
+
+    char* newBuffer{newEntry->allocateBuffer(testCaseKey, static_cast<int>(newBufferSize))};
+    char* destination{newBuffer + literalEndIndex};
+
+    memcpy(newBuffer, originalBuffer, literalEndIndex);
+
+    for (size_t it{1u}; it < numberOfRepetitions; ++it)
+    {
+        memcpy(destination, originalBuffer + literal.StartIndex, literal.Size);
+
+        destination += literal.Size;
+    }
+
+    memcpy(destination, originalBuffer + literalEndIndex, originalSize - literalEndIndex);
+    newBuffer[newBufferSize - 1u] = '\0';
+}
+
+void vmf::radamsa::mutations::StringMutations::InjectEscape(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long originalId,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by inserting an escape sequence or special character into a random string literal and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const StringLiteralIndex> index{GetStringLiteralIndex(originalBuffer, originalSize, originalId)};
+
+    size_t literalIndex{0u};
+
+    if (!GetRandomLiteralIndex(*index, minimumSeedIndex, false, literalIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const StringLiteral& literal{index->Literals[literalIndex]};
+
+    size_t injectionIndex{GetRandomValueWithinBounds(literal.StartIndex, literal.StartIndex + literal.Size)};
+
+    if (IsEscaped(originalBuffer, literal.StartIndex, injectionIndex))
+        --injectionIndex;
+
+    const std::string_view injection{STRING_INJECTIONS[GetRandomValueWithinBounds(0u, STRING_INJECTIONS.size() - 1u)]};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, injectionIndex},
+             {injection.data(), injection.size()},
+             {originalBuffer + injectionIndex, originalSize - injectionIndex}});
+}
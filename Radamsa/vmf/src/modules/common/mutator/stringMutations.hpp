@@ -0,0 +1,116 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "seedCache.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Mutations that only edit the contents of double-quoted string literals.
+ *
+ * The literals of a seed are found with the escape-aware block scan shared with the JSON mutations,
+ * so an escaped quote never ends a literal, and their spans are cached by storage entry ID.  The quotes
+ * themselves are never touched, so the rest of the input still tokenizes the way the seed did.
+ */
+class StringMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    static constexpr size_t MAXIMUM_STRING_REPETITIONS{64u};
+
+    struct StringLiteral
+    {
+        size_t StartIndex{0u}; // Offset of the first byte after the opening quote.
+        size_t Size{0u};       // Number of bytes before the closing quote.
+    };
+
+    /**
+     * @brief Closed string literals of a buffer in document order; an unterminated literal at the end is left out.
+     */
+    struct StringLiteralIndex
+    {
+        std::vector<StringLiteral> Literals;
+        std::vector<size_t> NonEmptyLiterals; // Indices of the literals with a Size greater than 0, in order.
+    };
+
+    StringMutations() = delete;
+    virtual ~StringMutations() = default;
+
+    StringMutations(const StringMutations&) = delete;
+    StringMutations(StringMutations&&) = delete;
+
+    StringMutations& operator=(const StringMutations&) = delete;
+    StringMutations& operator=(StringMutations&&) = delete;
+
+    void TruncateString(
+                    StorageEntry* newEntry,
+                    const size_t originalSize,
+                    const char* originalBuffer,
+                    const unsigned long originalId,
+                    const size_t minimumSeedIndex,
+                    const int testCaseKey);
+
+    void RepeatString(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+    void InjectEscape(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+protected:
+    StringMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static StringLiteralIndex BuildStringLiteralIndex(
+                                                const char* const buffer,
+                                                const size_t size);
+
+    std::shared_ptr<const StringLiteralIndex> GetStringLiteralIndex(
+                                                                const char* const buffer,
+                                                                const size_t size,
+                                                                const unsigned long seedId);
+
+    bool GetRandomLiteralIndex(
+                            const StringLiteralIndex& index,
+                            const size_t minimumSeedIndex,
+                            const bool isNonEmpty,
+                            size_t& literalIndex);
+
+private:
+    SeedCache<StringLiteralIndex> stringLiteralIndexCache_;
+};
+}
@@ -0,0 +1,266 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+// VMF Includes
+#include "tokenExtractor.hpp"
+#include "simdScan.hpp"
+
+namespace
+{
+constexpr std::array<uint64_t, vmf::radamsa::mutations::TokenExtractor::SKETCH_DEPTH> SKETCH_MULTIPLIERS{
+                                                                                                0x9E3779B97F4A7C15u,
+                                                                                                0xC2B2AE3D27D4EB4Fu,
+                                                                                                0x165667B19E3779F9u,
+                                                                                                0xD6E8FEB86659FD93u};
+
+constexpr std::array<size_t, 2u> NGRAM_SIZES{4u, 8u};
+
+bool IsWordByte(const char character) noexcept
+{
+    return (character >= 'a' && character <= 'z') ||
+           (character >= 'A' && character <= 'Z') ||
+           (character >= '0' && character <= '9') ||
+           character == '_';
+}
+}
+
+vmf::radamsa::mutations::TokenExtractor::TokenExtractor(const size_t maximumNumberOfTokens) : maximumNumberOfTokens_{maximumNumberOfTokens},
+                                                                                              sketch_(SKETCH_DEPTH * SKETCH_WIDTH, 0u)
+{
+    heap_.reserve(maximumNumberOfTokens_);
+    heapIndices_.reserve(maximumNumberOfTokens_);
+}
+
+uint64_t vmf::radamsa::mutations::TokenExtractor::HashBytes(const char* const data, const size_t size) noexcept
+{
+    // Hash eight bytes at a time, so that the 4 and 8 byte n-grams cost a single multiply.
+
+    uint64_t hash{static_cast<uint64_t>(size) * 0x9E3779B97F4A7C15u};
+    size_t it{0u};
+
+    for (; it + sizeof(uint64_t) <= size; it += sizeof(uint64_t))
+    {
+        uint64_t word{0u};
+
+        memcpy(&word, data + it, sizeof(uint64_t));
+
+        hash = (hash ^ word) * 0xFF51AFD7ED558CCDu;
+        hash ^= hash >> 32u;
+    }
+
+    if (it < size)
+    {
+        uint64_t word{0u};
+
+        memcpy(&word, data + it, size - it);
+
+        hash = (hash ^ word) * 0xFF51AFD7ED558CCDu;
+        hash ^= hash >> 32u;
+    }
+
+    return hash;
+}
+
+uint32_t vmf::radamsa::mutations::TokenExtractor::IncrementSketch(const uint64_t hash) noexcept
+{
+    // Conservative update: only the counters that hold the current estimate are incremented, which keeps over-counting low.
+
+    std::array<size_t, SKETCH_DEPTH> counterIndices;
+
+    uint32_t estimate{std::numeric_limits<uint32_t>::max()};
+
+    for (size_t row{0u}; row < SKETCH_DEPTH; ++row)
+    {
+        counterIndices[row] = row * SKETCH_WIDTH + static_cast<size_t>((hash * SKETCH_MULTIPLIERS[row]) >> (64u - SKETCH_WIDTH_BITS));
+        estimate = std::min(estimate, sketch_[counterIndices[row]]);
+    }
+
+    if (estimate == std::numeric_limits<uint32_t>::max())
+        return estimate;
+
+    for (const size_t counterIndex : counterIndices)
+        if (sketch_[counterIndex] == estimate)
+            ++sketch_[counterIndex];
+
+    return estimate + 1u;
+}
+
+void vmf::radamsa::mutations::TokenExtractor::AddCandidate(const char* const data, const size_t size)
+{
+    const uint32_t count{IncrementSketch(HashBytes(data, size))};
+
+    if (count < MINIMUM_TOKEN_COUNT || maximumNumberOfTokens_ == 0u)
+        return;
+
+    // Most candidates are rarer than the least frequent token already kept, so check that before building a string.
+
+    if (heap_.size() == maximumNumberOfTokens_ && count <= heap_.front().Count)
+        return;
+
+    std::string token{data, size};
+
+    const auto heapIndex{heapIndices_.find(token)};
+
+    if (heapIndex != heapIndices_.end())
+    {
+        heap_[heapIndex->second].Count = count;
+        SiftDown(heapIndex->second);
+
+        return;
+    }
+
+    if (heap_.size() == maximumNumberOfTokens_)
+    {
+        // Replace the least frequent token.
+
+        heapIndices_.erase(heap_.front().Token);
+
+        heap_.front() = HeapEntry{std::move(token), count};
+        heapIndices_[heap_.front().Token] = 0u;
+
+        SiftDown(0u);
+    }
+    else
+    {
+        heap_.push_back(HeapEntry{std::move(token), count});
+        heapIndices_[heap_.back().Token] = heap_.size() - 1u;
+
+        SiftUp(heap_.size() - 1u);
+    }
+
+    ++version_;
+}
+
+void vmf::radamsa::mutations::TokenExtractor::AddEntry(const char* const buffer, const size_t size)
+{
+    if (buffer == nullptr)
+        return;
+
+    // Delimited tokens are the runs of word bytes.
+
+    auto isWordByte{
+                [](const char* const block) -> uint64_t
+                {
+                    return simd::RangeMask(block, 'a', 'z') |
+                           simd::RangeMask(block, 'A', 'Z') |
+                           simd::RangeMask(block, '0', '9') |
+                           simd::EqualMask(block, '_');
+                }};
+
+    simd::ForEachRun(
+                buffer,
+                size,
+                isWordByte,
+                [&](const size_t startIndex, const size_t runSize)
+                {
+                    if (runSize >= MINIMUM_TOKEN_SIZE && runSize <= MAXIMUM_TOKEN_SIZE)
+                        AddCandidate(buffer + startIndex, runSize);
+                });
+
+    // N-grams catch binary tokens such as magic values. Those made only of word bytes are covered by the delimited tokens,
+    // and those of a single repeated byte are padding, so both are skipped using counts kept over the sliding window.
+
+    size_t wordRunSize{0u};
+    size_t repeatedRunSize{0u};
+
+    for (size_t it{0u}; it < size; ++it)
+    {
+        wordRunSize = IsWordByte(buffer[it]) ? wordRunSize + 1u : 0u;
+        repeatedRunSize = (it > 0u && buffer[it] == buffer[it - 1u]) ? repeatedRunSize + 1u : 1u;
+
+        for (const size_t ngramSize : NGRAM_SIZES)
+            if (it + 1u >= ngramSize && wordRunSize < ngramSize && repeatedRunSize < ngramSize)
+                AddCandidate(buffer + it + 1u - ngramSize, ngramSize);
+    }
+}
+
+std::vector<std::string> vmf::radamsa::mutations::TokenExtractor::GetTokens() const
+{
+    std::vector<const HeapEntry*> entries;
+
+    entries.reserve(heap_.size());
+
+    for (const HeapEntry& entry : heap_)
+        entries.push_back(&entry);
+
+    std::sort(
+        entries.begin(),
+        entries.end(),
+        [](const HeapEntry* left, const HeapEntry* right) { return left->Count > right->Count || (left->Count == right->Count && left->Token < right->Token); });
+
+    std::vector<std::string> tokens;
+
+    tokens.reserve(entries.size());
+
+    for (const HeapEntry* entry : entries)
+        tokens.push_back(entry->Token);
+
+    return tokens;
+}
+
+void vmf::radamsa::mutations::TokenExtractor::SwapHeapEntries(const size_t left, const size_t right)
+{
+    std::swap(heap_[left], heap_[right]);
+
+    heapIndices_[heap_[left].Token] = left;
+    heapIndices_[heap_[right].Token] = right;
+}
+
+void vmf::radamsa::mutations::TokenExtractor::SiftUp(size_t heapIndex)
+{
+    while (heapIndex > 0u)
+    {
+        const size_t parentIndex{(heapIndex - 1u) / 2u};
+
+        if (heap_[parentIndex].Count <= heap_[heapIndex].Count)
+            break;
+
+        SwapHeapEntries(parentIndex, heapIndex);
+        heapIndex = parentIndex;
+    }
+}
+
+void vmf::radamsa::mutations::TokenExtractor::SiftDown(size_t heapIndex)
+{
+    while (true)
+    {
+        const size_t leftIndex{2u * heapIndex + 1u};
+        const size_t rightIndex{leftIndex + 1u};
+
+        size_t smallestIndex{heapIndex};
+
+        if (leftIndex < heap_.size() && heap_[leftIndex].Count < heap_[smallestIndex].Count)
+            smallestIndex = leftIndex;
+
+        if (rightIndex < heap_.size() && heap_[rightIndex].Count < heap_[smallestIndex].Count)
+            smallestIndex = rightIndex;
+
+        if (smallestIndex == heapIndex)
+            break;
+
+        SwapHeapEntries(heapIndex, smallestIndex);
+        heapIndex = smallestIndex;
+    }
+}
@@ -0,0 +1,102 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as 
+ * published by the Free Software Foundation.
+ *  
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *  
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *  
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Extracts a token dictionary from the entries of a corpus.
+ *
+ * Every entry that is added contributes its delimited tokens (runs of letters, digits and underscores)
+ * and its 4 and 8 byte n-grams.  Their frequencies are estimated with a count-min sketch, and the most
+ * frequent ones are kept in a bounded min-heap, so memory stays fixed however large the corpus grows and
+ * adding an entry costs time linear in its size.
+ */
+class TokenExtractor
+{
+public:
+    static constexpr size_t SKETCH_DEPTH{4u};
+    static constexpr size_t SKETCH_WIDTH_BITS{14u};
+    static constexpr size_t SKETCH_WIDTH{size_t{1u} << SKETCH_WIDTH_BITS};
+
+    static constexpr size_t MINIMUM_TOKEN_SIZE{3u};
+    static constexpr size_t MAXIMUM_TOKEN_SIZE{32u};
+
+    // Candidates seen fewer times than this are never published.
+
+    static constexpr uint32_t MINIMUM_TOKEN_COUNT{2u};
+
+    TokenExtractor() = delete;
+    ~TokenExtractor() = default;
+
+    explicit TokenExtractor(const size_t maximumNumberOfTokens);
+
+    TokenExtractor(const TokenExtractor&) = delete;
+    TokenExtractor(TokenExtractor&&) = delete;
+
+    TokenExtractor& operator=(const TokenExtractor&) = delete;
+    TokenExtractor& operator=(TokenExtractor&&) = delete;
+
+    void AddEntry(const char* const buffer, const size_t size);
+
+    /**
+     * @brief Returns the most frequent tokens seen so far, most frequent first.
+     */
+    std::vector<std::string> GetTokens() const;
+
+    /**
+     * @brief Incremented whenever the set of tokens returned by GetTokens changes.
+     */
+    uint64_t GetVersion() const noexcept { return version_; }
+
+    static uint64_t HashBytes(const char* const data, const size_t size) noexcept;
+
+private:
+    struct HeapEntry
+    {
+        std::string Token;
+        uint32_t Count{0u};
+    };
+
+    uint32_t IncrementSketch(const uint64_t hash) noexcept;
+
+    void AddCandidate(const char* const data, const size_t size);
+
+    void SiftUp(size_t heapIndex);
+    void SiftDown(size_t heapIndex);
+    void SwapHeapEntries(const size_t left, const size_t right);
+
+    const size_t maximumNumberOfTokens_;
+
+    std::vector<uint32_t> sketch_; // SKETCH_DEPTH rows of SKETCH_WIDTH counters.
+
+    std::vector<HeapEntry> heap_;  // Min-heap on Count.
+    std::unordered_map<std::string, size_t> heapIndices_;
+
+    uint64_t version_{0u};
+};
+}
@@ -0,0 +1,377 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+
+// C/C++ Includes
+#include <algorithm>
+#include <cstring>
+
+// VMF Includes
+#include "wordMutations.hpp"
+#include "bufferSegments.hpp"
+#include "simdScan.hpp"
+
+vmf::radamsa::mutations::WordMutations::WordTokenIndex vmf::radamsa::mutations::WordMutations::BuildWordTokenIndex(
+                                                                                                            const char* const buffer,
+                                                                                                            const size_t size)
+{
+    WordTokenIndex index;
+
+    if (buffer == nullptr)
+        return index;
+
+    // A token boundary is any byte where the byte either enters or leaves a token, or switches between word
+    // and punctuation bytes inside a token. Both masks are carried over from the last byte of the previous block.
+
+    uint64_t previousTokenBit{0u};
+    uint64_t previousWordBit{0u};
+
+    bool isInToken{false};
+    bool isWordToken{false};
+    size_t tokenStartIndex{0u};
+
+    simd::ForEachBlock(
+                buffer,
+                size,
+                [&](const char* const block, const size_t blockOffset, const uint64_t validMask)
+                {
+                    const uint64_t whitespaceMask{
+                                            simd::EqualMask(block, ' ') |
+                                            simd::RangeMask(block, '\t', '\r')};
+                    const uint64_t wordMask{
+                                        (simd::RangeMask(block, 'a', 'z') |
+                                         simd::RangeMask(block, 'A', 'Z') |
+                                         simd::RangeMask(block, '0', '9') |
+                                         simd::RangeMask(block, 0x80u, 0xffu) |
+                                         simd::EqualMask(block, '_')) & validMask};
+                    const uint64_t tokenMask{~whitespaceMask & validMask};
+
+                    const uint64_t shiftedTokenMask{(tokenMask << 1u) | previousTokenBit};
+                    const uint64_t shiftedWordMask{(wordMask << 1u) | previousWordBit};
+
+                    for (uint64_t boundaryMask{(tokenMask ^ shiftedTokenMask) | (tokenMask & shiftedTokenMask & (wordMask ^ shiftedWordMask))};
+                         boundaryMask != 0u;
+                         boundaryMask &= boundaryMask - 1u)
+                    {
+                        const size_t bitIndex{simd::CountTrailingZeros(boundaryMask)};
+                        const size_t boundaryIndex{blockOffset + bitIndex};
+
+                        // Close the current token, if any, and open a new one unless the boundary starts whitespace.
+
+                        if (isInToken)
+                            index.Tokens.push_back(WordToken{tokenStartIndex, boundaryIndex - tokenStartIndex, isWordToken});
+
+                        isInToken = ((tokenMask >> bitIndex) & 1u) != 0u;
+                        isWordToken = ((wordMask >> bitIndex) & 1u) != 0u;
+                        tokenStartIndex = boundaryIndex;
+                    }
+
+                    previousTokenBit = tokenMask >> (simd::BLOCK_SIZE - 1u);
+                    previousWordBit = wordMask >> (simd::BLOCK_SIZE - 1u);
+                });
+
+    if (isInToken)
+        index.Tokens.push_back(WordToken{tokenStartIndex, size - tokenStartIndex, isWordToken});
+
+    for (size_t it{0u}; it < index.Tokens.size(); ++it)
+        (index.Tokens[it].IsWord ? index.WordTokens : index.PunctuationTokens).push_back(it);
+
+    return index;
+}
+
+std::shared_ptr<const vmf::radamsa::mutations::WordMutations::WordTokenIndex> vmf::radamsa::mutations::WordMutations::GetWordTokenIndex(
+                                                                                                                                const char* const buffer,
+                                                                                                                                const size_t size,
+                                                                                                                                const unsigned long seedId)
+{
+    return wordTokenIndexCache_.GetOrBuild(
+                                        seedId,
+                                        [&]() { return BuildWordTokenIndex(buffer, size); });
+}
+
+bool vmf::radamsa::mutations::WordMutations::GetRandomWordTokenIndex(
+                                                                const WordTokenIndex& index,
+                                                                const size_t minimumSeedIndex,
+                                                                size_t& tokenIndex)
+{
+    // Tokens are in document order, so the ones at or after the minimum seed index form a suffix of the list.
+
+    const auto firstToken{
+                    std::partition_point(
+                                    index.Tokens.begin(),
+                                    index.Tokens.end(),
+                                    [&](const WordToken& token) { return token.StartIndex < minimumSeedIndex; })};
+
+    if (firstToken == index.Tokens.end())
+        return false;
+
+    tokenIndex = GetRandomValueWithinBounds(
+                                        static_cast<size_t>(firstToken - index.Tokens.begin()),
+                                        index.Tokens.size() - 1u);
+
+    return true;
+}
+
+void vmf::radamsa::mutations::WordMutations::RepeatWordToken(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const WordTokenIndex& index,
+                                                        const size_t tokenIndex,
+                                                        const size_t numberOfRepetitions,
+                                                        const int testCaseKey)
+{
+    const WordToken& token{index.Tokens[tokenIndex]};
+    const size_t tokenEndIndex{token.StartIndex + token.Size};
+
+    // The copies are separated by the whitespace that follows the token. Words with nothing after them
+    // are separated by a space, so that the copies do not merge into one longer word.
+
+    const size_t nextTokenIndex{(tokenIndex + 1u < index.Tokens.size()) ? index.Tokens[tokenIndex + 1u].StartIndex : originalSize};
+
+    const char* separator{originalBuffer + tokenEndIndex};
+    size_t separatorSize{nextTokenIndex - tokenEndIndex};
+
+    if (separatorSize == 0u && token.IsWord)
+    {
+        separator = " ";
+        separatorSize = 1u;
+    }
+
+    // The new buffer will be larger than the original buffer by the extra copies of the token and their separators;
+    // additionally, it will contain one additional byte since a null-terminator will be appended to the end.
+
+    const size_t newBufferSize{originalSize + (separatorSize + token.Size) * (numberOfRepetitions - 1u) + 1u};
+
+    char* newBuffer{newEntry->allocateBuffer(testCaseKey, static_cast<int>(newBufferSize))};
+    char* destination{newBuffer + tokenEndIndex};
+
+    memcpy(newBuffer, originalBuffer, tokenEndIndex);
+
+    for (size_t it{1u}; it < numberOfRepetitions; ++it)
+    {
+        memcpy(destination, separator, separatorSize);
+        memcpy(destination + separatorSize, originalBuffer + token.StartIndex, token.Size);
+
+        destination += separatorSize + token.Size;
+    }
+
+    memcpy(destination, originalBuffer + tokenEndIndex, originalSize - tokenEndIndex);
+    newBuffer[newBufferSize - 1u] = '\0';
+}
+
+void vmf::radamsa::mutations::WordMutations::DeleteWord(
+                                                    StorageEntry* newEntry,
+                                                    const size_t originalSize,
+                                                    const char* originalBuffer,
+                                                    const unsigned long originalId,
+                                                    const size_t minimumSeedIndex,
+                                                    const int testCaseKey)
+{
+    // Consume the original buffer by removing a random token and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const WordTokenIndex> index{GetWordTokenIndex(originalBuffer, originalSize, originalId)};
+
+    size_t tokenIndex{0u};
+
+    if (!GetRandomWordTokenIndex(*index, minimumSeedIndex, tokenIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const WordToken& token{index->Tokens[tokenIndex]};
+    const size_t tokenEndIndex{token.StartIndex + token.Size};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, token.StartIndex},
+             {originalBuffer + tokenEndIndex, originalSize - tokenEndIndex}});
+}
+
+void vmf::radamsa::mutations::WordMutations::DuplicateWord(
+                                                        StorageEntry* newEntry,
+                                                        const size_t originalSize,
+                                                        const char* originalBuffer,
+                                                        const unsigned long originalId,
+                                                        const size_t minimumSeedIndex,
+                                                        const int testCaseKey)
+{
+    // Consume the original buffer by repeating a random token once right after itself and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const WordTokenIndex> index{GetWordTokenIndex(originalBuffer, originalSize, originalId)};
+
+    size_t tokenIndex{0u};
+
+    if (!GetRandomWordTokenIndex(*index, minimumSeedIndex, tokenIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    RepeatWordToken(newEntry, originalSize, originalBuffer, *index, tokenIndex, 2u, testCaseKey);
+}
+
+void vmf::radamsa::mutations::WordMutations::SwapWords(
+                                                    StorageEntry* newEntry,
+                                                    const size_t originalSize,
+                                                    const char* originalBuffer,
+                                                    const unsigned long originalId,
+                                                    const size_t minimumSeedIndex,
+                                                    const int testCaseKey)
+{
+    // Consume the original buffer by swapping two random tokens and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const WordTokenIndex> index{GetWordTokenIndex(originalBuffer, originalSize, originalId)};
+
+    size_t firstTokenIndex{0u};
+
+    if (!GetRandomWordTokenIndex(*index, minimumSeedIndex, firstTokenIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    // The second token is another eligible token of the same kind, so that swapping a word with
+    // punctuation does not merge it with its neighbours into a different token.
+
+    const std::vector<size_t>& sameKindTokens{index->Tokens[firstTokenIndex].IsWord ? index->WordTokens : index->PunctuationTokens};
+
+    const size_t firstEligibleRank{
+                                static_cast<size_t>(
+                                            std::partition_point(
+                                                            sameKindTokens.begin(),
+                                                            sameKindTokens.end(),
+                                                            [&](const size_t token) { return index->Tokens[token].StartIndex < minimumSeedIndex; }) - sameKindTokens.begin())};
+
+    if (firstEligibleRank + 2u > sameKindTokens.size())
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    const size_t firstRank{static_cast<size_t>(std::lower_bound(sameKindTokens.begin(), sameKindTokens.end(), firstTokenIndex) - sameKindTokens.begin())};
+
+    size_t secondRank{GetRandomValueWithinBounds(firstEligibleRank, sameKindTokens.size() - 2u)};
+
+    if (secondRank >= firstRank)
+        ++secondRank;
+
+    size_t secondTokenIndex{sameKindTokens[secondRank]};
+
+    // Tokens never overlap, so the swap only needs them in order.
+
+    if (secondTokenIndex < firstTokenIndex)
+        std::swap(firstTokenIndex, secondTokenIndex);
+
+    const WordToken& firstToken{index->Tokens[firstTokenIndex]};
+    const WordToken& secondToken{index->Tokens[secondTokenIndex]};
+
+    const size_t firstEndIndex{firstToken.StartIndex + firstToken.Size};
+    const size_t secondEndIndex{secondToken.StartIndex + secondToken.Size};
+
+    WriteSegments(
+            newEntry,
+            testCaseKey,
+            {{originalBuffer, firstToken.StartIndex},
+             {originalBuffer + secondToken.StartIndex, secondToken.Size},
+             {originalBuffer + firstEndIndex, secondToken.StartIndex - firstEndIndex},
+             {originalBuffer + firstToken.StartIndex, firstToken.Size},
+             {originalBuffer + secondEndIndex, originalSize - secondEndIndex}});
+}
+
+void vmf::radamsa::mutations::WordMutations::RepeatWord(
+                                                    StorageEntry* newEntry,
+                                                    const size_t originalSize,
+                                                    const char* originalBuffer,
+                                                    const unsigned long originalId,
+                                                    const size_t minimumSeedIndex,
+                                                    const int testCaseKey)
+{
+    // Consume the original buffer by repeating a random token a random number of times and appending a null-terminator to the end.
+
+    constexpr size_t minimumSize{1u};
+
+    if (originalSize < minimumSize)
+        throw RuntimeException{"The buffer's minimum size must be greater than or equal to 1", RuntimeException::USAGE_ERROR};
+
+    if (minimumSeedIndex > originalSize - 1u)
+        throw RuntimeException{"Minimum seed index is out of bounds", RuntimeException::INDEX_OUT_OF_RANGE};
+
+    if (originalBuffer == nullptr)
+        throw RuntimeException{"Input buffer is null", RuntimeException::UNEXPECTED_ERROR};
+
+    const std::shared_ptr<const WordTokenIndex> index{GetWordTokenIndex(originalBuffer, originalSize, originalId)};
+
+    size_t tokenIndex{0u};
+
+    if (!GetRandomWordTokenIndex(*index, minimumSeedIndex, tokenIndex))
+    {
+        WriteSegments(newEntry, testCaseKey, {{originalBuffer, originalSize}});
+
+        return;
+    }
+
+    RepeatWordToken(
+                newEntry,
+                originalSize,
+                originalBuffer,
+                *index,
+                tokenIndex,
+                GetRandomValueWithinBounds(3u, MAXIMUM_WORD_REPETITIONS),
+                testCaseKey);
+}
@@ -0,0 +1,131 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <vector>
+
+// Module Includes
+#include "mutationBase.hpp"
+#include "seedCache.hpp"
+
+// VMF Includes
+#include "StorageEntry.hpp"
+#include "RuntimeException.hpp"
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Token level counterparts of the line mutations, for minified code, SQL and other single line inputs.
+ *
+ * A token is a run of word bytes (letters, digits, underscores and non-ASCII bytes) or a run of
+ * punctuation; whitespace separates tokens but never belongs to one.  The token boundaries of a seed
+ * are found with a block classifier in a single pass and cached by storage entry ID.
+ */
+class WordMutations: public vmf::radamsa::mutations::MutationBase
+{
+public:
+    static constexpr size_t MAXIMUM_WORD_REPETITIONS{64u};
+
+    struct WordToken
+    {
+        size_t StartIndex{0u};
+        size_t Size{0u};
+        bool IsWord{false}; // False for a run of punctuation.
+    };
+
+    struct WordTokenIndex
+    {
+        std::vector<WordToken> Tokens;
+        std::vector<size_t> WordTokens;        // Indices of the word tokens, in order.
+        std::vector<size_t> PunctuationTokens; // Indices of the punctuation tokens, in order.
+    };
+
+    WordMutations() = delete;
+    virtual ~WordMutations() = default;
+
+    WordMutations(const WordMutations&) = delete;
+    WordMutations(WordMutations&&) = delete;
+
+    WordMutations& operator=(const WordMutations&) = delete;
+    WordMutations& operator=(WordMutations&&) = delete;
+
+    void DeleteWord(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+    void DuplicateWord(
+                    StorageEntry* newEntry,
+                    const size_t originalSize,
+                    const char* originalBuffer,
+                    const unsigned long originalId,
+                    const size_t minimumSeedIndex,
+                    const int testCaseKey);
+
+    void SwapWords(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+    void RepeatWord(
+                StorageEntry* newEntry,
+                const size_t originalSize,
+                const char* originalBuffer,
+                const unsigned long originalId,
+                const size_t minimumSeedIndex,
+                const int testCaseKey);
+
+protected:
+    WordMutations(std::default_random_engine& randomNumberGenerator) : MutationBase{randomNumberGenerator} {}
+
+    static WordTokenIndex BuildWordTokenIndex(
+                                        const char* const buffer,
+                                        const size_t size);
+
+    std::shared_ptr<const WordTokenIndex> GetWordTokenIndex(
+                                                        const char* const buffer,
+                                                        const size_t size,
+                                                        const unsigned long seedId);
+
+    bool GetRandomWordTokenIndex(
+                            const WordTokenIndex& index,
+                            const size_t minimumSeedIndex,
+                            size_t& tokenIndex);
+
+    void RepeatWordToken(
+                    StorageEntry* newEntry,
+                    const size_t originalSize,
+                    const char* originalBuffer,
+                    const WordTokenIndex& index,
+                    const size_t tokenIndex,
+                    const size_t numberOfRepetitions,
+                    const int testCaseKey);
+
+private:
+    SeedCache<WordTokenIndex> wordTokenIndexCache_;
+};
+}
@@ -0,0 +1,104 @@
+/* =============================================================================
+ * Vader Modular Fuzzer (VMF)
+ * Copyright (c) 2021-2025 The Charles Stark Draper Laboratory, Inc.
+ * <vmf@draper.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 (only) as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * @license GPL-2.0-only <https://spdx.org/licenses/GPL-2.0-only.html>
+ * ===========================================================================*/
+#pragma once
+
+// C/C++ Includes
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace vmf::radamsa::mutations
+{
+/**
+ * @brief Task deque owned by one worker thread, from which idle workers steal.
+ *
+ * The owner takes its newest task, so that it keeps working on what it pushed last, while thieves take the
+ * oldest one, so that owner and thief rarely contend for the same end.  Tasks are coarse, so every operation
+ * simply takes the deque's own lock.
+ */
+template<typename T>
+class WorkStealingDeque
+{
+public:
+    WorkStealingDeque() = default;
+    ~WorkStealingDeque() = default;
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    void Push(T&& value)
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+
+        items_.push_back(std::move(value));
+    }
+
+    /**
+     * @brief Pushes the values in order under one lock, so the owner never sees only part of them.
+     */
+    void PushAll(std::vector<T>&& values)
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+
+        for (T& value : values)
+            items_.push_back(std::move(value));
+    }
+
+    /**
+     * @brief Owner side; takes the newest task, returning false when the deque is empty.
+     */
+    bool TryPop(T& value)
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+
+        if (items_.empty())
+            return false;
+
+        value = std::move(items_.back());
+        items_.pop_back();
+
+        return true;
+    }
+
+    /**
+     * @brief Thief side; takes the oldest task, returning false when the deque is empty.
+     */
+    bool TrySteal(T& value)
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+
+        if (items_.empty())
+            return false;
+
+        value = std::move(items_.front());
+        items_.pop_front();
+
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    std::deque<T> items_;
+};
+}